@@ -0,0 +1,253 @@
+/* ahoc.c
+ *
+ * Implementation of the Aho-Corasick automaton. The trie of literals
+ * is turned into a complete deterministic automaton, so a search
+ * costs exactly one table lookup per input byte. To keep the table
+ * small, bytes are first mapped to byte classes: every byte that
+ * shows up in some literal gets its own class, and every other byte
+ * shares class zero, which always leads back to the root.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "ahoc.h"
+
+// If this number isn't a power of two, then the literal array
+//   won't be grown correctly.
+#define DEFCAP 8
+
+/* ahoc
+ *
+ * Declaration of the automaton. Per-state information is kept in
+ * parallel arrays indexed by state number; state zero is the root.
+ */
+struct _ahoc {
+   char** literals;     // copies of the literals, in priority order
+   int nlit;            // number of literals
+   int maxlen;          // length of the longest literal
+   unsigned char map[256]; // byte to byte class
+   int nclass;          // number of byte classes
+   int* trans;          // transition table, nstates * nclass
+   int* out;            // literal ending at a state, or -1
+   int* dict;           // next state on the failure chain with an
+                        //   output, or 0
+   int* depth;          // length of the string a state represents
+   int nstates;         // number of states
+   int capstates;       // capacity of the per-state arrays
+   bool built;
+};
+
+/***************************building*********************************/
+
+/** add_state
+  *
+  * Create a new state with no transitions, growing the per-state
+  * arrays if necessary. Returns the new state.
+  */
+static int add_state(ahoc_t* ac, int depth) {
+   if (ac->nstates == ac->capstates) {
+      ac->capstates *= 2;
+      ac->trans = realloc(ac->trans,
+                          ac->capstates * ac->nclass * sizeof(int));
+      ac->out   = realloc(ac->out,   ac->capstates * sizeof(int));
+      ac->dict  = realloc(ac->dict,  ac->capstates * sizeof(int));
+      ac->depth = realloc(ac->depth, ac->capstates * sizeof(int));
+      assert(ac->trans && ac->out && ac->dict && ac->depth);
+   }
+   int s = ac->nstates++;
+   for (int c = 0; c < ac->nclass; ++c)
+      ac->trans[s * ac->nclass + c] = -1;
+   ac->out[s] = -1;
+   ac->dict[s] = 0;
+   ac->depth[s] = depth;
+   return s;
+}
+
+/** make_classes
+  *
+  * Give every byte that occurs in a literal its own byte class.
+  */
+static void make_classes(ahoc_t* ac) {
+   memset(ac->map, 0, sizeof(ac->map));
+   ac->nclass = 1;
+   for (int i = 0; i < ac->nlit; ++i) {
+      for (unsigned char* u = (unsigned char*) ac->literals[i];
+                                                      *u; ++u) {
+         if (!ac->map[*u])
+            ac->map[*u] = ac->nclass++;
+      }
+   }
+}
+
+/** make_trie
+  *
+  * Insert every literal into the trie. If two literals are the same,
+  * the first one keeps the state.
+  */
+static void make_trie(ahoc_t* ac) {
+   ac->capstates = DEFCAP;
+   ac->trans = malloc(ac->capstates * ac->nclass * sizeof(int));
+   ac->out   = malloc(ac->capstates * sizeof(int));
+   ac->dict  = malloc(ac->capstates * sizeof(int));
+   ac->depth = malloc(ac->capstates * sizeof(int));
+   assert(ac->trans && ac->out && ac->dict && ac->depth);
+   (void) add_state(ac, 0);
+   for (int i = 0; i < ac->nlit; ++i) {
+      int s = 0;
+      for (unsigned char* u = (unsigned char*) ac->literals[i];
+                                                      *u; ++u) {
+         int* next = &ac->trans[s * ac->nclass + ac->map[*u]];
+         if (*next < 0) {
+            int depth = ac->depth[s] + 1;
+            int ns = add_state(ac, depth);    // may move ac->trans
+            next = &ac->trans[s * ac->nclass + ac->map[*u]];
+            *next = ns;
+         }
+         s = *next;
+      }
+      if (ac->out[s] < 0)
+         ac->out[s] = i;
+   }
+}
+
+/** make_automaton
+  *
+  * Breadth first traversal of the trie that computes failure links
+  * and fills in every missing transition, so that the trie becomes
+  * a complete automaton. Failure links are only needed while
+  * building, so they're kept in a temporary array.
+  */
+static void make_automaton(ahoc_t* ac) {
+   int* fail  = calloc(ac->nstates, sizeof(int));
+   int* queue = malloc(ac->nstates * sizeof(int));
+   assert(fail && queue);
+   int qhead = 0, qtail = 0;
+   int* root = ac->trans;
+   for (int c = 0; c < ac->nclass; ++c) {
+      if (root[c] < 0) {
+         root[c] = 0;
+      } else {
+         fail[root[c]] = 0;
+         queue[qtail++] = root[c];
+      }
+   }
+   while (qhead != qtail) {
+      int s = queue[qhead++];
+      int* row  = &ac->trans[s * ac->nclass];
+      int* frow = &ac->trans[fail[s] * ac->nclass];
+      for (int c = 0; c < ac->nclass; ++c) {
+         int next = row[c];
+         if (next < 0) {
+            row[c] = frow[c];
+            continue;
+         }
+         int f = frow[c];
+         fail[next] = f;
+         ac->dict[next] = ac->out[f] >= 0 ? f : ac->dict[f];
+         queue[qtail++] = next;
+      }
+   }
+   free(queue);
+   free(fail);
+}
+
+/**************************public functions**************************/
+
+void ahoc_add(ahoc_t* ac, char* literal) {
+   assert(ac && literal && *literal);
+   assert(!ac->built);
+   if (ac->nlit >= DEFCAP && (ac->nlit & (ac->nlit - 1)) == 0) {
+      ac->literals = realloc(ac->literals,
+                             ac->nlit * 2 * sizeof(char*));
+      assert(ac->literals);
+   }
+   ac->literals[ac->nlit++] = strdup(literal);
+   int len = strlen(literal);
+   if (len > ac->maxlen)
+      ac->maxlen = len;
+}
+
+void ahoc_build(ahoc_t* ac) {
+   assert(ac && !ac->built);
+   make_classes(ac);
+   make_trie(ac);
+   make_automaton(ac);
+   ac->built = true;
+}
+
+char* ahoc_search(ahoc_t* ac, char* str, char* last,
+                                  char** end, int* which) {
+   assert(ac && ac->built);
+   assert(str && last && end && which);
+   char* best = NULL;
+   int s = 0;
+   for (char* p = str; p < last && *p != '\0'; ++p) {
+      s = ac->trans[s * ac->nclass + ac->map[(unsigned char) *p]];
+
+      // A literal that ends here begins at p + 1 - depth. Keep the
+      //   one that begins first, and of those, the one added first.
+      for (int m = ac->out[s] >= 0 ? s : ac->dict[s];
+                                          m; m = ac->dict[m]) {
+         char* begin = p + 1 - ac->depth[m];
+         if (!best || begin < best
+                   || (begin == best && ac->out[m] < *which)) {
+            best = begin;
+            *which = ac->out[m];
+            *end = p + 1;
+         }
+      }
+
+      // Nothing that ends after p can begin at or before best.
+      if (best && p + 1 - ac->maxlen >= best)
+         break;
+   }
+   return best;
+}
+
+int ahoc_size(ahoc_t* ac) {
+   assert(ac);
+   return ac->nlit;
+}
+
+char* ahoc_literal(ahoc_t* ac, int which) {
+   assert(ac && which >= 0 && which < ac->nlit);
+   return ac->literals[which];
+}
+
+size_t ahoc_bytes(ahoc_t* ac) {
+   assert(ac);
+   int cap = DEFCAP;
+   while (cap < ac->nlit)
+      cap *= 2;
+   size_t bytes = sizeof(ahoc_t) + cap * sizeof(char*)
+                + ac->capstates * (ac->nclass + 3) * sizeof(int);
+   for (int i = 0; i < ac->nlit; ++i)
+      bytes += strlen(ac->literals[i]) + 1;
+   return bytes;
+}
+
+ahoc_t* ahoc_new() {
+   ahoc_t* ac = calloc(1, sizeof(ahoc_t));
+   assert(ac);
+   ac->literals = calloc(DEFCAP, sizeof(char*));
+   assert(ac->literals);
+   return ac;
+}
+
+void ahoc_free(ahoc_t* ac) {
+   if (ac) {
+      for (int i = 0; i < ac->nlit; ++i)
+         free(ac->literals[i]);
+      free(ac->literals);
+      free(ac->trans);
+      free(ac->out);
+      free(ac->dict);
+      free(ac->depth);
+      free(ac);
+   }
+}
+
+/********************************************************************/
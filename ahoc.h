@@ -0,0 +1,79 @@
+/* ahoc.h
+ *
+ * Aho-Corasick automaton for finding any one of a set of literal
+ * strings in a single pass over the input. Used in place of the
+ * backtracking core when a regular expression is nothing more than
+ * an alternation of literals, like 'error|fatal|panic'.
+ */
+
+#ifndef __regex_ahoc
+#define __regex_ahoc
+
+#include <stddef.h>
+
+typedef struct _ahoc ahoc_t;
+
+/** add
+  *
+  * Add a literal to the automaton. Literals are numbered in the order
+  * that they're added, starting at zero; a literal added earlier is
+  * preferred over one added later, the same way that an earlier
+  * branch of an alternation is preferred over a later one. The
+  * automaton keeps its own copy of the string. Literals can't be
+  * added after the automaton is built.
+  */
+void ahoc_add(ahoc_t*, char*);
+
+/** build
+  *
+  * Compute the failure links and the transition table. This must be
+  * called after the last literal is added and before the first
+  * search.
+  */
+void ahoc_build(ahoc_t*);
+
+/** search
+  *
+  * Find the leftmost-first match in the string: the match that
+  * begins closest to the front of the string, and of the literals
+  * that match there, the one that was added first. The third
+  * argument bounds the search; no match that ends after it is found,
+  * and the search also stops at a null terminating character. Return
+  * a pointer to the beginning of the match and set *end to one after
+  * the end of the match and *which to the number of the literal, or
+  * return NULL if none of the literals occur in the string. The run
+  * time doesn't depend on the number of literals.
+  */
+char* ahoc_search(ahoc_t*, char*, char* last, char** end, int* which);
+
+/** size
+  *
+  * Get the number of literals in the automaton.
+  */
+int ahoc_size(ahoc_t*);
+
+/** literal
+  *
+  * Get the literal with the given number.
+  */
+char* ahoc_literal(ahoc_t*, int);
+
+/** bytes
+  *
+  * Get the number of bytes of memory used by the automaton.
+  */
+size_t ahoc_bytes(ahoc_t*);
+
+/** new
+  *
+  * Create an automaton with no literals.
+  */
+ahoc_t* ahoc_new();
+
+/** free
+  *
+  * Deallocate the automaton and its copies of the literals.
+  */
+void ahoc_free(ahoc_t*);
+
+#endif
@@ -0,0 +1,333 @@
+/* arena.c
+ *
+ * Implementation of the image builder. An image file is the block as
+ * it was built, beginning with the header, followed by the offsets of
+ * all of the pointer fields in the block. In the file, a pointer
+ * field holds the offset of its target.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "arena.h"
+
+// Alignment of every allocation.
+#define ALIGN 16
+
+// Initial capacity of the block and of the lists.
+#define DEFCAP 1024
+
+#define MAGIC "SHREIMG"
+#define VERSION 2
+
+// Written in the header in native byte order, to catch images from a
+//   machine with the other order.
+#define ORDER 0x01020304
+
+/* header
+ *
+ * Beginning of every image. Takes up the first HEADER bytes of the
+ * block.
+ */
+typedef struct {
+   char magic[8];
+   uint32_t version;
+   uint32_t order;
+   uint32_t ptrsize;
+   uint32_t pad;
+   uint64_t size;      // bytes in the block, header included
+   uint64_t nrelocs;   // number of pointer fields
+   uint64_t root;      // offset of the root object
+} header_t;
+
+#define HEADER ((sizeof(header_t) + ALIGN - 1) / ALIGN * ALIGN)
+
+/* copy
+ *
+ * An original object and the offset of its copy, or a field that's
+ * waiting for the copy of an original object.
+ */
+typedef struct {
+   const void* original;
+   size_t offset;
+} copy_t;
+
+struct _arena {
+   char* data;
+   size_t size;
+   size_t cap;
+   size_t* relocs;      // offsets of pointer fields
+   size_t nrelocs;
+   size_t caprelocs;
+   copy_t* notes;       // copies made so far
+   size_t nnotes;
+   size_t capnotes;
+   copy_t* pending;     // fields waiting for a copy
+   size_t npending;
+   size_t cappending;
+   void** externs;      // objects outside the arena that it points at
+   size_t nexterns;
+   size_t capexterns;
+   bool local;          // finished by arena_finish
+};
+
+/***************************static functions*************************/
+
+/** grow
+  *
+  * Make room for one more element in a list.
+  */
+static void* grow(void* list, size_t* cap, size_t len, size_t elsize) {
+   if (len < *cap)
+      return list;
+   *cap = *cap ? *cap * 2 : DEFCAP;
+   list = realloc(list, *cap * elsize);
+   assert(list);
+   return list;
+}
+
+/** compare_copies
+  *
+  * Order copies by the address of the original.
+  */
+static int compare_copies(const void* a, const void* b) {
+   uintptr_t x = (uintptr_t) ((const copy_t*) a)->original;
+   uintptr_t y = (uintptr_t) ((const copy_t*) b)->original;
+   return x < y ? -1 : x > y;
+}
+
+/** resolve
+  *
+  * Fill in the fields waiting for copies.
+  */
+static void resolve(arena_t* arena) {
+   qsort(arena->notes, arena->nnotes, sizeof(copy_t), &compare_copies);
+   for (size_t i = 0; i < arena->npending; ++i) {
+      copy_t* found = bsearch(&arena->pending[i], arena->notes,
+                      arena->nnotes, sizeof(copy_t), &compare_copies);
+      assert(found);
+      arena_link(arena, arena->pending[i].offset, found->offset);
+   }
+   arena->npending = 0;
+}
+
+/** relocate
+  *
+  * Turn offsets in the pointer fields of a block into pointers. The
+  * block holds the image from offset first on.
+  */
+static void relocate(char* block, size_t first,
+                              size_t* relocs, size_t nrelocs) {
+   for (size_t i = 0; i < nrelocs; ++i) {
+      uintptr_t* field = (uintptr_t*) (block + (relocs[i] - first));
+      *field = (uintptr_t) block + (*field - first);
+   }
+}
+
+/** write_all
+  *
+  * Write a whole buffer, however many calls it takes.
+  */
+static bool write_all(int fd, const void* buf, size_t len) {
+   const char* p = buf;
+   while (len) {
+      ssize_t n = write(fd, p, len);
+      if (n < 0)
+         return false;
+      p += n;
+      len -= n;
+   }
+   return true;
+}
+
+/***************************public functions*************************/
+
+size_t arena_alloc(arena_t* arena, size_t size) {
+   assert(arena);
+   size = (size + ALIGN - 1) / ALIGN * ALIGN;
+   if (arena->size + size > arena->cap) {
+      while (arena->size + size > arena->cap)
+         arena->cap *= 2;
+      arena->data = realloc(arena->data, arena->cap);
+      assert(arena->data);
+   }
+   size_t offset = arena->size;
+   memset(arena->data + offset, 0, size);
+   arena->size += size;
+   return offset;
+}
+
+void* arena_at(arena_t* arena, size_t offset) {
+   assert(arena && offset >= HEADER && offset < arena->size);
+   return arena->data + offset;
+}
+
+size_t arena_strdup(arena_t* arena, const char* str) {
+   assert(str);
+   size_t len = strlen(str) + 1;
+   size_t offset = arena_alloc(arena, len);
+   memcpy(arena->data + offset, str, len);
+   return offset;
+}
+
+void arena_link(arena_t* arena, size_t field, size_t target) {
+   assert(arena && field >= HEADER);
+   assert(field + sizeof(void*) <= arena->size && target < arena->size);
+   if (!target)
+      return;
+   *(uintptr_t*) (arena->data + field) = target;
+   arena->relocs = grow(arena->relocs, &arena->caprelocs,
+                        arena->nrelocs, sizeof(size_t));
+   arena->relocs[arena->nrelocs++] = field;
+}
+
+void arena_note(arena_t* arena, const void* original, size_t copy) {
+   assert(arena && original && copy >= HEADER);
+   arena->notes = grow(arena->notes, &arena->capnotes,
+                       arena->nnotes, sizeof(copy_t));
+   arena->notes[arena->nnotes].original = original;
+   arena->notes[arena->nnotes++].offset = copy;
+}
+
+void arena_link_copy(arena_t* arena, size_t field, const void* original) {
+   assert(arena && field >= HEADER);
+   if (!original)
+      return;
+   arena->pending = grow(arena->pending, &arena->cappending,
+                         arena->npending, sizeof(copy_t));
+   arena->pending[arena->npending].original = original;
+   arena->pending[arena->npending++].offset = field;
+}
+
+void arena_extern(arena_t* arena, size_t field, void* target) {
+   assert(arena && arena->local && field >= HEADER);
+   assert(field + sizeof(void*) <= arena->size && target);
+   *(void**) (arena->data + field) = target;
+   arena->externs = grow(arena->externs, &arena->capexterns,
+                         arena->nexterns, sizeof(void*));
+   arena->externs[arena->nexterns++] = target;
+}
+
+bool arena_local(arena_t* arena) {
+   assert(arena);
+   return arena->local;
+}
+
+void** arena_externs(arena_t* arena, size_t* n) {
+   assert(arena && n);
+   *n = arena->nexterns;
+   return arena->externs;
+}
+
+bool arena_write(arena_t* arena, size_t root, int fd) {
+   assert(arena && !arena->local && root >= HEADER && root < arena->size);
+   resolve(arena);
+   header_t* header = (header_t*) arena->data;
+   memcpy(header->magic, MAGIC, sizeof(header->magic));
+   header->version = VERSION;
+   header->order = ORDER;
+   header->ptrsize = sizeof(void*);
+   header->size = arena->size;
+   header->nrelocs = arena->nrelocs;
+   header->root = root;
+   return write_all(fd, arena->data, arena->size)
+       && write_all(fd, arena->relocs, arena->nrelocs * sizeof(size_t));
+}
+
+void* arena_finish(arena_t* arena, size_t root) {
+   assert(arena && root == HEADER && arena->size > HEADER);
+   resolve(arena);
+   char* block = malloc(arena->size - HEADER);
+   assert(block);
+   memcpy(block, arena->data + HEADER, arena->size - HEADER);
+   relocate(block, HEADER, arena->relocs, arena->nrelocs);
+   arena_free(arena);
+   return block;
+}
+
+size_t arena_size(arena_t* arena) {
+   assert(arena);
+   return arena->size;
+}
+
+void* arena_finish_at(arena_t* arena, size_t root, void* mem) {
+   assert(arena && !arena->local && mem);
+   assert(root >= HEADER && root < arena->size);
+   resolve(arena);
+   memcpy(mem, arena->data, arena->size);
+   relocate(mem, 0, arena->relocs, arena->nrelocs);
+   arena_free(arena);
+   return (char*) mem + root;
+}
+
+void* image_read(int fd, void** block) {
+   assert(block);
+   struct stat st;
+   if (fstat(fd, &st) < 0 || (size_t) st.st_size < HEADER)
+      return NULL;
+   char* data = malloc(st.st_size);
+   assert(data);
+   size_t got = 0;
+   while (got < (size_t) st.st_size) {
+      ssize_t n = read(fd, data + got, st.st_size - got);
+      if (n <= 0)
+         break;
+      got += n;
+   }
+
+   header_t* header = (header_t*) data;
+   if (got != (size_t) st.st_size
+           || memcmp(header->magic, MAGIC, sizeof(header->magic)) != 0
+           || header->version != VERSION || header->order != ORDER
+           || header->ptrsize != sizeof(void*)
+           || header->size < HEADER || header->size % ALIGN != 0
+           || header->size + header->nrelocs * sizeof(size_t) != got
+           || header->root < HEADER || header->root >= header->size) {
+      free(data);
+      return NULL;
+   }
+   size_t* relocs = (size_t*) (data + header->size);
+   for (size_t i = 0; i < header->nrelocs; ++i) {
+      if (relocs[i] < HEADER || relocs[i] % sizeof(void*) != 0
+               || relocs[i] + sizeof(void*) > header->size) {
+         free(data);
+         return NULL;
+      }
+      uintptr_t target = *(uintptr_t*) (data + relocs[i]);
+      if (target < HEADER || target >= header->size) {
+         free(data);
+         return NULL;
+      }
+   }
+   relocate(data, 0, relocs, header->nrelocs);
+   *block = data;
+   return data + header->root;
+}
+
+arena_t* arena_new(bool local) {
+   arena_t* arena = calloc(1, sizeof(arena_t));
+   assert(arena);
+   arena->local = local;
+   arena->cap = DEFCAP;
+   arena->data = calloc(arena->cap, 1);
+   assert(arena->data);
+   arena->size = HEADER;
+   return arena;
+}
+
+void arena_free(arena_t* arena) {
+   if (arena) {
+      free(arena->data);
+      free(arena->relocs);
+      free(arena->notes);
+      free(arena->pending);
+      free(arena->externs);
+      free(arena);
+   }
+}
+
+/********************************************************************/
@@ -0,0 +1,153 @@
+/* arena.h
+ *
+ * Builder for position-independent images of linked structures.
+ * Objects are copied into one growing block, and everything about
+ * the copy is expressed as an offset from the beginning of the
+ * block: allocations return offsets, and a pointer field is filled
+ * in by giving the offset of the field and the offset of its target.
+ * The arena keeps a list of every pointer field, so that a finished
+ * block can be written to a file as it is and turned back into real
+ * pointers wherever it's loaded, by adding the block's address to
+ * each field on the list.
+ *
+ * Offset zero holds the image header, so zero is never the offset of
+ * an object and can stand for NULL.
+ *
+ * A local arena is only ever finished with arena_finish, for use in
+ * the process that built it. Its objects may also point at objects
+ * outside of it, which an image can't.
+ */
+
+#ifndef __regex_arena
+#define __regex_arena
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct _arena arena_t;
+
+/** alloc
+  *
+  * Allocate zeroed space for an object in the arena, aligned for any
+  * type. Return its offset. Pointers into the arena are invalidated
+  * by the next allocation, so hold on to offsets instead.
+  */
+size_t arena_alloc(arena_t*, size_t);
+
+/** at
+  *
+  * Get a pointer to the object at an offset. Only valid until the
+  * next allocation.
+  */
+void* arena_at(arena_t*, size_t);
+
+/** strdup
+  *
+  * Copy a string into the arena and return its offset.
+  */
+size_t arena_strdup(arena_t*, const char*);
+
+/** link
+  *
+  * Make the pointer field at the first offset point at the object at
+  * the second offset. A target of zero leaves the field NULL.
+  */
+void arena_link(arena_t*, size_t field, size_t target);
+
+/** note
+  *
+  * Record that the object at the given offset is the copy of the
+  * given original object, for arena_link_copy.
+  */
+void arena_note(arena_t*, const void* original, size_t copy);
+
+/** link_copy
+  *
+  * Make the pointer field at the given offset point at the copy of
+  * an original object. The copy doesn't have to exist yet; links to
+  * copies are resolved when the arena is finished, and the copy must
+  * have been noted by then. Used for pointers that don't own what
+  * they point to, like cross links within a tree.
+  */
+void arena_link_copy(arena_t*, size_t field, const void* original);
+
+/** extern
+  *
+  * Make the pointer field at the given offset of a local arena point
+  * at an object outside the arena. The arena keeps a list of these
+  * objects, so whoever owns the finished block can let go of them.
+  */
+void arena_extern(arena_t*, size_t field, void* target);
+
+/** local
+  *
+  * Check if the arena is local.
+  */
+bool arena_local(arena_t*);
+
+/** externs
+  *
+  * Get the objects outside the arena that it points at, in the order
+  * they were linked, and set the size_t to how many there are. The
+  * list belongs to the arena.
+  */
+void** arena_externs(arena_t*, size_t*);
+
+/** write
+  *
+  * Finish the arena and write it to a file descriptor as a relocatable
+  * image whose root object is at the given offset. The arena can't be
+  * local. Return false and
+  * set errno if the write fails.
+  */
+bool arena_write(arena_t*, size_t root, int fd);
+
+/** finish
+  *
+  * Finish the arena and move it into a single allocation, with every
+  * pointer field pointing into that allocation. Return the root
+  * object; the whole block is freed by calling free on the root, which
+  * must be at the first allocated offset. The arena is freed.
+  */
+void* arena_finish(arena_t*, size_t root);
+
+/** size
+  *
+  * Get the number of bytes the finished block will take up, header
+  * included.
+  */
+size_t arena_size(arena_t*);
+
+/** finish_at
+  *
+  * Finish the arena into memory the caller provides, which must be
+  * aligned like malloc'd memory and at least arena_size bytes long.
+  * The arena can't be local.
+  * Every pointer field is made to point into that memory. Return the
+  * root object. The arena is freed.
+  */
+void* arena_finish_at(arena_t*, size_t root, void* mem);
+
+/** image_read
+  *
+  * Read an image written by arena_write from a file descriptor with a
+  * single read, and relocate it to wherever it landed. Return the
+  * root object, and set *block to the allocation to free when the
+  * image is no longer used. Return NULL if the file can't be read,
+  * or if it isn't an image written by a build with the same layout.
+  */
+void* image_read(int fd, void** block);
+
+/** new
+  *
+  * Create an empty arena, which is local if the bool is true.
+  */
+arena_t* arena_new(bool local);
+
+/** free
+  *
+  * Deallocate an arena that wasn't finished.
+  */
+void arena_free(arena_t*);
+
+#endif
@@ -6,35 +6,15 @@
 
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "atom.h"
 #include "util.h"
 #include "u8_translate.h"
+#include "shorthand.h"
+#include "stats.h"
 
 
-/* enum info
- *
- * Keep track of various information about an atom. 
- */
-typedef enum {
-
-   // atom types
-   Uninitialized   = 1 << 31,
-   Class           = 1 << 30,
-   String          = 1 << 29,
-   Group           = 1 << 28,
-   Atomic          = 1 << 27,
-   Backreference   = 1 << 26,
-   Subroutine      = 1 << 25,
-   LookAhead       = 1 << 24,
-   WordAnchor      = 1 << 23,
-   EdgeAnchor      = 1 << 22,
-   
-   // atom attributes
-   Invert          = 2,
-   Greedy          = 1
-} atom_info;
-
 /* atom_info macros
  *
  * Used for accessing atom_info from an int. The 24 bits on the left
@@ -57,6 +37,13 @@ typedef enum {
   */
 #define GetType(INFO) (atom_info) (INFO & ~0xFF)
 
+/** TypeNumber
+  *
+  * Number the atom types from zero, starting with Class, for counting
+  * them in the stats.
+  */
+#define TypeNumber(TYPE) (30 - __builtin_ctz(TYPE))
+
 /** TestOpt
   *
   * Check whether an option is set.
@@ -78,7 +65,7 @@ struct _reg_atom {
    int index;
    int info;
    union {
-      class_t* class;
+      charset_t* class;
       char*    string;
       core_t*  group;
       int      index;
@@ -86,19 +73,38 @@ struct _reg_atom {
    urange32_t  range;
 };
 
-char* trash;   // nothing
-
 /****************************single matches**************************/
 
+__thread bool atom_read_end = false;
+
+/** ReadEnd
+  *
+  * Note that a match has read the end of its input.
+  */
+#define ReadEnd() (atom_read_end = true)
+
 /** match_string
   *
   * Match the string against string in atom->data.string.
   */
 static char* match_string(atom_t* atom, char* str) {
    char* match = atom->data.string;
+   if (TestOpt(atom->info, Caseless)) {
+      while (*match != '\0') {
+         if (ascii_lower[(unsigned char) *str++] != (unsigned char) *match++) {
+            if (str[-1] == '\0')
+               ReadEnd();
+            return NULL;
+         }
+      }
+      return str;
+   }
    while (*match != '\0') {
-      if (*str++ != *match++)
+      if (*str++ != *match++) {
+         if (str[-1] == '\0')
+            ReadEnd();
          return NULL;
+      }
    }
    return str;
 }
@@ -113,8 +119,10 @@ static char* match_reference(atom_t* atom, char* str, range_t* gr) {
    if (!begin)
       return NULL;
    while (begin != end) {
-      if (*str == '\0')
+      if (*str == '\0') {
+         ReadEnd();
          return NULL;
+      }
       if (*begin++ != *str++)
          return NULL;
    }
@@ -127,13 +135,20 @@ static char* match_reference(atom_t* atom, char* str, range_t* gr) {
 /** match_class
   *
   * Do a single match for the tree case, which just involves testing
-  * a single character against a class.
+  * a single character against a class. A character that the end of
+  * the input cuts off doesn't match.
   */
 static char* match_class(atom_t* atom, char* str) {
    u8cdpnt_t* cp = u8_decode(str);
-   str = u8_end(cp);
-   bool isel = class_search(atom->data.class, u8_deref(cp));
+   char* end = u8_end(cp);
+   uint32_t codepoint = u8_deref(cp);
    free(cp);
+   if (codepoint == ErrorPoint && memchr(str, '\0', end - str)) {
+      ReadEnd();
+      return NULL;
+   }
+   str = end;
+   bool isel = charset_has(atom->data.class, codepoint);
    if (isel)
       return TRUe;
    return FALSe;
@@ -145,24 +160,37 @@ static char* match_class(atom_t* atom, char* str) {
   */
 static char* match_lookahead(atom_t* atom, char* str,
                                           range_t* gr, char* head) {
+   char* end;
+   StatCount(lookaheads);
    gr = core_match(atom->data.group, str,
-                            NULL, gr, NULL, 0, &trash, head);
+                            NULL, gr, NULL, 0, &end, head);
    if (gr) {
       return TRUe;
    }
    return FALSe;
 }
 
+/** is_word
+  *
+  * Check whether a byte is a word character, which is one of the
+  * characters in '[a-zA-Z0-9_]'.
+  */
+static inline bool is_word(char c) {
+   return word_bytes[(unsigned char) c];
+}
+
 /** match_wordanchor
   *
   * Match the empty string at the border of a word character and a non
   * word character.
   */
 static char* match_wordanchor(atom_t* atom, char* str, char* head) {
-   bool curr_is_word = class_search(word_characters, *str);
-   bool prev_is_word = class_search(word_characters, *(str-1));
+   bool curr_is_word = is_word(*str);
+   bool prev_is_word = str != head && is_word(str[-1]);
    bool curr_is_head =  str == head;
    bool curr_is_end  = *str == '\0';
+   if (curr_is_end)
+      ReadEnd();
    if (curr_is_head && curr_is_end)
       return FALSe;
    if (curr_is_head) {
@@ -189,7 +217,10 @@ static char* match_wordanchor(atom_t* atom, char* str, char* head) {
 static char* match_edgeanchor(atom_t* atom, char* str, char* head) {
    if (TestOpt(atom->info, Invert))
       return str == head ? str : NULL;
-   return *str == '\0' ? str : NULL;
+   if (*str != '\0')
+      return NULL;
+   ReadEnd();
+   return str;
 }
 
 /** match_subroutine
@@ -203,6 +234,7 @@ static char* match_subroutine(atom_t* atom,   uint32_t matches,
                               int nbr,        char* head,
                                               range_t* nest) {
    char* end = NULL;
+   StatCount(groups);
    if (!nest)
       nest = range_copy(gr);
    range_t* temp = nest;
@@ -229,6 +261,7 @@ static char* match_subroutine(atom_t* atom,   uint32_t matches,
 static char* match_atomic(atom_t* atom, char* str,
                                           range_t* gr, char* head) {
    char* end;
+   StatCount(groups);
    gr = core_match(atom->data.group, str,
                               NULL, gr, NULL, 0, &end, head);
    if (!gr)
@@ -246,6 +279,7 @@ static char* match_group(atom_t* atom,    uint32_t matches,
                          bts_t* stack,   bts_t* inner,
                          int nbr,        char* head) {
    char* end = NULL;
+   StatCount(groups);
    gr = core_match(atom->data.group, str,
                     stack, gr, inner, nbr, &end, head);
    if (!gr)
@@ -306,8 +340,12 @@ static void greedy_match(atom_t* atom, bts_t* stack,
       if (matches >= atom->range.lo && matches <= atom->range.hi) {
          bts_push(stack, atom->index + 1, str, 0, false, NULL, 0);
       }
-      if (matches >= atom->range.hi || *str == '\0')
+      if (matches >= atom->range.hi)
          break;
+      if (*str == '\0') {
+         ReadEnd();
+         break;
+      }
       DoMatch(GetType(atom->info));
       if (!str)
          break;
@@ -334,8 +372,12 @@ static void lazy_match(atom_t* atom, bts_t* stack,
    range_t*   nest       = top->nest;
    bts_pop(stack);
    for (;; ++matches) {
-      if (matches > atom->range.hi || *str == '\0')
+      if (matches > atom->range.hi)
+         break;
+      if (*str == '\0') {
+         ReadEnd();
          break;
+      }
       char* temp = str;
       if (matches != atom->range.hi)
          DoMatch(GetType(atom->info));
@@ -376,6 +418,7 @@ void atom_match(atom_t* atom, bts_t* stack,
    state_t* top = bts_top(stack);
    char* str = top->str;
    assert(GetType(atom->info) != Uninitialized);
+   StatCount(atoms[TypeNumber(GetType(atom->info))]);
    
    // cases that can't involve ranges
    switch (GetType(atom->info)) {
@@ -400,7 +443,7 @@ void atom_match(atom_t* atom, bts_t* stack,
 
 /**************************atom operations**************************/
 
-void atom_set_class(atom_t* atom, class_t* that) {
+void atom_set_class(atom_t* atom, charset_t* that) {
    assert(atom);
    assert(that);
    assert(GetType(atom->info) == Uninitialized);
@@ -416,6 +459,12 @@ void atom_set_string(atom_t* atom, char* that) {
    atom->data.string = that;
 }
 
+void atom_set_caseless(atom_t* atom, bool val) {
+   assert(atom);
+   assert(GetType(atom->info) == String);
+   SetOpt(atom->info, Caseless, val);
+}
+
 void atom_set_core(atom_t* atom, core_t* that, int flag) {
    assert(atom);
    assert(that);
@@ -485,22 +534,115 @@ core_t* atom_find_core(atom_t* atom, int index) {
    return core_find_core(atom->data.group, index);
 }
 
+atom_info atom_type(atom_t* atom) {
+   assert(atom);
+   return GetType(atom->info);
+}
+
+char* atom_string(atom_t* atom) {
+   assert(atom);
+   return GetType(atom->info) == String ? atom->data.string : NULL;
+}
+
+bool atom_caseless(atom_t* atom) {
+   assert(atom);
+   return TestOpt(atom->info, Caseless);
+}
+
+charset_t* atom_class(atom_t* atom) {
+   assert(atom);
+   return GetType(atom->info) == Class ? atom->data.class : NULL;
+}
+
+bool atom_invert(atom_t* atom) {
+   assert(atom);
+   return TestOpt(atom->info, Invert);
+}
+
+core_t* atom_group(atom_t* atom) {
+   assert(atom);
+   return atom_has_group(atom) ? atom->data.group : NULL;
+}
+
+urange32_t atom_get_range(atom_t* atom) {
+   assert(atom);
+   return atom->range;
+}
+
 atom_t* atom_new(int index) {
    atom_t* atom = malloc(sizeof(atom_t));
    assert(atom);
    atom->index = index;
-   SetType(atom->info, Uninitialized);
+   atom->info = Uninitialized;
    atom->range.lo = 1;
    atom->range.hi = 1;
    SetOpt(atom->info, Greedy, true);
    return atom;
 }
 
+size_t atom_bytes(atom_t* atom) {
+   assert(atom);
+   size_t bytes = sizeof(atom_t);
+   switch (GetType(atom->info)) {
+      case Class:
+         bytes += charset_bytes(atom->data.class);
+         break;
+      case String:
+         bytes += strlen(atom->data.string) + 1;
+         break;
+      case Group: case Atomic: case LookAhead: //case LookBehind:
+         bytes += core_bytes(atom->data.group);
+         break;
+      default:
+         break;
+   }
+   return bytes;
+}
+
+size_t atom_pack(atom_t** atoms, int n, arena_t* arena) {
+   assert(atoms && n > 0);
+   size_t at = arena_alloc(arena, n * (sizeof(atom_t*) + sizeof(atom_t)));
+   size_t first = at + n * sizeof(atom_t*);
+   for (int i = 0; i < n; ++i) {
+      size_t copy = first + i * sizeof(atom_t);
+      *(atom_t*) arena_at(arena, copy) = *atoms[i];
+      arena_link(arena, at + i * sizeof(atom_t*), copy);
+   }
+
+   // what the atoms point to goes after all of them, so that matching
+   //   a branch walks one run of memory
+   for (int i = 0; i < n; ++i) {
+      atom_t* atom = atoms[i];
+      size_t copy = first + i * sizeof(atom_t);
+      size_t data = copy + offsetof(atom_t, data);
+      switch (GetType(atom->info)) {
+         case Class:
+            charset_pack(atom->data.class, arena, data);
+            break;
+         case String:
+            ((atom_t*) arena_at(arena, copy))->data.string = NULL;
+            arena_link(arena, data, arena_strdup(arena, atom->data.string));
+            break;
+         case Group: case Atomic: case LookAhead: //case LookBehind:
+            ((atom_t*) arena_at(arena, copy))->data.group = NULL;
+            arena_link(arena, data, core_pack(atom->data.group, arena));
+            break;
+         case Subroutine:
+            ((atom_t*) arena_at(arena, copy))->data.group = NULL;
+            arena_link_copy(arena, data, atom->data.group);
+            break;
+         default:
+            break;
+      }
+   }
+   return at;
+}
+
 void atom_free(atom_t* atom) {
    if (atom) {
       switch (GetType(atom->info)) {
          case Class:
-            class_free(atom->data.class);
+            charset_release(atom->data.class);
             break;
          case String:
             free(atom->data.string);
@@ -11,17 +11,39 @@
 typedef struct _reg_atom atom_t;
 
 #include <stdbool.h>
-#include "class.h"
+#include <stddef.h>
+#include "charset.h"
 #include "bts.h"
 #include "core.h"
+#include "arena.h"
+
+/* enum info
+ *
+ * Keep track of various information about an atom. 
+ */
+typedef enum {
+
+   // atom types
+   Uninitialized   = 1 << 31,
+   Class           = 1 << 30,
+   String          = 1 << 29,
+   Group           = 1 << 28,
+   Atomic          = 1 << 27,
+   Backreference   = 1 << 26,
+   Subroutine      = 1 << 25,
+   LookAhead       = 1 << 24,
+   WordAnchor      = 1 << 23,
+   EdgeAnchor      = 1 << 22,
+   
+   // atom attributes
+   Caseless        = 4,
+   Invert          = 2,
+   Greedy          = 1
+} atom_info;
 
 // maximum number of repetitions
 #define MAXREPS 1000000000
 
-// used by the matching logic to implement word anchors
-extern class_t* word_characters;
-
-
 /** match
   *
   * Do a match for a single atom of the regular expression, possibly
@@ -29,15 +51,24 @@ extern class_t* word_characters;
   */
 void atom_match(atom_t*, bts_t*, range_t*, char*);
 
+/** read_end
+  *
+  * Set by a match that reads the null character at the end of its
+  * input, which is when its result could change if the input went
+  * on. The matcher never clears it: a caller that wants to know
+  * whether a search read the end clears it first.
+  */
+extern __thread bool atom_read_end;
+
 /** give_set
   *
-  * "Gives" a tree to the atom in the sense that the atom now owns
-  * the tree and is responsible for freeing it. A tree in a atom is
-  * used to denote a tree of characters that are accepted by the atom,
-  * so that a atom can test whether it accepts a particular character
-  * in constant time.
+  * "Gives" a charset reference to the atom in the sense that the
+  * atom now owns the reference and is responsible for releasing it.
+  * A charset in a atom is used to denote the characters that are
+  * accepted by the atom, so that a atom can test whether it accepts a
+  * particular character in constant time.
   */
-void atom_set_class(atom_t*, class_t*);
+void atom_set_class(atom_t*, charset_t*);
 
 /** give_string
   *
@@ -46,6 +77,13 @@ void atom_set_class(atom_t*, class_t*);
   */
 void atom_set_string(atom_t*, char*);
 
+/** set_caseless
+  *
+  * Make a string atom ignore the case of ascii letters. The letters
+  * of the atom's string must be small letters.
+  */
+void atom_set_caseless(atom_t*, bool);
+
 /** give_core
   *
   * Give atom possession of a nested core. This construct is used to
@@ -114,6 +152,72 @@ int atom_highest_index(atom_t*);
   */
 core_t* atom_find_core(atom_t*, int);
 
+//
+// used to analyze a finished core
+//
+
+/** type
+  *
+  * Get the type of the atom; one of the atom type flags above.
+  */
+atom_info atom_type(atom_t*);
+
+/** string
+  *
+  * Get the literal held by a string atom, or NULL if the atom isn't
+  * a string atom.
+  */
+char* atom_string(atom_t*);
+
+/** caseless
+  *
+  * Check whether a string atom ignores the case of ascii letters.
+  */
+bool atom_caseless(atom_t*);
+
+/** class
+  *
+  * Get the charset of a class atom, or NULL if the atom isn't a
+  * class atom.
+  */
+charset_t* atom_class(atom_t*);
+
+/** invert
+  *
+  * Check whether the atom is inverted; see atom_set_invert.
+  */
+bool atom_invert(atom_t*);
+
+/** group
+  *
+  * Get the nested core of a group, atomic group or lookahead atom, or
+  * NULL if the atom doesn't hold a nested core.
+  */
+core_t* atom_group(atom_t*);
+
+/** get_range
+  *
+  * Get the minimum and maximum number of repetitions of the atom.
+  */
+urange32_t atom_get_range(atom_t*);
+
+/** bytes
+  *
+  * Get the number of bytes of memory used by the atom and anything it
+  * points to.
+  */
+size_t atom_bytes(atom_t*);
+
+/** pack
+  *
+  * Copy a sequence of atoms and anything they point to into an arena.
+  * Return the offset of an array of pointers to the copies, which is
+  * followed by the copies themselves, side by side. A subroutine call
+  * is linked to the copy of the core that it calls, which must be
+  * packed into the same arena.
+  */
+size_t atom_pack(atom_t**, int, arena_t*);
+
 /** new
   *
   * Create a new atom.
@@ -0,0 +1,1005 @@
+/* regex benchmark program
+ *
+ * Time a suite of patterns against generated and checked-in corpora.
+ *
+ *    regex-bench [-x] [-s megabytes] [-d corpus-dir] [suite...]
+ *
+ * The suites are:
+ *
+ *    redux      the patterns of the regex-redux benchmark, against a
+ *               DNA sequence made the way its fasta program makes it
+ *    mariomka   email, URI and IP address patterns, against text
+ *               with some of each mixed in
+ *    log        patterns for picking lines out of logs, against the
+ *               checked-in corpus/app.log, repeated
+ *    redos      patterns that take exponential time in a
+ *               backtracking engine, against short inputs that grow
+ *
+ * For each pattern, the time to compile it is measured, and then the
+ * time to search the corpus with 'shre_search' and 'quick_search' on
+ * every line, and with 'scan_next' over the whole corpus. Each result
+ * is printed as a line of JSON with the throughput in megabytes per
+ * second, the matches found per second, and the number of calls to
+ * malloc, calloc and realloc for each match.
+ *
+ * With -x, the patterns are instead run through glibc's regcomp and
+ * regexec, and through PCRE2 if the program was built with it, and
+ * every match each of them finds in the corpus is checked against
+ * the ones shre finds. Each engine gets a line of JSON saying if it
+ * agrees, where it first doesn't, and how its throughput compares to
+ * shre's. POSIX engines take the leftmost longest match, where shre
+ * takes the first alternative that matches, so an alternation like
+ * 'a|ab' can disagree without either engine being wrong. Shorthand
+ * classes and the like are rewritten in POSIX syntax; patterns with
+ * syntax POSIX has no way to say are reported as unsupported.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include <time.h>
+#include <regex.h>
+#ifdef HAVE_PCRE2
+#define PCRE2_CODE_UNIT_WIDTH 8
+#include <pcre2.h>
+#endif
+#include "shre.h"
+#include "shre_errno.h"
+
+// Each measurement runs for at least this many seconds.
+#define MINTIME 0.2
+
+// Each pattern is compiled this many times.
+#define COMPILES 200
+
+// Set by -x: check the matches against other engines instead of
+//   measuring the search functions.
+static bool differential = false;
+
+/*******************************allocations*************************/
+
+// Allocations are counted by replacing the allocator's entry points
+//   with ones that count the calls and pass them on to glibc.
+extern void* __libc_malloc(size_t);
+extern void* __libc_calloc(size_t, size_t);
+extern void* __libc_realloc(void*, size_t);
+
+static long allocations = 0;
+
+void* malloc(size_t size) {
+   __atomic_add_fetch(&allocations, 1, __ATOMIC_RELAXED);
+   return __libc_malloc(size);
+}
+
+void* calloc(size_t n, size_t size) {
+   __atomic_add_fetch(&allocations, 1, __ATOMIC_RELAXED);
+   return __libc_calloc(n, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+   __atomic_add_fetch(&allocations, 1, __ATOMIC_RELAXED);
+   return __libc_realloc(ptr, size);
+}
+
+/*********************************corpora****************************/
+
+/* corpus
+ *
+ * Input to search: the whole text, and a copy of it split into null
+ * terminated lines.
+ */
+typedef struct {
+   const char* name;
+   char* text;
+   size_t len;
+   char* copy;
+   char** lines;
+   size_t nlines;
+} corpus_t;
+
+/* buffer
+ *
+ * Text being generated.
+ */
+typedef struct {
+   char* text;
+   size_t len;
+   size_t cap;
+} buffer_t;
+
+/** append
+  *
+  * Add bytes to the end of a buffer.
+  */
+static void append(buffer_t* buf, const char* str, size_t len) {
+   if (buf->len + len + 1 > buf->cap) {
+      while (buf->len + len + 1 > buf->cap)
+         buf->cap = buf->cap ? buf->cap * 2 : 1 << 16;
+      buf->text = realloc(buf->text, buf->cap);
+      assert(buf->text);
+   }
+   memcpy(buf->text + buf->len, str, len);
+   buf->len += len;
+   buf->text[buf->len] = '\0';
+}
+
+/** append_str
+  *
+  * Add a null terminated string to the end of a buffer.
+  */
+static void append_str(buffer_t* buf, const char* str) {
+   append(buf, str, strlen(str));
+}
+
+/** split
+  *
+  * Make a corpus from generated text.
+  */
+static corpus_t split(const char* name, buffer_t* buf) {
+   corpus_t corpus = { name, buf->text, buf->len, NULL, NULL, 0 };
+   corpus.copy = malloc(buf->len + 1);
+   assert(corpus.copy);
+   memcpy(corpus.copy, buf->text, buf->len + 1);
+   size_t cap = 1024;
+   corpus.lines = malloc(cap * sizeof(char*));
+   assert(corpus.lines);
+   for (char* line = corpus.copy; *line; ) {
+      if (corpus.nlines == cap) {
+         cap *= 2;
+         corpus.lines = realloc(corpus.lines, cap * sizeof(char*));
+         assert(corpus.lines);
+      }
+      corpus.lines[corpus.nlines++] = line;
+      char* nl = strchr(line, '\n');
+      if (!nl)
+         break;
+      *nl = '\0';
+      line = nl + 1;
+   }
+   return corpus;
+}
+
+/** corpus_free
+  *
+  * Deallocate a corpus.
+  */
+static void corpus_free(corpus_t* corpus) {
+   free(corpus->text);
+   free(corpus->copy);
+   free(corpus->lines);
+}
+
+// The random numbers and tables of the fasta benchmark program.
+static unsigned long fasta_seed = 42;
+
+static double fasta_random() {
+   fasta_seed = (fasta_seed * 3877 + 29573) % 139968;
+   return fasta_seed / 139968.0;
+}
+
+static const char alu[] =
+   "GGCCGGGCGCGGTGGCTCACGCCTGTAATCCCAGCACTTTGG"
+   "GAGGCCGAGGCGGGCGGATCACCTGAGGTCAGGAGTTCGAGA"
+   "CCAGCCTGGCCAACATGGTGAAACCCCGTCTCTACTAAAAAT"
+   "ACAAAAATTAGCCGGGCGTGGTGGCGCGCGCCTGTAATCCCA"
+   "GCTACTCGGGAGGCTGAGGCAGGAGAATCGCTTGAACCCGGG"
+   "AGGCGGAGGTTGCAGTGAGCCGAGATCGCGCCACTGCACTCC"
+   "AGCCTGGGCGACAGAGCGAGACTCCGTCTCAAAAA";
+
+typedef struct {
+   char c;
+   double p;
+} frequency_t;
+
+static const frequency_t iub[] = {
+   { 'a', 0.27 }, { 'c', 0.12 }, { 'g', 0.12 }, { 't', 0.27 },
+   { 'B', 0.02 }, { 'D', 0.02 }, { 'H', 0.02 }, { 'K', 0.02 },
+   { 'M', 0.02 }, { 'N', 0.02 }, { 'R', 0.02 }, { 'S', 0.02 },
+   { 'V', 0.02 }, { 'W', 0.02 }, { 'Y', 0.02 }
+};
+
+static const frequency_t homosapiens[] = {
+   { 'a', 0.3029549426680 }, { 'c', 0.1979883004921 },
+   { 'g', 0.1975473066391 }, { 't', 0.3015094502008 }
+};
+
+/** fasta_random_lines
+  *
+  * Add n random nucleotides to a buffer, in lines of 60.
+  */
+static void fasta_random_lines(buffer_t* buf, const frequency_t* table,
+                                                int ntable, size_t n) {
+   char line[61];
+   while (n) {
+      size_t len = n < 60 ? n : 60;
+      for (size_t i = 0; i < len; ++i) {
+         double r = fasta_random(), sum = 0;
+         int k = 0;
+         while (k < ntable - 1 && (sum += table[k].p) < r)
+            ++k;
+         line[i] = table[k].c;
+      }
+      line[len] = '\n';
+      append(buf, line, len + 1);
+      n -= len;
+   }
+}
+
+/** make_dna
+  *
+  * Make the input of regex-redux, which is the output of the fasta
+  * program for a given number of nucleotides.
+  */
+static corpus_t make_dna(size_t bytes) {
+   buffer_t buf = { NULL, 0, 0 };
+   size_t n = bytes / 10;
+   append_str(&buf, ">ONE Homo sapiens alu\n");
+   size_t len = strlen(alu);
+   for (size_t i = 0; i < 2 * n; i += 60) {
+      char line[61];
+      size_t k = 2 * n - i < 60 ? 2 * n - i : 60;
+      for (size_t j = 0; j < k; ++j)
+         line[j] = alu[(i + j) % len];
+      line[k] = '\n';
+      append(&buf, line, k + 1);
+   }
+   append_str(&buf, ">TWO IUB ambiguity codes\n");
+   fasta_random_lines(&buf, iub, 15, 3 * n);
+   append_str(&buf, ">THREE Homo sapiens frequency\n");
+   fasta_random_lines(&buf, homosapiens, 4, 5 * n);
+   return split("dna", &buf);
+}
+
+/** make_text
+  *
+  * Make text with email addresses, URIs and IP addresses in it, some
+  * of which aren't valid.
+  */
+static corpus_t make_text(size_t bytes) {
+   static const char* words[] = {
+      "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+      "lorem", "ipsum", "dolor", "sit", "amet", "server", "request",
+      "contact", "at", "or", "visit", "from", "address", "see"
+   };
+   static const char* names[] = {
+      "john.smith", "info", "a_b+tag", "support", "x", "first-last"
+   };
+   static const char* hosts[] = {
+      "example.com", "mail.example.org", "host", "sub.domain.co.uk",
+      "localhost", "a-b.io"
+   };
+   buffer_t buf = { NULL, 0, 0 };
+   srand(7);
+   char item[128];
+   int column = 0;
+   while (buf.len < bytes) {
+      int r = rand() % 100;
+      const char* host = hosts[rand() % 6];
+      if (r < 3) {
+         sprintf(item, "%s@%s", names[rand() % 6], host);
+      } else if (r < 6) {
+         sprintf(item, "%s://%s/%s/%d?q=%s#top",
+                 rand() % 2 ? "https" : "ftp", host,
+                 words[rand() % 22], rand() % 1000, words[rand() % 22]);
+      } else if (r < 9) {
+         sprintf(item, "%d.%d.%d.%d", rand() % 300, rand() % 256,
+                                      rand() % 256, rand() % 256);
+      } else {
+         strcpy(item, words[rand() % 22]);
+      }
+      column += strlen(item) + 1;
+      append_str(&buf, item);
+      append_str(&buf, column > 72 ? "\n" : " ");
+      if (column > 72)
+         column = 0;
+   }
+   return split("text", &buf);
+}
+
+/** make_log
+  *
+  * Make a corpus of the checked-in log, repeated.
+  */
+static corpus_t make_log(const char* dir, size_t bytes) {
+   char path[4096];
+   snprintf(path, sizeof(path), "%s/app.log", dir);
+   FILE* f = fopen(path, "r");
+   if (!f) {
+      fprintf(stderr, "regex-bench: cannot open %s\n", path);
+      exit(2);
+   }
+   buffer_t log = { NULL, 0, 0 };
+   char chunk[4096];
+   size_t got;
+   while ((got = fread(chunk, 1, sizeof(chunk), f)) > 0)
+      append(&log, chunk, got);
+   fclose(f);
+   buffer_t buf = { NULL, 0, 0 };
+   while (buf.len < bytes)
+      append(&buf, log.text, log.len);
+   free(log.text);
+   return split("log", &buf);
+}
+
+/** make_repeat
+  *
+  * Make a corpus of one line: a string repeated n times, then a
+  * string at the end.
+  */
+static corpus_t make_repeat(const char* unit, int n, const char* end) {
+   buffer_t buf = { NULL, 0, 0 };
+   for (int i = 0; i < n; ++i)
+      append_str(&buf, unit);
+   append_str(&buf, end);
+   return split("repeat", &buf);
+}
+
+/********************************measuring***************************/
+
+/* measurement
+ *
+ * The result of running a search until enough time has passed.
+ */
+typedef struct {
+   double seconds;   // for one run
+   long matches;     // found by one run
+   long allocs;      // made by one run
+} measure_t;
+
+typedef long (*run_f)(pattern_t*, const char*, corpus_t*);
+
+static double now() {
+   struct timespec t;
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/** run_search
+  *
+  * Search each line of a corpus with shre_search. Return the number
+  * of lines that match.
+  */
+static long run_search(pattern_t* pattern, const char* regex,
+                                           corpus_t* corpus) {
+   (void) regex;
+   long found = 0;
+   for (size_t i = 0; i < corpus->nlines; ++i) {
+      match_t* match = shre_search(pattern, corpus->lines[i]);
+      if (match) {
+         ++found;
+         match_free(match);
+      }
+   }
+   return found;
+}
+
+/** run_quick
+  *
+  * Search each line of a corpus with quick_search.
+  */
+static long run_quick(pattern_t* pattern, const char* regex,
+                                          corpus_t* corpus) {
+   (void) pattern;
+   long found = 0;
+   for (size_t i = 0; i < corpus->nlines; ++i)
+      found += quick_search((char*) regex, corpus->lines[i]);
+   return found;
+}
+
+/** run_scan
+  *
+  * Find every match in the whole corpus with scan_next.
+  */
+static long run_scan(pattern_t* pattern, const char* regex,
+                                         corpus_t* corpus) {
+   (void) regex;
+   long found = 0;
+   scanner_t* sc = scan_new(pattern, corpus->text);
+   match_t* match;
+   while ((match = scan_next(sc))) {
+      ++found;
+      bool last = match_offset(match) == corpus->len;
+      match_free(match);
+      if (last)
+         break;
+   }
+   free(sc);
+   return found;
+}
+
+/** measure
+  *
+  * Run a search once, then enough more times to take MINTIME seconds,
+  * and give the time, matches and allocations of one run.
+  */
+static measure_t measure(run_f run, pattern_t* pattern, const char* regex,
+                                                    corpus_t* corpus) {
+   measure_t m;
+   long before = allocations;
+   double start = now();
+   m.matches = run(pattern, regex, corpus);
+   m.seconds = now() - start;
+   m.allocs = allocations - before;
+   if (m.seconds < MINTIME) {
+      int reps = 0;
+      start = now();
+      do {
+         run(pattern, regex, corpus);
+         ++reps;
+      } while (now() - start < MINTIME);
+      m.seconds = (now() - start) / reps;
+   }
+   return m;
+}
+
+/** compile_time
+  *
+  * Get the seconds it takes to compile a regular expression, without
+  * the cache: each compile is on an engine of its own.
+  */
+static double compile_time(const char* regex) {
+   double start = now();
+   for (int i = 0; i < COMPILES; ++i) {
+      engine_t* engine = engine_new();
+      engine_compile(engine, (char*) regex);
+      engine_free(engine);
+   }
+   return (now() - start) / COMPILES;
+}
+
+/** print_string
+  *
+  * Print a string as a JSON string.
+  */
+static void print_string(const char* str) {
+   putchar('"');
+   for (const unsigned char* u = (const unsigned char*) str; *u; ++u) {
+      if (*u == '"' || *u == '\\')
+         printf("\\%c", *u);
+      else if (*u < 0x20)
+         printf("\\u%04x", *u);
+      else
+         putchar(*u);
+   }
+   putchar('"');
+}
+
+/** report
+  *
+  * Print the result of a measurement as a line of JSON.
+  */
+static void report(const char* suite, const char* regex, corpus_t* corpus,
+                   const char* api, double compile, measure_t m) {
+   printf("{\"suite\":");
+   print_string(suite);
+   printf(",\"pattern\":");
+   print_string(regex);
+   printf(",\"corpus\":\"%s\",\"bytes\":%zu,\"api\":\"%s\"",
+          corpus->name, corpus->len, api);
+   printf(",\"compile_us\":%.3f,\"seconds\":%.9f,\"mb_per_s\":%.2f",
+          compile * 1e6, m.seconds, corpus->len / 1e6 / m.seconds);
+   printf(",\"matches\":%ld,\"matches_per_s\":%.0f", m.matches,
+          m.matches / m.seconds);
+   if (m.matches)
+      printf(",\"allocs_per_match\":%.3f}\n",
+             (double) m.allocs / m.matches);
+   else
+      printf(",\"allocs_per_match\":null}\n");
+   fflush(stdout);
+}
+
+/** bench_pattern
+  *
+  * Measure one pattern against a corpus with each of the search
+  * functions.
+  */
+static void bench_pattern(const char* suite, const char* regex,
+                                             corpus_t* corpus) {
+   pattern_t* pattern = shre_compile((char*) regex);
+   if (!pattern) {
+      fprintf(stderr, "regex-bench: %s: %s\n", regex,
+                                      shre_strerror(shre_er));
+      return;
+   }
+   double compile = compile_time(regex);
+   report(suite, regex, corpus, "shre_search", compile,
+          measure(run_search, pattern, regex, corpus));
+   report(suite, regex, corpus, "quick_search", compile,
+          measure(run_quick, pattern, regex, corpus));
+   report(suite, regex, corpus, "scan_next", compile,
+          measure(run_scan, pattern, regex, corpus));
+}
+
+/*******************************differential*************************/
+
+/* spans
+ *
+ * Every match one engine found in a corpus, in order.
+ */
+typedef struct {
+   span_t* spans;
+   size_t n;
+   size_t cap;
+} spans_t;
+
+// Fills in the matches of a compiled pattern of some engine.
+typedef void (*collect_f)(void*, corpus_t*, spans_t*);
+
+/* engine
+ *
+ * Another engine that the results of shre are checked against. The
+ * compile function returns NULL if the engine doesn't support the
+ * pattern.
+ */
+typedef struct {
+   const char* name;
+   void* (*compile)(const char*);
+   collect_f collect;
+   void (*release)(void*);
+} other_t;
+
+static void add_span(spans_t* s, long begin, long end) {
+   if (s->n == s->cap) {
+      s->cap = s->cap ? s->cap * 2 : 256;
+      s->spans = realloc(s->spans, s->cap * sizeof(span_t));
+      assert(s->spans);
+   }
+   s->spans[s->n].begin = begin;
+   s->spans[s->n++].end = end;
+}
+
+/** collect_shre
+  *
+  * Find every match in the whole corpus with scan_next.
+  */
+static void collect_shre(void* pattern, corpus_t* corpus, spans_t* s) {
+   scanner_t* sc = scan_new(pattern, corpus->text);
+   match_t* match;
+   while ((match = scan_next(sc))) {
+      long begin = match_offset(match);
+      long end = begin + match_length(match);
+      match_free(match);
+      add_span(s, begin, end);
+      if (begin == (long) corpus->len)
+         break;
+   }
+   free(sc);
+}
+
+/** posix_class
+  *
+  * Give the POSIX bracket contents for a shorthand class, or NULL if
+  * it isn't one, and set *negated if it's the complement.
+  */
+static const char* posix_class(char c, bool* negated) {
+   *negated = c == 'D' || c == 'W' || c == 'S';
+   switch (c) {
+      case 'd': case 'D': return "0-9";
+      case 'w': case 'W': return "[:alnum:]_";
+      case 's': case 'S': return "[:space:]";
+      default:            return NULL;
+   }
+}
+
+/** posix_translate
+  *
+  * Rewrite a pattern in POSIX extended syntax as far as it's the same
+  * language: shorthand classes become bracket expressions, '\n' and
+  * '\t' become the characters, escapes in brackets are unescaped,
+  * groups that don't capture become groups, and '.' becomes '[^\n]',
+  * since a dot in shre doesn't match a newline. Return NULL if a
+  * bracket holds a negated shorthand, which POSIX can't say. Anything
+  * else is left for regcomp to reject.
+  */
+static char* posix_translate(const char* regex) {
+   buffer_t out = { NULL, 0, 0 };
+   bool negated;
+   const char* class;
+   for (const char* c = regex; *c; ++c) {
+      if (*c == '.') {
+         append_str(&out, "[^\n]");
+      } else if (*c == '\\' && c[1] && (class = posix_class(c[1],
+                                                       &negated))) {
+         append_str(&out, negated ? "[^" : "[");
+         append_str(&out, class);
+         append_str(&out, "]");
+         ++c;
+      } else if (*c == '\\' && (c[1] == 'n' || c[1] == 't')) {
+         append_str(&out, *++c == 'n' ? "\n" : "\t");
+      } else if (*c == '\\' && c[1]) {
+         append(&out, c++, 2);
+      } else if (!strncmp(c, "(?:", 3)) {
+         append_str(&out, "(");
+         c += 2;
+      } else if (*c == '[') {
+         // a literal ']' has to come first in POSIX brackets
+         buffer_t set = { NULL, 0, 0 };
+         bool close = false;
+         ++c;
+         append_str(&out, "[");
+         if (*c == '^')
+            append(&out, c++, 1);
+         for (; *c && *c != ']'; ++c) {
+            if (*c != '\\' || !c[1]) {
+               append(&set, c, 1);
+            } else if ((class = posix_class(*++c, &negated))) {
+               if (negated) {
+                  free(set.text);
+                  free(out.text);
+                  return NULL;
+               }
+               append_str(&set, class);
+            } else if (*c == ']') {
+               close = true;
+            } else {
+               append(&set, *c == 'n' ? "\n" : *c == 't' ? "\t" : c, 1);
+            }
+         }
+         if (close)
+            append_str(&out, "]");
+         append(&out, set.text, set.len);
+         append_str(&out, "]");
+         free(set.text);
+         if (!*c)
+            break;
+      } else {
+         append(&out, c, 1);
+      }
+   }
+   return out.text ? out.text : strdup("");
+}
+
+/** posix_compile
+  *
+  * Compile a pattern with regcomp as an extended regular expression,
+  * after translating it. Syntax that POSIX doesn't have, like flags
+  * or lookahead, fails to compile.
+  */
+static void* posix_compile(const char* regex) {
+   char* posix = posix_translate(regex);
+   if (!posix)
+      return NULL;
+   regex_t* re = malloc(sizeof(regex_t));
+   assert(re);
+   int er = regcomp(re, posix, REG_EXTENDED);
+   free(posix);
+   if (er) {
+      free(re);
+      return NULL;
+   }
+   return re;
+}
+
+/** posix_collect
+  *
+  * Find every match in the whole corpus with regexec, going on after
+  * each match the way a scanner does: from its end, or from the next
+  * character if it was empty.
+  */
+static void posix_collect(void* re, corpus_t* corpus, spans_t* s) {
+   size_t at = 0;
+   while (at <= corpus->len) {
+      regmatch_t m = { at, corpus->len };
+      if (regexec(re, corpus->text, 1, &m,
+                  REG_STARTEND | (at ? REG_NOTBOL : 0)))
+         break;
+      add_span(s, m.rm_so, m.rm_eo);
+      at = m.rm_eo > m.rm_so ? (size_t) m.rm_eo : (size_t) m.rm_eo + 1;
+   }
+}
+
+static void posix_release(void* re) {
+   regfree(re);
+   free(re);
+}
+
+#ifdef HAVE_PCRE2
+
+/** pcre_compile
+  *
+  * Compile a pattern with PCRE2, using its JIT when it has one.
+  */
+static void* pcre_compile(const char* regex) {
+   int er;
+   PCRE2_SIZE offset;
+   pcre2_code* code = pcre2_compile((PCRE2_SPTR) regex,
+                     PCRE2_ZERO_TERMINATED, PCRE2_UTF, &er, &offset, NULL);
+   if (code)
+      pcre2_jit_compile(code, PCRE2_JIT_COMPLETE);
+   return code;
+}
+
+/** pcre_collect
+  *
+  * Find every match in the whole corpus with pcre2_match.
+  */
+static void pcre_collect(void* code, corpus_t* corpus, spans_t* s) {
+   pcre2_match_data* data = pcre2_match_data_create_from_pattern(code,
+                                                                 NULL);
+   size_t at = 0;
+   while (at <= corpus->len
+          && pcre2_match(code, (PCRE2_SPTR) corpus->text, corpus->len,
+                         at, 0, data, NULL) >= 0) {
+      PCRE2_SIZE* ovector = pcre2_get_ovector_pointer(data);
+      add_span(s, ovector[0], ovector[1]);
+      at = ovector[1] > ovector[0] ? ovector[1] : ovector[1] + 1;
+   }
+   pcre2_match_data_free(data);
+}
+
+static void pcre_release(void* code) {
+   pcre2_code_free(code);
+}
+
+#endif
+
+static const other_t others[] = {
+   { "posix", posix_compile, posix_collect, posix_release },
+#ifdef HAVE_PCRE2
+   { "pcre2", pcre_compile,  pcre_collect,  pcre_release },
+#endif
+   { NULL, NULL, NULL, NULL }
+};
+
+/** collect
+  *
+  * Collect the matches of a compiled pattern once into s, then enough
+  * more times to take MINTIME seconds. Return the seconds of one run.
+  */
+static double collect(collect_f run, void* compiled, corpus_t* corpus,
+                                                      spans_t* s) {
+   double start = now();
+   run(compiled, corpus, s);
+   double seconds = now() - start;
+   if (seconds < MINTIME) {
+      spans_t scratch = { s->spans, 0, s->cap };
+      int reps = 0;
+      start = now();
+      do {
+         scratch.n = 0;
+         run(compiled, corpus, &scratch);
+         ++reps;
+      } while (now() - start < MINTIME);
+      seconds = (now() - start) / reps;
+      s->spans = scratch.spans;
+      s->cap = scratch.cap;
+   }
+   return seconds;
+}
+
+/** disagreements
+  *
+  * Count the matches that differ between two lists, pairing them up
+  * in order, and set *first to the offset where they first differ,
+  * or -1 if they agree.
+  */
+static size_t disagreements(spans_t* a, spans_t* b, long* first) {
+   size_t n = a->n < b->n ? a->n : b->n;
+   size_t count = a->n > b->n ? a->n - b->n : b->n - a->n;
+   *first = -1;
+   for (size_t i = 0; i < n; ++i) {
+      span_t* x = &a->spans[i];
+      span_t* y = &b->spans[i];
+      if (x->begin != y->begin || x->end != y->end) {
+         if (*first < 0)
+            *first = x->begin < y->begin ? x->begin : y->begin;
+         ++count;
+      }
+   }
+   if (*first < 0 && count)
+      *first = a->n > n ? a->spans[n].begin : b->spans[n].begin;
+   return count;
+}
+
+/** compare_pattern
+  *
+  * Find every match of a pattern in a corpus with shre and each other
+  * engine, and print a line of JSON for each engine with whether its
+  * matches are the same, and its throughput against shre's.
+  */
+static void compare_pattern(const char* suite, const char* regex,
+                                               corpus_t* corpus) {
+   pattern_t* pattern = shre_compile((char*) regex);
+   if (!pattern) {
+      fprintf(stderr, "regex-bench: %s: %s\n", regex,
+                                      shre_strerror(shre_er));
+      return;
+   }
+   spans_t want = { NULL, 0, 0 };
+   double base = collect(collect_shre, pattern, corpus, &want);
+   for (const other_t* other = others; other->name; ++other) {
+      printf("{\"suite\":");
+      print_string(suite);
+      printf(",\"pattern\":");
+      print_string(regex);
+      printf(",\"corpus\":\"%s\",\"bytes\":%zu,\"engine\":\"%s\"",
+             corpus->name, corpus->len, other->name);
+      void* compiled = other->compile(regex);
+      if (!compiled) {
+         printf(",\"supported\":false}\n");
+         continue;
+      }
+      spans_t got = { NULL, 0, 0 };
+      double seconds = collect(other->collect, compiled, corpus, &got);
+      long first;
+      size_t wrong = disagreements(&want, &got, &first);
+      printf(",\"supported\":true,\"mb_per_s\":%.2f,\"shre_mb_per_s\":%.2f",
+             corpus->len / 1e6 / seconds, corpus->len / 1e6 / base);
+      printf(",\"relative\":%.3f,\"matches\":%zu,\"shre_matches\":%zu",
+             seconds / base, got.n, want.n);
+      printf(",\"agree\":%s,\"mismatches\":%zu", wrong ? "false" : "true",
+             wrong);
+      if (wrong)
+         printf(",\"first_mismatch\":%ld}\n", first);
+      else
+         printf(",\"first_mismatch\":null}\n");
+      fflush(stdout);
+      other->release(compiled);
+      free(got.spans);
+   }
+   free(want.spans);
+}
+
+/**********************************suites****************************/
+
+static const char* redux[] = {
+   ">.*\\n|\\n",
+   "agggtaaa|tttaccct",
+   "[cgt]gggtaaa|tttaccc[acg]",
+   "a[act]ggtaaa|tttacc[agt]t",
+   "ag[act]gtaaa|tttac[agt]ct",
+   "agg[act]taaa|ttta[agt]cct",
+   "aggg[acg]aaa|ttt[cgt]ccct",
+   "agggt[cgt]aa|tt[acg]accct",
+   "agggta[cgt]a|t[acg]taccct",
+   "agggtaa[cgt]|[acg]ttaccct",
+   "tHa[Nt]",
+   "aND|caN|Ha[DS]|WaS",
+   "a[NSt]|BY",
+   "<[^>]*>",
+   "\\|[^|][^|]*\\|",
+   NULL
+};
+
+static const char* mariomka[] = {
+   "[\\w\\.+-]+@[\\w\\.-]+\\.[\\w\\.-]+",
+   "[\\w]+://[^/\\s?#]+[^\\s?#]+(?:\\?[^\\s#]*)?(?:#[^\\s]*)?",
+   "(?:(?:25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\\.){3}"
+      "(?:25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)",
+   NULL
+};
+
+static const char* logs[] = {
+   "ERROR",
+   "(?i)timeout",
+   "ERROR|WARN",
+   "\"(GET|POST) /api/\\w+",
+   "\" [45]\\d\\d ",
+   "took=\\d{4}ms",
+   "\\d+\\.\\d+\\.\\d+\\.\\d+",
+   "user=\\w+@example\\.org",
+   "^\\S+ - - \\[[^\\]]+\\] \"[A-Z]+ \\S+ HTTP/1\\.1\" 5\\d\\d",
+   NULL
+};
+
+/* redos
+ *
+ * A pattern that backtracks badly, and the input it's tried on: a
+ * unit repeated, and then a string that makes the match fail.
+ */
+typedef struct {
+   const char* regex;
+   const char* unit;
+   const char* end;
+} redos_t;
+
+static const redos_t redos[] = {
+   { "(a+)+b",        "a",  "" },
+   { "(a|aa)+b",      "a",  "c" },
+   { "(x+x+)+y",      "x",  "" },
+   { "(\\w+\\s?)+$",  "ab ", "!" },
+   { "^(\\d+)*$",     "1",  "a" },
+   { NULL, NULL, NULL }
+};
+
+/** run_suite
+  *
+  * Run each pattern of a suite against a corpus.
+  */
+static void run_suite(const char* suite, const char** regexes,
+                                         corpus_t* corpus) {
+   for (int i = 0; regexes[i]; ++i) {
+      if (differential)
+         compare_pattern(suite, regexes[i], corpus);
+      else
+         bench_pattern(suite, regexes[i], corpus);
+   }
+}
+
+/** run_redos
+  *
+  * Run each pathological pattern against inputs of growing length,
+  * with shre_search only, so the growth of the time shows. With -x,
+  * the matches on each input are compared instead.
+  */
+static void run_redos() {
+   for (int i = 0; redos[i].regex; ++i) {
+      if (differential) {
+         for (int n = 8; n <= 20; n += 4) {
+            corpus_t corpus = make_repeat(redos[i].unit, n, redos[i].end);
+            compare_pattern("redos", redos[i].regex, &corpus);
+            corpus_free(&corpus);
+         }
+         continue;
+      }
+      pattern_t* pattern = shre_compile((char*) redos[i].regex);
+      if (!pattern)
+         continue;
+      double compile = compile_time(redos[i].regex);
+      for (int n = 8; n <= 20; n += 4) {
+         corpus_t corpus = make_repeat(redos[i].unit, n, redos[i].end);
+         report("redos", redos[i].regex, &corpus, "shre_search",
+                compile, measure(run_search, pattern, redos[i].regex,
+                                                          &corpus));
+         corpus_free(&corpus);
+      }
+   }
+}
+
+/** wanted
+  *
+  * Check if a suite was asked for on the command line. All of them
+  * are run if none were.
+  */
+static bool wanted(const char* suite, char** names, int n) {
+   if (n == 0)
+      return true;
+   for (int i = 0; i < n; ++i) {
+      if (!strcmp(names[i], suite))
+         return true;
+   }
+   return false;
+}
+
+int main(int argc, char** argv) {
+   size_t bytes = 4 << 20;
+   const char* dir = "corpus";
+   int c;
+   while ((c = getopt(argc, argv, "xs:d:")) != -1) {
+      switch (c) {
+         case 'x': differential = true;               break;
+         case 's': bytes = atof(optarg) * (1 << 20); break;
+         case 'd': dir = optarg;                      break;
+         default:
+            fprintf(stderr, "usage: regex-bench [-x] [-s megabytes] "
+                            "[-d corpus-dir] [suite...]\n");
+            return 2;
+      }
+   }
+   char** names = argv + optind;
+   int nnames = argc - optind;
+
+   start_regex_engine();
+   if (wanted("redux", names, nnames)) {
+      corpus_t corpus = make_dna(bytes);
+      run_suite("redux", redux, &corpus);
+      corpus_free(&corpus);
+   }
+   if (wanted("mariomka", names, nnames)) {
+      corpus_t corpus = make_text(bytes);
+      run_suite("mariomka", mariomka, &corpus);
+      corpus_free(&corpus);
+   }
+   if (wanted("log", names, nnames)) {
+      corpus_t corpus = make_log(dir, bytes);
+      run_suite("log", logs, &corpus);
+      corpus_free(&corpus);
+   }
+   if (wanted("redos", names, nnames))
+      run_redos();
+   cleanup_regex_engine();
+   return 0;
+}
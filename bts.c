@@ -1,12 +1,20 @@
 /* bts.c
  *
- * Implementation of backtrack stack.
+ * Implementation of backtrack stack. Popped nodes are kept on a spare
+ * list to be pushed again, and each thread keeps the last stack it
+ * freed for the next one it makes, so that a thread doing one search
+ * after another rarely allocates any nodes.
  */
 
 #include <assert.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 #include "bts.h"
+#include "stats.h"
+
+// Most spare nodes a stack keeps.
+#define SPARE 1024
 
 typedef struct _bnode bnode_t;
 
@@ -17,8 +25,19 @@ struct _bnode {
 
 struct _bts {
    bnode_t* top;
+   bnode_t* spare;   // popped nodes
+   int nspare;
+#ifdef SHRE_STATS
+   int depth;        // nodes on the stack
+#endif
 };
 
+// The stack kept by each thread. The key frees it when the thread
+//   exits.
+static __thread bts_t* kept = NULL;
+static pthread_key_t kept_key;
+static pthread_once_t kept_once = PTHREAD_ONCE_INIT;
+
 #define Assign(STATE) \
    STATE.index     = ind; \
    STATE.str       = str; \
@@ -29,24 +48,51 @@ struct _bts {
    STATE.nest      = NULL
 
 
+/************************static functions****************************/
+
+/** destroy
+  *
+  * Deallocate a stack that has no nodes on it, and its spare nodes.
+  */
+static void destroy(void* arg) {
+   bts_t* obj = arg;
+   while (obj->spare) {
+      bnode_t* next = obj->spare->next;
+      free(obj->spare);
+      obj->spare = next;
+   }
+   free(obj);
+}
+
+/** make_key
+  *
+  * Make the key for the kept stacks.
+  */
+static void make_key() {
+   pthread_key_create(&kept_key, destroy);
+}
+
 /************************public functions****************************/
 
 void bts_push(bts_t* obj, int ind, char* str, uint32_t mat,
                                     bool rec, bts_t* inn, int nbr) {
    assert(obj);
    assert(str);
-   if (!obj->top) {
-      obj->top = malloc(sizeof(bnode_t));
-      assert(obj->top);
-      obj->top->next = NULL;
-      Assign(obj->top->state);
+   bnode_t* new_node = obj->spare;
+   if (new_node) {
+      obj->spare = new_node->next;
+      --obj->nspare;
    } else {
-      bnode_t* new_node = malloc(sizeof(bnode_t));
+      new_node = malloc(sizeof(bnode_t));
       assert(new_node);
-      new_node->next = obj->top;
-      Assign(new_node->state);
-      obj->top = new_node;
    }
+   new_node->next = obj->top;
+   Assign(new_node->state);
+   obj->top = new_node;
+#ifdef SHRE_STATS
+   StatCount(pushes);
+   StatDepth(++obj->depth);
+#endif
 }
 
 state_t* bts_top(bts_t* obj) {
@@ -69,7 +115,17 @@ void bts_pop(bts_t* obj) {
    assert(obj->top);
    bnode_t* old_top = obj->top;
    obj->top = obj->top->next;
-   free(old_top);
+#ifdef SHRE_STATS
+   StatCount(pops);
+   --obj->depth;
+#endif
+   if (obj->nspare < SPARE) {
+      old_top->next = obj->spare;
+      obj->spare = old_top;
+      ++obj->nspare;
+   } else {
+      free(old_top);
+   }
 }
 
 bool bts_empty(bts_t* obj) {
@@ -78,9 +134,20 @@ bool bts_empty(bts_t* obj) {
 }
 
 bts_t* bts_new() {
-   bts_t* obj = malloc(sizeof(bts_t));
+   bts_t* obj = kept;
+   if (obj) {
+      kept = NULL;
+      pthread_setspecific(kept_key, NULL);
+      return obj;
+   }
+   obj = malloc(sizeof(bts_t));
    assert(obj);
    obj->top = NULL;
+   obj->spare = NULL;
+   obj->nspare = 0;
+#ifdef SHRE_STATS
+   obj->depth = 0;
+#endif
    return obj;
 }
 
@@ -94,7 +161,13 @@ void bts_free(bts_t* obj) {
          }
          bts_pop(obj);
       }
-      free(obj);
+      if (kept) {
+         destroy(obj);
+      } else {
+         pthread_once(&kept_once, make_key);
+         kept = obj;
+         pthread_setspecific(kept_key, obj);
+      }
    }
 }
 
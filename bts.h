@@ -10,6 +10,7 @@
 #define __regex_bts
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "range.h"
 
 
@@ -67,7 +68,8 @@ bool bts_empty(bts_t*);
 
 /** new
   *
-  * Return a pointer to a new stack.
+  * Return a pointer to a new stack. The stack may be one that the
+  * thread freed before.
   */
 bts_t* bts_new();
 
@@ -0,0 +1,319 @@
+/* charset.c
+ *
+ * Implementation of charsets. The intern table is a chained hash
+ * table keyed by the contents of the charsets, protected by a single
+ * lock. The lock is only taken when charsets are interned, retained
+ * or released, which happens when patterns are built and freed;
+ * testing membership never takes it.
+ *
+ * A charset with many ranges, such as a unicode property, also gets a
+ * two stage table so that testing any codepoint takes constant time.
+ * The first stage maps the high bits of a codepoint to a leaf, which
+ * is a bitmap of BITMAP codepoints. Leaves that are the same are only
+ * stored once; leaf 0 is empty and leaf 1 is full. The table is kept
+ * in the same allocation as the charset, after the ranges, and found
+ * through byte offsets, so a charset can still be copied with memcpy.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "charset.h"
+
+// Codepoints below this are kept in the bitmap.
+#define BITMAP 256
+
+// Charsets with more ranges than this get a table.
+#define TABLERANGES 16
+
+// Initial number of buckets in the intern table. Must be a power of
+//   two.
+#define TABLESIZE 64
+
+/* charset
+ *
+ * The ranges hold every codepoint of the set that is at least BITMAP,
+ * disjoint and in increasing order, so equal sets have equal
+ * contents. The table isn't part of the contents.
+ */
+struct _charset {
+   charset_t* next;      // next charset in the same bucket
+   bool counted;         // false for copies outside the table; never
+                         //   changes, so it's read without the lock
+   int refs;
+   uint32_t hash;
+   uint32_t size;        // bytes, including the table
+   uint32_t nstage;      // entries in the first stage; 0 if no table
+   uint32_t stage;       // offset of the first stage
+   uint32_t leaves;      // offset of the leaves
+   uint64_t bits[BITMAP / 64];
+   int nranges;
+   urange32_t ranges[];
+};
+
+/* table
+ *
+ * The intern table.
+ */
+static struct {
+   pthread_mutex_t lock;
+   charset_t** buckets;
+   int size;             // number of buckets; a power of two
+   int load;
+} table = { PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0 };
+
+/***************************static functions*************************/
+
+/** set_size
+  *
+  * Get the size of a charset with the given number of ranges, not
+  * counting its table.
+  */
+static inline size_t set_size(int nranges) {
+   return sizeof(charset_t) + nranges * sizeof(urange32_t);
+}
+
+/** contents
+  *
+  * Get the part of a charset that identifies it, and its length.
+  */
+static inline const void* contents(charset_t* set, size_t* len) {
+   *len = set_size(set->nranges) - offsetof(charset_t, bits);
+   return set->bits;
+}
+
+/** same
+  *
+  * Check if two charsets hold the same codepoints.
+  */
+static bool same(charset_t* a, charset_t* b) {
+   if (a->hash != b->hash || a->nranges != b->nranges)
+      return false;
+   size_t len;
+   const void* x = contents(a, &len);
+   return memcmp(x, b->bits, len) == 0;
+}
+
+/** add_table
+  *
+  * Give a charset a table. Return the charset, which has been moved.
+  */
+static charset_t* add_table(charset_t* set) {
+   typedef uint64_t leaf_t[BITMAP / 64];
+   uint32_t nstage = set->ranges[set->nranges - 1].hi / BITMAP + 1;
+
+   // fill in a leaf for every entry of the first stage
+   leaf_t* full = calloc(nstage, sizeof(leaf_t));
+   assert(full);
+   for (int i = 0; i < set->nranges; ++i) {
+      for (uint32_t u = set->ranges[i].lo; u <= set->ranges[i].hi; ++u)
+         full[u / BITMAP][u % BITMAP / 64] |= (uint64_t) 1 << (u % 64);
+   }
+
+   // keep the distinct ones
+   leaf_t* leaf = calloc(nstage + 2, sizeof(leaf_t));
+   uint16_t* stage = malloc(nstage * sizeof(uint16_t));
+   assert(leaf && stage);
+   memset(leaf[1], 0xFF, sizeof(leaf_t));
+   uint32_t nleaves = 2;
+   for (uint32_t b = 0; b < nstage; ++b) {
+      uint32_t i = 0;
+      while (i < nleaves && memcmp(leaf[i], full[b], sizeof(leaf_t)) != 0)
+         ++i;
+      if (i == nleaves)
+         memcpy(leaf[nleaves++], full[b], sizeof(leaf_t));
+      stage[b] = i;
+   }
+   assert(nleaves <= UINT16_MAX);
+   free(full);
+
+   uint32_t stage_at = set_size(set->nranges);
+   uint32_t leaves_at = (stage_at + nstage * sizeof(uint16_t) + 7) & ~7;
+   uint32_t size = leaves_at + nleaves * sizeof(leaf_t);
+   set = realloc(set, size);
+   assert(set);
+   set->size = size;
+   set->nstage = nstage;
+   set->stage = stage_at;
+   set->leaves = leaves_at;
+   memcpy((char*) set + stage_at, stage, nstage * sizeof(uint16_t));
+   memcpy((char*) set + leaves_at, leaf, nleaves * sizeof(leaf_t));
+   free(stage);
+   free(leaf);
+   return set;
+}
+
+/** build
+  *
+  * Make a charset out of the ranges of a class, not yet counted.
+  */
+static charset_t* build(class_t* class) {
+   int n = class_size(class);
+   urange32_t* ranges = malloc((n ? n : 1) * sizeof(urange32_t));
+   assert(ranges);
+   n = class_ranges(class, ranges);
+
+   int above = 0;
+   for (int i = 0; i < n; ++i)
+      above += ranges[i].hi >= BITMAP;
+   charset_t* set = calloc(1, set_size(above));
+   assert(set);
+   for (int i = 0; i < n; ++i) {
+      for (uint32_t u = ranges[i].lo; u <= ranges[i].hi && u < BITMAP; ++u)
+         set->bits[u / 64] |= (uint64_t) 1 << (u % 64);
+      if (ranges[i].hi >= BITMAP) {
+         urange32_t* r = &set->ranges[set->nranges++];
+         r->lo = ranges[i].lo < BITMAP ? BITMAP : ranges[i].lo;
+         r->hi = ranges[i].hi;
+      }
+   }
+   free(ranges);
+
+   size_t len;
+   const void* x = contents(set, &len);
+   set->hash = memhash(x, len);
+   set->size = set_size(set->nranges);
+   return set->nranges > TABLERANGES ? add_table(set) : set;
+}
+
+/** expand_table
+  *
+  * Double the number of buckets in the intern table.
+  */
+static void expand_table() {
+   int size = table.size ? table.size * 2 : TABLESIZE;
+   charset_t** buckets = calloc(size, sizeof(charset_t*));
+   assert(buckets);
+   for (int i = 0; i < table.size; ++i) {
+      charset_t* set = table.buckets[i];
+      while (set) {
+         charset_t* next = set->next;
+         set->next = buckets[set->hash & (size - 1)];
+         buckets[set->hash & (size - 1)] = set;
+         set = next;
+      }
+   }
+   free(table.buckets);
+   table.buckets = buckets;
+   table.size = size;
+}
+
+/***************************public functions*************************/
+
+charset_t* charset_intern(class_t* class) {
+   assert(class);
+   charset_t* set = build(class);
+   class_free(class);
+
+   pthread_mutex_lock(&table.lock);
+   if (table.load >= table.size)
+      expand_table();
+   charset_t** bucket = &table.buckets[set->hash & (table.size - 1)];
+   for (charset_t* curr = *bucket; curr; curr = curr->next) {
+      if (same(curr, set)) {
+         ++curr->refs;
+         pthread_mutex_unlock(&table.lock);
+         free(set);
+         return curr;
+      }
+   }
+   set->counted = true;
+   set->refs = 1;
+   set->next = *bucket;
+   *bucket = set;
+   ++table.load;
+   pthread_mutex_unlock(&table.lock);
+   return set;
+}
+
+void charset_retain(charset_t* set) {
+   assert(set);
+   if (!set->counted)
+      return;
+   pthread_mutex_lock(&table.lock);
+   assert(set->refs > 0);
+   ++set->refs;
+   pthread_mutex_unlock(&table.lock);
+}
+
+void charset_release(charset_t* set) {
+   if (!set || !set->counted)
+      return;
+   pthread_mutex_lock(&table.lock);
+   assert(set->refs > 0);
+   if (--set->refs == 0) {
+      charset_t** link = &table.buckets[set->hash & (table.size - 1)];
+      while (*link != set)
+         link = &(*link)->next;
+      *link = set->next;
+      --table.load;
+      free(set);
+   }
+   pthread_mutex_unlock(&table.lock);
+}
+
+bool charset_has(charset_t* set, uint32_t cp) {
+   if (cp < BITMAP)
+      return set->bits[cp / 64] >> (cp % 64) & 1;
+   if (set->nstage) {
+      if (cp / BITMAP >= set->nstage)
+         return false;
+      const uint16_t* stage = (const void*) ((char*) set + set->stage);
+      const uint64_t* leaf = (const void*) ((char*) set + set->leaves);
+      leaf += stage[cp / BITMAP] * (BITMAP / 64);
+      return leaf[cp % BITMAP / 64] >> (cp % 64) & 1;
+   }
+   int lo = 0, hi = set->nranges - 1;
+   while (lo <= hi) {
+      int mid = (lo + hi) / 2;
+      if (cp < set->ranges[mid].lo)
+         hi = mid - 1;
+      else if (cp > set->ranges[mid].hi)
+         lo = mid + 1;
+      else
+         return true;
+   }
+   return false;
+}
+
+int charset_cardinality(charset_t* set) {
+   assert(set);
+   int count = 0;
+   for (int i = 0; i < BITMAP / 64; ++i)
+      count += __builtin_popcountll(set->bits[i]);
+   for (int i = 0; i < set->nranges; ++i)
+      count += set->ranges[i].hi - set->ranges[i].lo + 1;
+   return count;
+}
+
+size_t charset_bytes(charset_t* set) {
+   assert(set);
+   return set->size;
+}
+
+void charset_pack(charset_t* set, arena_t* arena, size_t field) {
+   assert(set);
+   if (arena_local(arena)) {
+      charset_retain(set);
+      arena_extern(arena, field, set);
+      return;
+   }
+   size_t at = arena_alloc(arena, set->size);
+   charset_t* copy = arena_at(arena, at);
+   memcpy(copy, set, set->size);
+   copy->next = NULL;
+   copy->counted = false;
+   copy->refs = 0;
+   arena_link(arena, field, at);
+}
+
+int charset_count() {
+   pthread_mutex_lock(&table.lock);
+   int load = table.load;
+   pthread_mutex_unlock(&table.lock);
+   return load;
+}
+
+/********************************************************************/
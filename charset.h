@@ -0,0 +1,82 @@
+/* charset.h
+ *
+ * A charset is the compiled, immutable form of a character class,
+ * which is what atoms match against. Codepoints below 256 are kept in
+ * a bitmap, so testing them takes one lookup; the rest are kept as a
+ * sorted array of ranges. Charsets with many ranges also get a table
+ * that makes testing any codepoint take constant time.
+ *
+ * Charsets are interned: there is one charset for each distinct set
+ * of codepoints in use, shared by every atom of every pattern that
+ * matches that set. Interned charsets are reference counted, and freed
+ * when the last atom using them is freed. Copies of a charset that
+ * are placed in an image aren't counted, and live as long as the
+ * image does.
+ */
+
+#ifndef __regex_charset
+#define __regex_charset
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "class.h"
+#include "util.h"
+#include "arena.h"
+
+typedef struct _charset charset_t;
+
+/** intern
+  *
+  * Get the interned charset with the same codepoints as the class,
+  * making it if it doesn't exist yet. The caller owns a reference to
+  * the returned charset. The class is freed.
+  */
+charset_t* charset_intern(class_t*);
+
+/** retain
+  *
+  * Take another reference to a charset.
+  */
+void charset_retain(charset_t*);
+
+/** release
+  *
+  * Drop a reference to a charset. The last reference to an interned
+  * charset removes it from the table and frees it.
+  */
+void charset_release(charset_t*);
+
+/** has
+  *
+  * Check if a codepoint is in the charset.
+  */
+bool charset_has(charset_t*, uint32_t);
+
+/** cardinality
+  *
+  * Get the number of codepoints in the charset.
+  */
+int charset_cardinality(charset_t*);
+
+/** bytes
+  *
+  * Get the number of bytes of memory used by the charset.
+  */
+size_t charset_bytes(charset_t*);
+
+/** pack
+  *
+  * Point the pointer field at the given offset of an arena at the
+  * charset. A local arena shares the interned charset, taking a
+  * reference that it records with arena_extern; any other arena gets
+  * a copy, which isn't counted.
+  */
+void charset_pack(charset_t*, arena_t*, size_t field);
+
+/** count
+  *
+  * Get the number of interned charsets.
+  */
+int charset_count();
+
+#endif
@@ -0,0 +1,374 @@
+/* regex self-check program
+ *
+ * Check parts of the engine that are easy to get subtly wrong against
+ * a simpler way of getting the same answer.
+ *
+ *    regex-check [check...]
+ *
+ * The checks are:
+ *
+ *    stream     the matches of a stream fed the input in pieces,
+ *               against the matches of a scanner over the whole
+ *               input, for given cases and for generated patterns
+ *               and inputs split at random
+ *    unicode    the classes that a few characters outside the basic
+ *               multilingual plane are in, against the UCD
+ *
+ * Each mismatch is printed, followed by a line for each check that
+ * says how many cases it tried and how many failed. The exit status is
+ * 1 if any case failed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include "shre.h"
+
+// The number of generated cases of each check.
+#define CASES 4000
+
+/* span list
+ *
+ * The offsets and lengths of a list of matches.
+ */
+typedef struct {
+   size_t* offsets;
+   size_t* lengths;
+   size_t n;
+   size_t cap;
+} spans_t;
+
+static void add_span(spans_t* spans, match_t* match) {
+   if (spans->n == spans->cap) {
+      spans->cap = spans->cap ? spans->cap * 2 : 16;
+      spans->offsets = realloc(spans->offsets,
+                               spans->cap * sizeof(size_t));
+      spans->lengths = realloc(spans->lengths,
+                               spans->cap * sizeof(size_t));
+      assert(spans->offsets && spans->lengths);
+   }
+   spans->offsets[spans->n] = match_offset(match);
+   spans->lengths[spans->n] = match_length(match);
+   ++spans->n;
+}
+
+static void free_spans(spans_t* spans) {
+   free(spans->offsets);
+   free(spans->lengths);
+}
+
+static void print_spans(spans_t* spans) {
+   printf("[");
+   for (size_t i = 0; i < spans->n; ++i)
+      printf("%s%zu+%zu", i ? " " : "", spans->offsets[i],
+                                          spans->lengths[i]);
+   printf("]");
+}
+
+static bool same_spans(spans_t* a, spans_t* b) {
+   if (a->n != b->n)
+      return false;
+   for (size_t i = 0; i < a->n; ++i) {
+      if (a->offsets[i] != b->offsets[i]
+                         || a->lengths[i] != b->lengths[i])
+         return false;
+   }
+   return true;
+}
+
+/*********************************streams****************************/
+
+/* stream case
+ *
+ * A pattern, and its input as the pieces a stream is fed, with a NULL
+ * after the last piece.
+ */
+typedef struct {
+   char* regex;
+   char* pieces[8];
+} stream_case_t;
+
+// Cases that have gone wrong before.
+static stream_case_t stream_cases[] = {
+   { "b|abcd", { "xa", "bc", "d", NULL } },
+   { "c|aaa|aaca", { "xaac", "a", NULL } },
+   { "b(b|baa|acb|cb)c+?a|bcbc*?[^a]?c*|cbaa*?\\w*?",
+                               { " a-cb", "ab-ab ", NULL } },
+   { "\\d+", { "12", "34 5", "6", NULL } },
+   { "foo|foobar", { "xfoo", "ba", "r", NULL } },
+};
+
+/** scan_spans
+  *
+  * Find the matches of a scanner over the whole input. A scanner finds
+  * an empty match at the end of the input again each time it's asked
+  * to, so stop after the first.
+  */
+static void scan_spans(pattern_t* pattern, char* input, spans_t* spans) {
+   size_t len = strlen(input);
+   scanner_t* sc = scan_new(pattern, input);
+   match_t* match;
+   while ((match = scan_next(sc))) {
+      bool last = match_offset(match) == len && !match_length(match);
+      add_span(spans, match);
+      match_free(match);
+      if (last)
+         break;
+   }
+   free(sc);
+}
+
+static void take_matches(match_t** matches, size_t n, spans_t* spans) {
+   for (size_t i = 0; i < n; ++i) {
+      add_span(spans, matches[i]);
+      match_free(matches[i]);
+   }
+   free(matches);
+}
+
+/** check_stream
+  *
+  * Feed a stream the pieces and compare its matches with a scanner's.
+  * Return whether they're the same.
+  */
+static bool check_stream(char* regex, char** pieces, int npieces) {
+   pattern_t* pattern = shre_compile(regex);
+   if (!pattern)
+      return true;
+   size_t len = 0;
+   for (int i = 0; i < npieces; ++i)
+      len += strlen(pieces[i]);
+   char* input = malloc(len + 1);
+   assert(input);
+   input[0] = '\0';
+   for (int i = 0; i < npieces; ++i)
+      strcat(input, pieces[i]);
+
+   spans_t expected = { NULL, NULL, 0, 0 };
+   spans_t got = { NULL, NULL, 0, 0 };
+   scan_spans(pattern, input, &expected);
+   stream_t* st = stream_open(pattern);
+   match_t** matches;
+   size_t n;
+   for (int i = 0; i < npieces; ++i) {
+      matches = stream_feed(st, pieces[i], strlen(pieces[i]), &n);
+      take_matches(matches, n, &got);
+   }
+   matches = stream_close(st, &n);
+   take_matches(matches, n, &got);
+
+   bool same = same_spans(&expected, &got);
+   if (!same) {
+      printf("stream: /%s/ fed", regex);
+      for (int i = 0; i < npieces; ++i)
+         printf(" \"%s\"", pieces[i]);
+      printf(": got ");
+      print_spans(&got);
+      printf(", a scanner finds ");
+      print_spans(&expected);
+      printf("\n");
+   }
+   free_spans(&expected);
+   free_spans(&got);
+   free(input);
+   return same;
+}
+
+/** random_word
+  *
+  * Write a word of one to four letters from a small alphabet, so that
+  * words often overlap and share prefixes.
+  */
+static char* random_word(char* write) {
+   int len = 1 + rand() % 4;
+   for (int i = 0; i < len; ++i)
+      *write++ = "abc"[rand() % 3];
+   return write;
+}
+
+/** random_regex
+  *
+  * Make a pattern that takes one of the literal fast paths: either an
+  * alternation of literals, or one where every branch begins with a
+  * literal and goes on with a repetition.
+  */
+static void random_regex(char* regex) {
+   int branches = 1 + rand() % 4;
+   bool prefixed = rand() % 2;
+   for (int i = 0; i < branches; ++i) {
+      if (i)
+         *regex++ = '|';
+      regex = random_word(regex);
+      if (prefixed) {
+         strcpy(regex, (char*[]) { "c*", "\\w*?", "[^a]?", "b+" }
+                                                   [rand() % 4]);
+         regex += strlen(regex);
+      }
+   }
+   *regex = '\0';
+}
+
+static int check_streams(int* failed) {
+   int tried = 0;
+   int ncases = sizeof(stream_cases) / sizeof(stream_case_t);
+   for (int i = 0; i < ncases; ++i) {
+      char** pieces = stream_cases[i].pieces;
+      int npieces = 0;
+      while (pieces[npieces])
+         ++npieces;
+      *failed += !check_stream(stream_cases[i].regex, pieces, npieces);
+      ++tried;
+   }
+
+   srand(1);
+   for (int i = 0; i < CASES; ++i) {
+      char regex[128];
+      random_regex(regex);
+      char input[64];
+      int len = rand() % sizeof(input);
+      for (int k = 0; k < len; ++k)
+         input[k] = "abc -"[rand() % 5];
+      input[len] = '\0';
+
+      // split the input at up to seven places
+      char* pieces[8];
+      char copies[8][64];
+      int npieces = 0;
+      int at = 0;
+      while (at < len && npieces < 7) {
+         int size = 1 + rand() % 8;
+         if (size > len - at)
+            size = len - at;
+         memcpy(copies[npieces], input + at, size);
+         copies[npieces][size] = '\0';
+         pieces[npieces] = copies[npieces];
+         ++npieces;
+         at += size;
+      }
+      if (at < len) {
+         strcpy(copies[npieces], input + at);
+         pieces[npieces] = copies[npieces];
+         ++npieces;
+      }
+      *failed += !check_stream(regex, pieces, npieces);
+      ++tried;
+   }
+   return tried;
+}
+
+/*********************************unicode****************************/
+
+/* class case
+ *
+ * A pattern that is a single class, a codepoint, and whether the class
+ * has the codepoint, as given by the UCD.
+ */
+typedef struct {
+   char* regex;
+   uint32_t codepoint;
+   bool has;
+} class_case_t;
+
+static class_case_t class_cases[] = {
+   { "\\p{L}",   0x40041,  false },     // unassigned
+   { "[A-Z]",    0x40041,  false },
+   { "\\p{Cn}",  0x40041,  true  },
+   { "\\p{L}",   0xE0041,  false },     // TAG LATIN CAPITAL LETTER A
+   { "\\p{Han}", 0xE0041,  false },
+   { "\\p{Cf}",  0xE0041,  true  },
+   { "\\p{L}",   0x20000,  true  },     // CJK Extension B
+   { "\\p{Han}", 0x20000,  true  },
+   { "\\p{Lu}",  0x1D400,  true  },     // MATHEMATICAL BOLD CAPITAL A
+   { "\\p{Nd}",  0x1D7CE,  true  },     // MATHEMATICAL BOLD DIGIT ZERO
+   { "\\P{Nd}",  0x1D7CE,  false },
+   { "\\p{Co}",  0xF0000,  true  },     // planes 15 and 16 private use
+   { "\\p{Co}",  0x10FFFD, true  },
+   { "\\p{L}",   0x10FFFD, false },
+};
+
+/** encode
+  *
+  * Write a codepoint as UTF-8, followed by a null character.
+  */
+static void encode(uint32_t cp, char* write) {
+   if (cp < 0x80) {
+      *write++ = cp;
+   } else if (cp < 0x800) {
+      *write++ = 0xC0 | cp >> 6;
+      *write++ = 0x80 | (cp & 0x3F);
+   } else if (cp < 0x10000) {
+      *write++ = 0xE0 | cp >> 12;
+      *write++ = 0x80 | (cp >> 6 & 0x3F);
+      *write++ = 0x80 | (cp & 0x3F);
+   } else {
+      *write++ = 0xF0 | cp >> 18;
+      *write++ = 0x80 | (cp >> 12 & 0x3F);
+      *write++ = 0x80 | (cp >> 6 & 0x3F);
+      *write++ = 0x80 | (cp & 0x3F);
+   }
+   *write = '\0';
+}
+
+static int check_unicode(int* failed) {
+   int ncases = sizeof(class_cases) / sizeof(class_case_t);
+   for (int i = 0; i < ncases; ++i) {
+      class_case_t* c = &class_cases[i];
+      char str[5];
+      encode(c->codepoint, str);
+      pattern_t* pattern = shre_compile(c->regex);
+      assert(pattern);
+      match_t* match = shre_entire(pattern, str);
+      if (!match != !c->has) {
+         printf("unicode: /%s/ %s U+%04X\n", c->regex,
+                   match ? "matches" : "doesn't match", c->codepoint);
+         ++*failed;
+      }
+      if (match)
+         match_free(match);
+   }
+   return ncases;
+}
+
+/***********************************main*****************************/
+
+typedef struct {
+   const char* name;
+   int (*run)(int*);
+} check_t;
+
+static check_t checks[] = {
+   { "stream", check_streams },
+   { "unicode", check_unicode },
+};
+
+int main(int argc, char** argv) {
+   start_regex_engine();
+   int nchecks = sizeof(checks) / sizeof(check_t);
+   for (int i = 1; i < argc; ++i) {
+      bool known = false;
+      for (int c = 0; c < nchecks; ++c)
+         known |= !strcmp(argv[i], checks[c].name);
+      if (!known) {
+         fprintf(stderr, "regex-check: %s: no such check\n", argv[i]);
+         return 2;
+      }
+   }
+
+   bool ok = true;
+   for (int c = 0; c < nchecks; ++c) {
+      bool chosen = argc == 1;
+      for (int i = 1; i < argc; ++i)
+         chosen |= !strcmp(argv[i], checks[c].name);
+      if (!chosen)
+         continue;
+      int failed = 0;
+      int tried = checks[c].run(&failed);
+      printf("%s: %d cases, %d failed\n", checks[c].name, tried, failed);
+      ok &= !failed;
+   }
+   cleanup_regex_engine();
+   return ok ? 0 : 1;
+}
@@ -191,12 +191,14 @@ static void balance(class_t* tree) {
   * and combine them.
   */
 static inline void one_away_ranges(class_t* vine) {
-   for (; vine->rchild; vine = vine->rchild) {
+   while (vine->rchild) {
       if (vine->range.hi + 1 == vine->rchild->range.lo) {
          class_t* child = vine->rchild;
          vine->range.hi = child->range.hi;
          vine->rchild = child->rchild;
          free(child);
+      } else {
+         vine = vine->rchild;
       }
    }
 }
@@ -531,6 +533,59 @@ int class_size(class_t* tree) {
    return 1 + class_size(tree->lchild) + class_size(tree->rchild);
 }
 
+/** copy_ranges
+  *
+  * Copy the ranges of a subtree in order, and return the position
+  * after the last one.
+  */
+static urange32_t* copy_ranges(class_t* tree, urange32_t* out) {
+   if (!tree)
+      return out;
+   out = copy_ranges(tree->lchild, out);
+   *out++ = tree->range;
+   return copy_ranges(tree->rchild, out);
+}
+
+int class_ranges(class_t* tree, urange32_t* out) {
+   assert(tree && out);
+   if (EmptyTree(tree))
+      return 0;
+   return copy_ranges(tree, out) - out;
+}
+
+size_t class_bytes(class_t* tree) {
+   if (!tree)
+      return 0;
+   return sizeof(class_t) + class_bytes(tree->lchild)
+                          + class_bytes(tree->rchild);
+}
+
+/** build_balanced
+  *
+  * Build a perfectly balanced tree out of a sorted array of disjoint
+  * ranges.
+  */
+static class_t* build_balanced(const urange32_t* ranges, int n) {
+   if (n == 0)
+      return NULL;
+   int mid = n / 2;
+   class_t* tree = class_construct(ranges[mid]);
+   tree->lchild = build_balanced(ranges, mid);
+   tree->rchild = build_balanced(ranges + mid + 1, n - mid - 1);
+   return tree;
+}
+
+class_t* class_from_ranges(const urange32_t* ranges, int n) {
+   assert(ranges || n == 0);
+   for (int i = 0; i < n; ++i) {
+      assert(ranges[i].lo <= ranges[i].hi);
+      assert(i == 0 || ranges[i - 1].hi + 1 < ranges[i].lo);
+   }
+   if (n == 0)
+      return class_new();
+   return build_balanced(ranges, n);
+}
+
 class_t* class_new() {
    urange32_t range = { EmptyVal, 0 };
    return class_construct(range);
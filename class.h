@@ -9,6 +9,7 @@
 #define __regex_class
 
 #include <stdbool.h>
+#include <stddef.h>
 #include "hooks.h"
 #include "util.h"
 
@@ -85,12 +86,34 @@ int class_cardinality(class_t*);
   */
 int class_size(class_t*);
 
+/** ranges
+  *
+  * Copy the disjoint ranges of the class into an array, in increasing
+  * order. The array must have room for class_size ranges. Return the
+  * number of ranges copied.
+  */
+int class_ranges(class_t*, urange32_t*);
+
+/** bytes
+  *
+  * Get the number of bytes of memory used by the class.
+  */
+size_t class_bytes(class_t*);
+
 /** new
   *
   * Creates an empty class.
   */
 class_t* class_new();
 
+/** from_ranges
+  *
+  * Creates a class holding an array of ranges, which must be sorted,
+  * disjoint and not adjacent, as the ranges of a class are. The tree
+  * is built balanced in one pass, without any insertions.
+  */
+class_t* class_from_ranges(const urange32_t*, int);
+
 /** free
   *
   * Frees a tree's memory.
@@ -180,6 +180,21 @@ static void branch_free(branch_t* obj) {
    }
 }
 
+branch_t* branch_next(branch_t* obj) {
+   assert(obj);
+   return obj->next;
+}
+
+int branch_size(branch_t* obj) {
+   assert(obj);
+   return obj->load;
+}
+
+atom_t* branch_atom(branch_t* obj, int index) {
+   assert(obj && index >= 0 && index < obj->load);
+   return obj->atoms[index];
+}
+
 /**************************core operations***************************/
 
 int core_index(core_t* obj) {
@@ -208,6 +223,11 @@ int _core_groups(core_t* obj) {
    return high;
 }
 
+branch_t* core_first_branch(core_t* obj) {
+   assert(obj);
+   return obj->start;
+}
+
 core_t* core_find_core(core_t* obj, int index) {
    assert(obj && index >= 0);
    if (index == obj->index)
@@ -236,6 +256,48 @@ branch_t* core_add_branch(core_t* obj, branch_t* insert) {
    return insert->next;
 }
 
+size_t core_bytes(core_t* obj) {
+   assert(obj);
+   size_t bytes = sizeof(core_t);
+   for (branch_t* curr = obj->start; curr; curr = curr->next) {
+      int cap = DEFCAP;
+      while (cap < curr->load)
+         cap *= 2;
+      bytes += sizeof(branch_t) + cap * sizeof(atom_t*);
+      for (int i = 0; i < curr->load; ++i)
+         bytes += atom_bytes(curr->atoms[i]);
+   }
+   return bytes;
+}
+
+size_t core_pack(core_t* obj, arena_t* arena) {
+   assert(obj);
+   size_t at = arena_alloc(arena, sizeof(core_t));
+   ((core_t*) arena_at(arena, at))->index = obj->index;
+   arena_note(arena, obj, at);    // for subroutine calls
+   int n = 0;
+   for (branch_t* curr = obj->start; curr; curr = curr->next)
+      ++n;
+   if (!n)
+      return at;
+
+   // the branches go side by side, before any of their atoms
+   size_t branches = arena_alloc(arena, n * sizeof(branch_t));
+   arena_link(arena, at + offsetof(core_t, start), branches);
+   branch_t* curr = obj->start;
+   for (int i = 0; i < n; ++i, curr = curr->next) {
+      size_t branch = branches + i * sizeof(branch_t);
+      ((branch_t*) arena_at(arena, branch))->load = curr->load;
+      if (i + 1 < n)
+         arena_link(arena, branch + offsetof(branch_t, next),
+                           branch + sizeof(branch_t));
+      if (curr->load)
+         arena_link(arena, branch + offsetof(branch_t, atoms),
+                           atom_pack(curr->atoms, curr->load, arena));
+   }
+   return at;
+}
+
 core_t* core_new(int index) {
    core_t* obj = malloc(sizeof(core_t));
    assert(obj);
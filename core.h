@@ -62,6 +62,50 @@ branch_t* core_add_branch(core_t*, branch_t*);
   */
 atom_t* branch_add_atom(branch_t*);
 
+//
+// used to analyze a finished core
+//
+
+/** first_branch
+  *
+  * Get the first branch of the core.
+  */
+branch_t* core_first_branch(core_t*);
+
+/** branch_next
+  *
+  * Get the branch after the given one, or NULL if it's the last
+  * branch in the core.
+  */
+branch_t* branch_next(branch_t*);
+
+/** branch_size
+  *
+  * Get the number of atoms in the branch.
+  */
+int branch_size(branch_t*);
+
+/** branch_atom
+  *
+  * Get the atom at the given position in the branch.
+  */
+atom_t* branch_atom(branch_t*, int);
+
+/** bytes
+  *
+  * Get the number of bytes of memory used by the core, including its
+  * atoms.
+  */
+size_t core_bytes(core_t*);
+
+/** pack
+  *
+  * Copy the core, its branches and its atoms into an arena, and
+  * return the offset of the copy. The copy can be matched against,
+  * but not changed or freed with core_free.
+  */
+size_t core_pack(core_t*, arena_t*);
+
 //
 // allocation
 //
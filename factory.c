@@ -40,18 +40,24 @@ static core_t* _build_core(tlist_t* tokens, int index, clist_t* subs) {
             curr = branch_add_atom(branch);
             atom_set_string(curr, token->data.string);
             break;
+         case ISTRING:
+            curr = branch_add_atom(branch);
+            atom_set_string(curr, token->data.string);
+            atom_set_caseless(curr, true);
+            break;
 
          /* Character tree case. Same as literal case except that
-          * the tree is already made by the lexer.
+          * the tree is already made by the lexer. The atom gets the
+          * interned charset for the tree, and the tree is freed.
           */
          case CLASS:
             curr = branch_add_atom(branch);
-            atom_set_class(curr, token->data.class);
+            atom_set_class(curr, charset_intern(token->data.class));
             atom_set_invert(curr, false);
             break;
          case NCLASS:
             curr = branch_add_atom(branch);
-            atom_set_class(curr, token->data.class);
+            atom_set_class(curr, charset_intern(token->data.class));
             atom_set_invert(curr, true);
             break;
 
@@ -151,7 +157,7 @@ static core_t* _build_core(tlist_t* tokens, int index, clist_t* subs) {
             
          /* Should have been converted already.
           */
-         case POSSESSIVE: case LITERAL: case NAME:
+         case POSSESSIVE: case LITERAL: case ILITERAL: case NAME:
          	assert(false);
       }
       tlist_pop_front(tokens);
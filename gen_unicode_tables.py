@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+#
+# gen_unicode_tables.py
+#
+# Generate unicode_tables.h from the Unicode Character Database. Takes
+# the directory of an unpacked UCD (the one holding Scripts.txt,
+# PropList.txt, CaseFolding.txt and extracted/DerivedGeneralCategory.txt)
+# and writes the header to standard output:
+#
+#     python3 gen_unicode_tables.py path/to/ucd > unicode_tables.h
+#
+# Every codepoint is mapped to a record holding its general category,
+# its script and whether it's white space. The records are looked up
+# through three stages: the first stage maps the high bits of a
+# codepoint to a block of the second stage, the second stage maps the
+# middle bits to a block of the third stage, and the third stage maps
+# the low bits to a record number. Blocks that are the same are only
+# stored once, and the block sizes are chosen to make the tables as
+# small as possible.
+#
+# The header also holds the case orbits of the simple case folding:
+# codepoints that fold to the same codepoint are matched alike when
+# case is ignored, and each of them points to the next one of its
+# orbit, the last one pointing back to the first.
+
+import os
+import re
+import sys
+
+MAXCP = 0x110000
+
+# General categories, in the order of their numbers. Cn, unassigned,
+# is the default and comes first.
+CATEGORIES = [
+    "Cn", "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl",
+    "No", "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po", "Sm", "Sc", "Sk",
+    "So", "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co",
+]
+
+LINE = re.compile(r"^([0-9A-Fa-f]+)(?:\.\.([0-9A-Fa-f]+))?\s*;\s*([^#\s]+)")
+
+
+def read_property_file(path):
+    """Yield (lo, hi, value) for every line of a UCD property file."""
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            m = LINE.match(line)
+            if m:
+                lo = int(m.group(1), 16)
+                hi = int(m.group(2), 16) if m.group(2) else lo
+                yield lo, hi, m.group(3)
+
+
+def read_version(path):
+    """Find the version in the header comment of a UCD file."""
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            m = re.search(r"(\d+\.\d+\.\d+)", line)
+            if m:
+                return m.group(1)
+            if not line.startswith("#"):
+                break
+    return "unknown"
+
+
+def build_records(ucd):
+    category = bytearray(MAXCP)     # Cn everywhere to begin with
+    script = bytearray(MAXCP)       # Unknown everywhere
+    space = bytearray(MAXCP)
+
+    gc_path = os.path.join(ucd, "extracted", "DerivedGeneralCategory.txt")
+    for lo, hi, value in read_property_file(gc_path):
+        number = CATEGORIES.index(value)
+        category[lo:hi + 1] = bytes([number]) * (hi - lo + 1)
+
+    sc_path = os.path.join(ucd, "Scripts.txt")
+    names = sorted({v for _, _, v in read_property_file(sc_path)})
+    scripts = ["Unknown"] + [n for n in names if n != "Unknown"]
+    if len(scripts) > 256:
+        sys.exit("too many scripts")
+    for lo, hi, value in read_property_file(sc_path):
+        number = scripts.index(value)
+        script[lo:hi + 1] = bytes([number]) * (hi - lo + 1)
+
+    for lo, hi, value in read_property_file(os.path.join(ucd, "PropList.txt")):
+        if value == "White_Space":
+            space[lo:hi + 1] = b"\x01" * (hi - lo + 1)
+
+    records = {(0, 0, 0): 0}
+    record_of = [0] * MAXCP
+    for cp in range(MAXCP):
+        key = (category[cp], script[cp], space[cp])
+        if key not in records:
+            records[key] = len(records)
+        record_of[cp] = records[key]
+    ordered = sorted(records, key=records.get)
+    return scripts, ordered, record_of, read_version(sc_path)
+
+
+def build_orbits(ucd):
+    """Return (cp, next) for every codepoint whose case orbit holds
+    more than one codepoint, in order of cp."""
+    orbits = {}
+    with open(os.path.join(ucd, "CaseFolding.txt"), encoding="utf-8") as f:
+        for line in f:
+            fields = [x.strip() for x in line.split("#")[0].split(";")]
+            if len(fields) < 3 or fields[1] not in ("C", "S"):
+                continue
+            cp, fold = int(fields[0], 16), int(fields[2], 16)
+            orbits.setdefault(fold, {fold}).add(cp)
+    pairs = []
+    for members in orbits.values():
+        members = sorted(members)
+        for i, cp in enumerate(members):
+            pairs.append((cp, members[(i + 1) % len(members)]))
+    return sorted(pairs)
+
+
+def split(values, shift):
+    """Cut values into blocks of 1 << shift, storing each distinct
+    block once. Return the block number of each block, and the
+    distinct blocks one after the other."""
+    size = 1 << shift
+    blocks = {}
+    numbers = []
+    stored = []
+    for start in range(0, len(values), size):
+        block = tuple(values[start:start + size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stored.extend(block)
+        numbers.append(blocks[block])
+    return numbers, stored
+
+
+def ctype(values):
+    return "uint8_t" if max(values) < 256 else "uint16_t"
+
+
+def width(values):
+    return 1 if max(values) < 256 else 2
+
+
+def emit_array(out, decl, values, per_line):
+    out.append(decl + " = {")
+    for i in range(0, len(values), per_line):
+        row = values[i:i + per_line]
+        out.append("   " + ", ".join(str(v) for v in row) + ",")
+    out.append("};")
+    out.append("")
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: gen_unicode_tables.py UCD-DIRECTORY")
+    scripts, records, record_of, version = build_records(sys.argv[1])
+    orbits = build_orbits(sys.argv[1])
+
+    best = None
+    for shift3 in range(2, 9):
+        numbers, stage3 = split(record_of, shift3)
+        for shift2 in range(2, 9):
+            stage1, stage2 = split(numbers, shift2)
+            size = sum(len(t) * width(t) for t in (stage1, stage2, stage3))
+            if best is None or size < best[0]:
+                best = (size, shift2, shift3, stage1, stage2, stage3)
+    size, shift2, shift3, stage1, stage2, stage3 = best
+
+    out = []
+    out.append("/* unicode_tables.h")
+    out.append(" *")
+    out.append(" * Generated by gen_unicode_tables.py from version %s of the"
+               % version)
+    out.append(" * Unicode Character Database. Don't edit it by hand.")
+    out.append(" *")
+    out.append(" * The record of a codepoint is found in three steps:")
+    out.append(" *")
+    out.append(" *    b = unicode_stage1[cp >> (UNICODE_SHIFT2 + "
+               "UNICODE_SHIFT3)]")
+    out.append(" *    b = unicode_stage2[(b << UNICODE_SHIFT2)")
+    out.append(" *                       + (cp >> UNICODE_SHIFT3 & "
+               "((1 << UNICODE_SHIFT2) - 1))]")
+    out.append(" *    r = unicode_stage3[(b << UNICODE_SHIFT3)")
+    out.append(" *                       + (cp & ((1 << UNICODE_SHIFT3) - 1))]")
+    out.append(" *")
+    out.append(" * and unicode_records[r] is the record.")
+    out.append(" *")
+    out.append(" * Only unicode.c includes this file.")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef __regex_unicode_tables")
+    out.append("#define __regex_unicode_tables")
+    out.append("")
+    out.append("#include <stdbool.h>")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append('#define UNICODE_VERSION "%s"' % version)
+    out.append("#define UNICODE_SHIFT2 %d" % shift2)
+    out.append("#define UNICODE_SHIFT3 %d" % shift3)
+    out.append("#define UNICODE_CATEGORIES %d" % len(CATEGORIES))
+    out.append("#define UNICODE_SCRIPTS %d" % len(scripts))
+    out.append("#define UNICODE_ORBITS %d" % len(orbits))
+    out.append("")
+    out.append("/* unicode_record")
+    out.append(" *")
+    out.append(" * The properties of a codepoint. category and script are "
+               "indices")
+    out.append(" * into the name arrays below.")
+    out.append(" */")
+    out.append("typedef struct {")
+    out.append("   uint8_t category;")
+    out.append("   uint8_t script;")
+    out.append("   bool space;         // White_Space")
+    out.append("} unicode_record_t;")
+    out.append("")
+    out.append("static const char* const unicode_category_names[] = {")
+    for i in range(0, len(CATEGORIES), 10):
+        out.append("   " + ", ".join('"%s"' % c for c in CATEGORIES[i:i + 10])
+                   + ",")
+    out.append("};")
+    out.append("")
+    out.append("static const char* const unicode_script_names[] = {")
+    for name in scripts:
+        out.append('   "%s",' % name)
+    out.append("};")
+    out.append("")
+    out.append("static const unicode_record_t unicode_records[] = {")
+    for c, s, w in records:
+        out.append("   { %d, %d, %s }," % (c, s, "true" if w else "false"))
+    out.append("};")
+    out.append("")
+    out.append("/* unicode_orbit")
+    out.append(" *")
+    out.append(" * A codepoint whose case orbit has more than one "
+               "codepoint, and")
+    out.append(" * the next codepoint of the orbit, in order of cp.")
+    out.append(" */")
+    out.append("typedef struct {")
+    out.append("   uint32_t cp;")
+    out.append("   uint32_t next;")
+    out.append("} unicode_orbit_t;")
+    out.append("")
+    out.append("static const unicode_orbit_t unicode_orbits[] = {")
+    for i in range(0, len(orbits), 3):
+        out.append("   " + " ".join("{ 0x%05X, 0x%05X }," % o
+                                     for o in orbits[i:i + 3]))
+    out.append("};")
+    out.append("")
+    emit_array(out, "static const %s unicode_stage1[]" % ctype(stage1),
+               stage1, 16)
+    emit_array(out, "static const %s unicode_stage2[]" % ctype(stage2),
+               stage2, 16)
+    emit_array(out, "static const %s unicode_stage3[]" % ctype(stage3),
+               stage3, 16)
+    out.append("#endif")
+    sys.stdout.write("\n".join(out) + "\n")
+    sys.stderr.write("%d records, stages of %d, %d and %d entries, "
+                     "%d bytes, %d orbit entries\n"
+                     % (len(records), len(stage1), len(stage2), len(stage3),
+                        size, len(orbits)))
+
+
+if __name__ == "__main__":
+    main()
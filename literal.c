@@ -0,0 +1,451 @@
+/* literal.c
+ *
+ * Literal analysis of a compiled core.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "literal.h"
+#include "atom.h"
+#include "ahoc.h"
+#include "teddy.h"
+
+/* Lengths longer than this are treated as having no upper bound, so
+ * that the arithmetic below can't overflow.
+ */
+#define MAXWIDTH (1 << 20)
+
+/* Sets of prefix literals larger than this aren't worth searching
+ * for, since nearly every position would be a candidate anyway.
+ */
+#define MAXPREFIXES 64
+
+/* width
+ *
+ * Bounds on the number of bytes matched by part of a core. max is -1
+ * if there's no upper bound.
+ */
+typedef struct {
+   int min;
+   int max;
+} width_t;
+
+/* litset
+ *
+ * Declaration of literal set object. Exactly one of the two
+ * searchers is used.
+ */
+struct _litset {
+   teddy_t* teddy;
+   ahoc_t* ahoc;
+   int longest;        // length of the longest literal
+};
+
+/* inner
+ *
+ * Declaration of inner literal object. minpre and maxpre bound the
+ * number of bytes between the beginning of a match and the literal,
+ * and span holds the bytes that can occur there.
+ */
+struct _inner {
+   strsearch_t* search;
+   int minpre;
+   int maxpre;         // -1 if there's no upper bound
+   bool span[256];
+};
+
+/***************************static functions*************************/
+
+/** is_once
+  *
+  * Check that an atom is matched exactly once.
+  */
+static inline bool is_once(atom_t* atom) {
+   urange32_t range = atom_get_range(atom);
+   return range.lo == 1 && range.hi == 1;
+}
+
+/** sole_atom
+  *
+  * If the branch consists of a single atom that isn't repeated,
+  * return the atom. Otherwise return NULL.
+  */
+static atom_t* sole_atom(branch_t* branch) {
+   if (branch_size(branch) != 1)
+      return NULL;
+   atom_t* atom = branch_atom(branch, 0);
+   return is_once(atom) ? atom : NULL;
+}
+
+/** count_strings
+  *
+  * If every branch of the core is a single string atom, return the
+  * number of branches. Otherwise return zero.
+  */
+static int count_strings(core_t* core) {
+   int count = 0;
+   for (branch_t* b = core_first_branch(core); b; b = branch_next(b)) {
+      atom_t* atom = sole_atom(b);
+      if (!atom || !atom_string(atom))
+         return 0;
+      ++count;
+   }
+   return count;
+}
+
+/** unwrap
+  *
+  * If the core consists of a single group or atomic group that isn't
+  * repeated, return the nested core and set *group to its index.
+  * Otherwise return the core itself and set *group to 0.
+  */
+static core_t* unwrap(core_t* core, int* group) {
+   *group = 0;
+   branch_t* branch = core_first_branch(core);
+   if (branch_next(branch))
+      return core;
+   atom_t* atom = sole_atom(branch);
+   if (!atom || (atom_type(atom) != Group && atom_type(atom) != Atomic))
+      return core;
+   core = atom_group(atom);
+   *group = core_index(core);
+   return core;
+}
+
+/** litset_new
+  *
+  * Make a set out of an array of literals, and an array saying which
+  * of them ignore the case of ascii letters. The automaton can't
+  * ignore case, so return NULL if there are too many literals for
+  * Teddy and some of them are caseless.
+  */
+static litset_t* litset_new(char** literals, bool* caseless, int n) {
+   if (n > TEDDY_MAX) {
+      for (int i = 0; i < n; ++i) {
+         if (caseless[i])
+            return NULL;
+      }
+   }
+   litset_t* set = calloc(1, sizeof(litset_t));
+   assert(set);
+   for (int i = 0; i < n; ++i) {
+      if ((int) strlen(literals[i]) > set->longest)
+         set->longest = strlen(literals[i]);
+   }
+   if (n <= TEDDY_MAX) {
+      set->teddy = teddy_new(literals, caseless, n);
+   } else {
+      set->ahoc = ahoc_new();
+      for (int i = 0; i < n; ++i)
+         ahoc_add(set->ahoc, literals[i]);
+      ahoc_build(set->ahoc);
+   }
+   return set;
+}
+
+/** is_zero_width
+  *
+  * Check whether an atom is an assertion that doesn't consume any
+  * input.
+  */
+static inline bool is_zero_width(atom_t* atom) {
+   atom_info type = atom_type(atom);
+   return type == LookAhead || type == WordAnchor || type == EdgeAnchor;
+}
+
+/** add_prefixes
+  *
+  * Add the literal that each branch of the core must begin with to
+  * the array. Return false if some branch doesn't begin with a
+  * literal, or if there are too many literals.
+  */
+static bool add_prefixes(core_t* core, char** literals,
+                                         bool* caseless, int* n) {
+   for (branch_t* b = core_first_branch(core); b; b = branch_next(b)) {
+      int i = 0;
+      while (i < branch_size(b) && is_zero_width(branch_atom(b, i)))
+         ++i;
+      if (i == branch_size(b))
+         return false;
+      atom_t* atom = branch_atom(b, i);
+      if (atom_get_range(atom).lo < 1)
+         return false;
+      switch (atom_type(atom)) {
+         case String:
+            if (*n == MAXPREFIXES)
+               return false;
+            caseless[*n] = atom_caseless(atom);
+            literals[(*n)++] = atom_string(atom);
+            break;
+         case Group: case Atomic:
+            if (!add_prefixes(atom_group(atom), literals, caseless, n))
+               return false;
+            break;
+         default:
+            return false;
+      }
+   }
+   return true;
+}
+
+/** add_width
+  *
+  * Width of one part followed by another.
+  */
+static width_t add_width(width_t a, width_t b) {
+   width_t w = { a.min + b.min, -1 };
+   if (a.max >= 0 && b.max >= 0 && a.max + b.max <= MAXWIDTH)
+      w.max = a.max + b.max;
+   if (w.min > MAXWIDTH)
+      w.min = MAXWIDTH;
+   return w;
+}
+
+/** repeat_width
+  *
+  * Width of a part repeated between range.lo and range.hi times.
+  */
+static width_t repeat_width(width_t a, urange32_t range) {
+   width_t w = { -1, -1 };
+   long min = (long) a.min * range.lo;
+   w.min = min > MAXWIDTH ? MAXWIDTH : min;
+   if (a.max == 0)
+      w.max = 0;
+   else if (a.max > 0 && range.hi != MAXREPS
+                      && (long) a.max * range.hi <= MAXWIDTH)
+      w.max = a.max * range.hi;
+   return w;
+}
+
+/** class_width
+  *
+  * Width of a single match of a class atom. Add the bytes the atom
+  * can match to span. A codepoint outside of ascii takes between two
+  * and four bytes, all of which are at least 0x80.
+  */
+static width_t class_width(atom_t* atom, bool* span) {
+   charset_t* class = atom_class(atom);
+   bool invert = atom_invert(atom);
+   int ascii = 0;
+   for (int u = 0; u < 0x80; ++u) {
+      bool in = charset_has(class, u);
+      ascii += in;
+      if (in != invert)
+         span[u] = true;
+   }
+   width_t w = { 1, 1 };
+   if (invert || charset_cardinality(class) > ascii) {
+      for (int u = 0x80; u < 0x100; ++u)
+         span[u] = true;
+      w.max = 4;
+   }
+   return w;
+}
+
+static width_t core_width(core_t*, bool*);
+
+/** atom_width
+  *
+  * Width of an atom including its repetitions. Add the bytes the
+  * atom can match to span.
+  */
+static width_t atom_width(atom_t* atom, bool* span) {
+   width_t w = { 0, 0 };
+   switch (atom_type(atom)) {
+      case String:
+         w.min = w.max = strlen(atom_string(atom));
+         for (unsigned char* u = (unsigned char*) atom_string(atom);
+                                                         *u; ++u) {
+            span[*u] = true;
+            if (atom_caseless(atom) && *u >= 'a' && *u <= 'z')
+               span[*u - 0x20] = true;
+         }
+         break;
+      case Class:
+         w = class_width(atom, span);
+         break;
+      case Group: case Atomic:
+         w = core_width(atom_group(atom), span);
+         break;
+      case LookAhead: case WordAnchor: case EdgeAnchor:
+         return w;
+      default:    // backreferences and subroutine calls
+         w.max = -1;
+         memset(span, true, 256 * sizeof(bool));
+         break;
+   }
+   return repeat_width(w, atom_get_range(atom));
+}
+
+/** core_width
+  *
+  * Width of the shortest and longest branch of a core. Add the bytes
+  * the core can match to span.
+  */
+static width_t core_width(core_t* core, bool* span) {
+   width_t w = { MAXWIDTH, 0 };
+   for (branch_t* b = core_first_branch(core); b; b = branch_next(b)) {
+      width_t bw = { 0, 0 };
+      for (int i = 0; i < branch_size(b); ++i)
+         bw = add_width(bw, atom_width(branch_atom(b, i), span));
+      if (bw.min < w.min)
+         w.min = bw.min;
+      if (w.max >= 0 && (bw.max < 0 || bw.max > w.max))
+         w.max = bw.max;
+   }
+   return w;
+}
+
+/***************************public functions*************************/
+
+litset_t* literal_alternation(core_t* core, int* group) {
+   assert(core && group);
+   *group = 0;
+   if (count_strings(core) < 2) {
+      core = unwrap(core, group);
+      if (count_strings(core) < 2)
+         return NULL;
+   }
+   int n = 0;
+   char** literals = malloc(count_strings(core) * sizeof(char*));
+   bool* caseless = malloc(count_strings(core) * sizeof(bool));
+   assert(literals && caseless);
+   for (branch_t* b = core_first_branch(core); b; b = branch_next(b)) {
+      caseless[n] = atom_caseless(branch_atom(b, 0));
+      literals[n++] = atom_string(branch_atom(b, 0));
+   }
+   litset_t* set = litset_new(literals, caseless, n);
+   free(literals);
+   free(caseless);
+   return set;
+}
+
+strsearch_t* literal_whole(core_t* core, int* group) {
+   assert(core && group);
+   core = unwrap(core, group);
+   if (count_strings(core) != 1)
+      return NULL;
+   atom_t* atom = branch_atom(core_first_branch(core), 0);
+   return strsearch_new(atom_string(atom), atom_caseless(atom));
+}
+
+litset_t* literal_prefixes(core_t* core) {
+   assert(core);
+   char* literals[MAXPREFIXES];
+   bool caseless[MAXPREFIXES];
+   int n = 0;
+   if (!add_prefixes(core, literals, caseless, &n))
+      return NULL;
+   return litset_new(literals, caseless, n);
+}
+
+inner_t* literal_inner(core_t* core) {
+   assert(core);
+   int group;
+   core = unwrap(core, &group);
+   branch_t* branch = core_first_branch(core);
+   if (branch_next(branch))
+      return NULL;
+
+   // use the longest literal that's matched exactly once
+   int best = -1, bestlen = 0;
+   for (int i = 0; i < branch_size(branch); ++i) {
+      atom_t* atom = branch_atom(branch, i);
+      urange32_t range = atom_get_range(atom);
+      if (atom_string(atom) && range.lo == 1 && range.hi == 1
+                        && (int) strlen(atom_string(atom)) > bestlen) {
+         best = i;
+         bestlen = strlen(atom_string(atom));
+      }
+   }
+   if (best < 0)
+      return NULL;
+
+   inner_t* obj = calloc(1, sizeof(inner_t));
+   assert(obj);
+   width_t w = { 0, 0 };
+   for (int i = 0; i < best; ++i)
+      w = add_width(w, atom_width(branch_atom(branch, i), obj->span));
+   obj->minpre = w.min;
+   obj->maxpre = w.max;
+   atom_t* atom = branch_atom(branch, best);
+   obj->search = strsearch_new(atom_string(atom), atom_caseless(atom));
+   return obj;
+}
+
+char* litset_search(litset_t* set, char* str, char* last, char** end) {
+   assert(set && str && last && end);
+   int which;
+   if (set->ahoc)
+      return ahoc_search(set->ahoc, str, last, end, &which);
+   char* begin = teddy_find(set->teddy, str, last, &which);
+   if (begin)
+      *end = begin + teddy_length(set->teddy, which);
+   return begin;
+}
+
+int litset_reach(litset_t* set) {
+   assert(set);
+   return set->longest;
+}
+
+size_t litset_bytes(litset_t* set) {
+   assert(set);
+   if (set->ahoc)
+      return sizeof(litset_t) + ahoc_bytes(set->ahoc);
+   return sizeof(litset_t) + teddy_bytes(set->teddy);
+}
+
+void litset_free(litset_t* set) {
+   if (set) {
+      teddy_free(set->teddy);
+      ahoc_free(set->ahoc);
+      free(set);
+   }
+}
+
+char* inner_window(inner_t* obj, char* str, char* last, char** hi) {
+   assert(obj && str && last && hi);
+   for (char* at = str + obj->minpre; at < last; ) {
+      char* found = strsearch_find(obj->search, at, last);
+      if (!found)
+         return NULL;
+      char* lo = str;
+      if (obj->maxpre >= 0 && found - lo > obj->maxpre)
+         lo = found - obj->maxpre;
+
+      // walk backwards over bytes that can precede the literal
+      char* back = found;
+      while (back > lo && obj->span[(unsigned char) back[-1]])
+         --back;
+      *hi = found - obj->minpre;
+      if (back <= *hi)
+         return back;
+      at = found + 1;
+   }
+   return NULL;
+}
+
+int inner_reach(inner_t* obj) {
+   assert(obj);
+   if (obj->maxpre < 0)
+      return -1;
+   return obj->maxpre + strsearch_length(obj->search);
+}
+
+size_t inner_bytes(inner_t* obj) {
+   assert(obj);
+   return sizeof(inner_t) + strsearch_bytes(obj->search);
+}
+
+void inner_free(inner_t* obj) {
+   if (obj) {
+      strsearch_free(obj->search);
+      free(obj);
+   }
+}
+
+/********************************************************************/
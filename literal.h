@@ -0,0 +1,138 @@
+/* literal.h
+ *
+ * Looks for literal strings in a finished core that can be used to
+ * search faster than trying the backtracking core at every position
+ * of the input string.
+ */
+
+#ifndef __regex_literal
+#define __regex_literal
+
+#include "core.h"
+#include "strsearch.h"
+
+/* litset
+ *
+ * A set of literals that are searched for together. A small set is
+ * searched with the packed Teddy search, and a larger one with an
+ * Aho-Corasick automaton. Only a small set can hold literals that
+ * ignore case.
+ */
+typedef struct _litset litset_t;
+
+/* inner
+ *
+ * A literal that every match of a pattern must contain, along with
+ * what is known about the part of the match that comes before the
+ * literal: bounds on its length, and the set of bytes it can
+ * contain. Used to skip over the parts of the input string where no
+ * match can begin.
+ */
+typedef struct _inner inner_t;
+
+/** alternation
+  *
+  * If the core is an alternation of literals, like 'foo|bar|baz',
+  * or a single group holding such an alternation, like
+  * '(foo|bar|baz)', return a literal set that finds the same matches
+  * as the core. In the group case, *group is set to the
+  * index of the group, which is -1 for a non-capturing group;
+  * otherwise it's set to 0. Return NULL if the core isn't an
+  * alternation of literals.
+  */
+litset_t* literal_alternation(core_t*, int* group);
+
+/** whole
+  *
+  * If the core is a single literal, like 'hello' or '\Qa.b\E', or
+  * a single group holding a single literal, like '(hello)', return a
+  * substring searcher for the literal. *group is set the same way as
+  * in literal_alternation. Return NULL if the core isn't a literal.
+  */
+strsearch_t* literal_whole(core_t*, int* group);
+
+/** prefixes
+  *
+  * If every match of the core must begin with one of a set of
+  * literals, like in '(GET|POST|PUT|DELETE) /api', return the set, or
+  * NULL if there's no such set. Each literal in the set comes from
+  * the first atom of a branch, after any zero-width assertions.
+  */
+litset_t* literal_prefixes(core_t*);
+
+/** inner
+  *
+  * If every match of the core must contain a literal, return an
+  * object describing it, or NULL if there's no such literal. The
+  * literal doesn't have to be at the beginning of the match; in
+  * '\w+@corp\.example\.com' the literal is '@corp.example.com'.
+  */
+inner_t* literal_inner(core_t*);
+
+/** litset_search
+  *
+  * Find the leftmost-first occurrence of any literal in the set: the
+  * one that begins closest to the front of the input, and of the
+  * literals that occur there, the one from the earliest branch. The
+  * second argument is the first position to consider, and the third
+  * points at the null terminating character. Return a pointer to the
+  * beginning of the occurrence and set *end to one after its end, or
+  * return NULL if none of the literals occur.
+  */
+char* litset_search(litset_t*, char*, char*, char** end);
+
+/** litset_reach
+  *
+  * Get the length of the longest literal in the set. An occurrence
+  * that begins before a position p is found by a search whose third
+  * argument is p plus the reach, less one.
+  */
+int litset_reach(litset_t*);
+
+/** litset_bytes
+  *
+  * Get the number of bytes of memory used by the set.
+  */
+size_t litset_bytes(litset_t*);
+
+/** litset_free
+  *
+  * Deallocate the set.
+  */
+void litset_free(litset_t*);
+
+/** inner_window
+  *
+  * Find the next window of positions where a match could begin. The
+  * second argument is the first position to consider, and the third
+  * points at the null terminating character. Finds the next
+  * occurrence of the literal, then walks backwards from it over bytes
+  * that can come before the literal in a match. Return the first
+  * position of the window and set *hi to the last, or return NULL if
+  * no match can begin at or after the given position. No match can
+  * begin between the given position and the window.
+  */
+char* inner_window(inner_t*, char*, char*, char** hi);
+
+/** inner_reach
+  *
+  * Get the most bytes that a match can span from its beginning to
+  * the end of the literal, or -1 if there's no bound. A window for
+  * every match that begins before a position p is found by searching
+  * up to p plus the reach, less one.
+  */
+int inner_reach(inner_t*);
+
+/** inner_bytes
+  *
+  * Get the number of bytes of memory used by the object.
+  */
+size_t inner_bytes(inner_t*);
+
+/** inner_free
+  *
+  * Deallocate the object.
+  */
+void inner_free(inner_t*);
+
+#endif
@@ -1,75 +1,354 @@
-/* regex tester program
+/* regex command line program
  *
- * Use the command "NEW" to enter a new regular expression.
+ * Search files for lines that match a regular expression, like grep.
+ *
+ *    regex [-cilnor] pattern [file...]
+ *
+ *    -c    print the number of matching lines of each file
+ *    -i    ignore case
+ *    -l    print the names of the files that have a matching line
+ *    -n    print the line number before each line
+ *    -o    print each match on a line of its own, instead of the line
+ *    -r    search the files under directories
+ *
+ * With no files, standard input is searched, or with -r the current
+ * directory. Files are mapped into memory and searched with
+ * shre_search_lines, and several files are searched at once, one on
+ * each worker of the engine's pool. The output of each file is
+ * collected and printed in the order the files were given. Exits
+ * with 0 if a line matched, 1 if none did, and 2 if there was an
+ * error.
  */
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <assert.h>
+#include <stdbool.h>
 #include <string.h>
+#include <assert.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 #include "shre.h"
 #include "shre_errno.h"
+#include "pool.h"
+
+// Files searched by one job of the pool, for each worker, so that
+//   output doesn't pile up while there are many files to go.
+#define FILES_PER_WORKER 16
 
-#define BUFFER 12000
+/* options
+ *
+ * The options given on the command line.
+ */
+typedef struct {
+   bool count;
+   bool caseless;
+   bool names;
+   bool numbers;
+   bool only;
+   bool recursive;
+   bool prefix;      // print the file name before each line
+} options_t;
 
-char buf[BUFFER];
-pattern_t* shre;
-match_t* match;
+/* file
+ *
+ * A file to search, and what searching it printed.
+ */
+typedef struct {
+   char* path;       // NULL for standard input
+   char* out;
+   size_t outlen;
+   bool matched;
+   bool failed;
+} file_t;
 
-void trim(char* str) {
-   if (*str != '\0') {
-      while (*(++str) != '\0');
-      if (*(str-1) == '\n') {
-         *(str-1) = '\0';
-      }
+/* job
+ *
+ * The argument of the pool's job: files to search.
+ */
+typedef struct {
+   pattern_t* pattern;
+   options_t* opts;
+   file_t* files;
+} job_t;
+
+/** list_add
+  *
+  * Add a file to the end of a list.
+  */
+static void list_add(file_t** list, size_t* n, size_t* cap, char* path) {
+   if (*n == *cap) {
+      *cap = *cap ? *cap * 2 : 64;
+      *list = realloc(*list, *cap * sizeof(file_t));
+      assert(*list);
    }
+   memset(&(*list)[*n], 0, sizeof(file_t));
+   (*list)[(*n)++].path = path;
 }
 
-void do_test() {
-Start:
-   if (isatty(fileno(stdin)))
-      printf("Enter a regular expression:\n\n");
-   if (fgets(buf, BUFFER, stdin) == NULL)
+/** walk
+  *
+  * Add the regular files under a directory to a list, in the order
+  * that the directory lists them. Symbolic links aren't followed. A
+  * NULL directory is the current one, whose files are named without
+  * a directory in front.
+  */
+static void walk(char* dir, file_t** list, size_t* n, size_t* cap) {
+   DIR* d = opendir(dir ? dir : ".");
+   if (!d) {
+      fprintf(stderr, "regex: %s: cannot open directory\n",
+                                           dir ? dir : ".");
       return;
-   trim(buf);
-   if ((shre = shre_compile(buf)) == NULL) {
-      printf("error: %s\n", shre_strerror(shre_er));
-      goto Start;
    }
-   if (isatty(fileno(stdin)))
-      printf("\nEnter text to test the regular expression:\n\n");
-   while (fgets(buf, BUFFER, stdin) != NULL) {
-      trim(buf);
-      if (strcmp(buf, "NEW") == 0) {
-         goto Start;
+   struct dirent* ent;
+   while ((ent = readdir(d))) {
+      if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, ".."))
+         continue;
+      char* path;
+      if (dir) {
+         path = malloc(strlen(dir) + strlen(ent->d_name) + 2);
+         assert(path);
+         sprintf(path, "%s/%s", dir, ent->d_name);
+      } else {
+         path = strdup(ent->d_name);
+         assert(path);
       }
-      printf("Pattern:  '%s'\n", shre_expression(shre));
-      printf("String:   '%s'\n", buf);
-      printf("Match:    ");
-      if ((match = shre_search(shre, buf)) == NULL) {
-         printf(" None\n\n");
+      struct stat st;
+      if (lstat(path, &st) < 0 || !(S_ISREG(st.st_mode)
+                                  || S_ISDIR(st.st_mode))) {
+         free(path);
+      } else if (S_ISDIR(st.st_mode)) {
+         walk(path, list, n, cap);
+         free(path);
       } else {
-         printf("'%s'\n", match_get(match));
-         for (int i = 1; i < match_num_groups(match); ++i) {
-            printf("Group %2d: ", i);
-            char* str = match_group(match, i);
-            if (!str) {
-               printf(" NULL\n");
-            } else {
-               printf("'%s'\n", str);
-               free(str);
+         list_add(list, n, cap, path);
+      }
+   }
+   closedir(d);
+}
+
+/** read_all
+  *
+  * Read a file descriptor that can't be mapped, like a pipe, into
+  * memory. Set *len to the number of bytes read.
+  */
+static char* read_all(int fd, size_t* len) {
+   size_t cap = 1 << 16;
+   char* buf = malloc(cap);
+   assert(buf);
+   *len = 0;
+   ssize_t got;
+   while ((got = read(fd, buf + *len, cap - *len)) > 0) {
+      *len += got;
+      if (*len == cap) {
+         cap *= 2;
+         buf = realloc(buf, cap);
+         assert(buf);
+      }
+   }
+   return buf;
+}
+
+/** name
+  *
+  * Get the name to print for a file.
+  */
+static const char* name(file_t* file) {
+   return file->path ? file->path : "(standard input)";
+}
+
+/** print_line
+  *
+  * Print the prefix of a line of output, then the given text.
+  */
+static void print_line(FILE* out, options_t* opts, file_t* file,
+                       size_t number, char* text, size_t len) {
+   if (opts->prefix)
+      fprintf(out, "%s:", name(file));
+   if (opts->numbers)
+      fprintf(out, "%zu:", number);
+   fwrite(text, 1, len, out);
+   fputc('\n', out);
+}
+
+/** print_matches
+  *
+  * Print each match in a line on a line of its own. Empty matches
+  * aren't printed.
+  */
+static void print_matches(FILE* out, pattern_t* pattern, options_t* opts,
+                  file_t* file, size_t number, char* line, size_t len) {
+   char* copy = malloc(len + 1);
+   assert(copy);
+   memcpy(copy, line, len);
+   copy[len] = '\0';
+   scanner_t* sc = scan_new(pattern, copy);
+   match_t* match;
+   while ((match = scan_next(sc))) {
+      char* text = match_get(match);
+      size_t n = strlen(text);
+      if (n)
+         print_line(out, opts, file, number, text, n);
+      free(text);
+      match_free(match);
+      if (!n && scan_tell(sc) == len)
+         break;
+   }
+   free(sc);
+   free(copy);
+}
+
+/** search_buffer
+  *
+  * Search the contents of a file, printing the output to out.
+  */
+static void search_buffer(job_t* job, file_t* file, FILE* out,
+                                          char* buf, size_t len) {
+   options_t* opts = job->opts;
+   span_t* lines;
+   size_t n = shre_search_lines(job->pattern, buf, len, &lines);
+   file->matched = n > 0;
+   if (opts->names) {
+      if (n)
+         fprintf(out, "%s\n", name(file));
+   } else if (opts->count) {
+      if (opts->prefix)
+         fprintf(out, "%s:", name(file));
+      fprintf(out, "%zu\n", n);
+   } else if (n && memchr(buf, '\0', len)) {
+      fprintf(out, "Binary file %s matches\n", name(file));
+   } else {
+      size_t number = 1;
+      char* counted = buf;   // line numbers are counted up to here
+      for (size_t i = 0; i < n; ++i) {
+         char* line = buf + lines[i].begin;
+         size_t size = lines[i].end - lines[i].begin;
+         if (opts->numbers) {
+            char* nl;
+            while ((nl = memchr(counted, '\n', line - counted))) {
+               ++number;
+               counted = nl + 1;
             }
+            counted = line;
          }
-         printf("\n");
-         match_free(match);
+         if (opts->only)
+            print_matches(out, job->pattern, opts, file, number,
+                                                      line, size);
+         else
+            print_line(out, opts, file, number, line, size);
+      }
+   }
+   free(lines);
+}
+
+/** search_file
+  *
+  * Task of the pool's job: search a file.
+  */
+static void search_file(void* arg, int i, int worker) {
+   (void) worker;
+   job_t* job = arg;
+   file_t* file = &job->files[i];
+   FILE* out = open_memstream(&file->out, &file->outlen);
+   assert(out);
+
+   int fd = file->path ? open(file->path, O_RDONLY) : STDIN_FILENO;
+   struct stat st;
+   if (fd < 0 || fstat(fd, &st) < 0) {
+      fprintf(stderr, "regex: %s: cannot open file\n", name(file));
+      file->failed = true;
+   } else if (S_ISDIR(st.st_mode)) {
+      fprintf(stderr, "regex: %s: is a directory\n", name(file));
+      file->failed = true;
+   } else if (S_ISREG(st.st_mode) && st.st_size > 0) {
+      char* buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (buf == MAP_FAILED) {
+         fprintf(stderr, "regex: %s: cannot map file\n", name(file));
+         file->failed = true;
+      } else {
+         madvise(buf, st.st_size, MADV_SEQUENTIAL);
+         search_buffer(job, file, out, buf, st.st_size);
+         munmap(buf, st.st_size);
       }
+   } else {
+      size_t len;
+      char* buf = read_all(fd, &len);
+      search_buffer(job, file, out, buf, len);
+      free(buf);
    }
+   if (file->path && fd >= 0)
+      close(fd);
+   fclose(out);
 }
 
-int main() {
+/** usage
+  *
+  * Print how to use the program and exit.
+  */
+static void usage() {
+   fprintf(stderr, "usage: regex [-cilnor] pattern [file...]\n");
+   exit(2);
+}
+
+int main(int argc, char** argv) {
+   options_t opts = { 0 };
+   int c;
+   while ((c = getopt(argc, argv, "cilnor")) != -1) {
+      switch (c) {
+         case 'c': opts.count = true;     break;
+         case 'i': opts.caseless = true;  break;
+         case 'l': opts.names = true;     break;
+         case 'n': opts.numbers = true;   break;
+         case 'o': opts.only = true;      break;
+         case 'r': opts.recursive = true; break;
+         default:  usage();
+      }
+   }
+   if (optind >= argc)
+      usage();
+
    start_regex_engine();
-   do_test();
+   pattern_t* pattern = shre_compile_flags(argv[optind++],
+                                  opts.caseless ? SHRE_CASELESS : 0);
+   if (!pattern) {
+      fprintf(stderr, "regex: %s\n", shre_strerror(shre_er));
+      return 2;
+   }
+
+   file_t* files = NULL;
+   size_t n = 0, cap = 0;
+   if (optind == argc && opts.recursive)
+      walk(NULL, &files, &n, &cap);
+   else if (optind == argc)
+      list_add(&files, &n, &cap, NULL);
+   for (int i = optind; i < argc; ++i) {
+      struct stat st;
+      if (opts.recursive && stat(argv[i], &st) == 0 && S_ISDIR(st.st_mode))
+         walk(argv[i], &files, &n, &cap);
+      else
+         list_add(&files, &n, &cap, strdup(argv[i]));
+   }
+   opts.prefix = argc - optind > 1 || opts.recursive;
+
+   pool_t* pool = pool_shared();
+   size_t batch = pool_workers(pool) * FILES_PER_WORKER;
+   job_t job = { pattern, &opts, files };
+   bool matched = false, failed = false;
+   for (size_t lo = 0; lo < n; lo += batch) {
+      size_t hi = lo + batch < n ? lo + batch : n;
+      job.files = files + lo;
+      pool_run(pool, search_file, &job, hi - lo);
+      for (size_t i = lo; i < hi; ++i) {
+         fwrite(files[i].out, 1, files[i].outlen, stdout);
+         matched |= files[i].matched;
+         failed |= files[i].failed;
+         free(files[i].out);
+         free(files[i].path);
+      }
+   }
+   free(files);
    cleanup_regex_engine();
-   return 0;
+   return failed ? 2 : matched ? 0 : 1;
 }
@@ -0,0 +1,473 @@
+/* regex micro-benchmark program
+ *
+ * Time the building blocks that searches spend their time in, each
+ * on its own, away from the rest of the engine.
+ *
+ *    regex-microbench [-c before] [bench...]
+ *
+ * The benches are:
+ *
+ *    class      class_search, on classes of a growing number of ranges
+ *    u8         u8_decode, on ASCII text and on CJK text
+ *    bts        bts_push and bts_pop, on stacks of growing depth
+ *    range      range_new and range_copy, for growing numbers of groups
+ *    obhash     obhash_find, for keys that are there and keys that
+ *               aren't, in tables of growing size
+ *    string     match_string, through atom_match on a string atom, by
+ *               the length of the string
+ *
+ * Each case is run until enough time has passed, and is printed as a
+ * line of JSON with the nanoseconds each operation takes. Given the
+ * output of an earlier run with -c, each line also has the time the
+ * case took then and the speedup since, so a change to one of these
+ * modules can be checked against the code it replaces.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+#include <unistd.h>
+#include <time.h>
+#include "class.h"
+#include "u8_translate.h"
+#include "bts.h"
+#include "range.h"
+#include "obhash.h"
+#include "atom.h"
+#include "util.h"
+
+// Each case runs for at least this many seconds.
+#define MINTIME 0.2
+
+// The number of operations in one run of a case.
+#define OPS 4096
+
+/* case
+ *
+ * The function that runs a case once. It returns a value that depends
+ * on the work it did, so the work can't be left out by the compiler.
+ */
+typedef long (*case_f)(void*);
+
+/* before
+ *
+ * The lines of an earlier run's output.
+ */
+static char** before = NULL;
+static int nbefore = 0;
+
+// Results are added up here so they're used.
+static volatile long sink;
+
+/********************************measuring***************************/
+
+static double now() {
+   struct timespec t;
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/** earlier
+  *
+  * Find the nanoseconds per operation of a case in the earlier run,
+  * or return a negative number if it wasn't run.
+  */
+static double earlier(const char* bench, const char* name) {
+   char key[128];
+   snprintf(key, sizeof(key), "{\"bench\":\"%s\",\"case\":\"%s\",",
+                                                     bench, name);
+   for (int i = 0; i < nbefore; ++i) {
+      if (strncmp(before[i], key, strlen(key)))
+         continue;
+      char* ns = strstr(before[i], "\"ns_per_op\":");
+      if (ns)
+         return atof(ns + strlen("\"ns_per_op\":"));
+   }
+   return -1;
+}
+
+/** measure
+  *
+  * Run a case once to warm up, then enough more times to take MINTIME
+  * seconds, and print the time of each of its operations.
+  */
+static void measure(const char* bench, const char* name, case_f run,
+                                              void* arg, long ops) {
+   sink += run(arg);
+   int reps = 0;
+   double start = now();
+   do {
+      sink += run(arg);
+      ++reps;
+   } while (now() - start < MINTIME);
+   double ns = (now() - start) / reps / ops * 1e9;
+   printf("{\"bench\":\"%s\",\"case\":\"%s\",\"ops\":%ld,"
+          "\"ns_per_op\":%.3f", bench, name, ops, ns);
+   double then = earlier(bench, name);
+   if (then > 0)
+      printf(",\"before_ns_per_op\":%.3f,\"speedup\":%.3f", then,
+                                                        then / ns);
+   printf("}\n");
+   fflush(stdout);
+}
+
+/** load
+  *
+  * Read the output of an earlier run.
+  */
+static void load(const char* path) {
+   FILE* file = fopen(path, "r");
+   if (!file) {
+      fprintf(stderr, "regex-microbench: %s: cannot open file\n", path);
+      exit(2);
+   }
+   char* line = NULL;
+   size_t cap = 0;
+   while (getline(&line, &cap, file) > 0) {
+      before = realloc(before, (nbefore + 1) * sizeof(char*));
+      assert(before);
+      before[nbefore++] = strdup(line);
+   }
+   free(line);
+   fclose(file);
+}
+
+/*********************************classes****************************/
+
+/* class case
+ *
+ * A class, and the codepoints to look for in it. About half of them
+ * are in the class.
+ */
+typedef struct {
+   class_t* class;
+   uint32_t points[OPS];
+} class_case_t;
+
+static long run_class(void* arg) {
+   class_case_t* c = arg;
+   long found = 0;
+   for (int i = 0; i < OPS; ++i)
+      found += class_search(c->class, c->points[i]);
+   return found;
+}
+
+/** bench_class
+  *
+  * Search classes of ranges 8 codepoints wide and 16 apart.
+  */
+static void bench_class() {
+   for (int n = 1; n <= 1024; n *= 4) {
+      urange32_t* ranges = malloc(n * sizeof(urange32_t));
+      assert(ranges);
+      for (int i = 0; i < n; ++i) {
+         ranges[i].lo = 0x20 + i * 16;
+         ranges[i].hi = ranges[i].lo + 7;
+      }
+      class_case_t* c = malloc(sizeof(class_case_t));
+      assert(c);
+      c->class = class_from_ranges(ranges, n);
+      srand(n);
+      for (int i = 0; i < OPS; ++i)
+         c->points[i] = 0x20 + rand() % (n * 16);
+      char name[32];
+      sprintf(name, "ranges=%d", n);
+      measure("class", name, run_class, c, OPS);
+      class_free(c->class);
+      free(c);
+      free(ranges);
+   }
+}
+
+/**********************************decoding**************************/
+
+static long run_u8(void* arg) {
+   char* str = arg;
+   long sum = 0;
+   while (*str) {
+      u8cdpnt_t* cp = u8_decode(str);
+      sum += u8_deref(cp);
+      str = u8_end(cp);
+      free(cp);
+   }
+   return sum;
+}
+
+/** bench_u8
+  *
+  * Decode OPS characters of ASCII, and then of CJK ideographs, which
+  * take three bytes each.
+  */
+static void bench_u8() {
+   char* text = malloc(3 * OPS + 1);
+   assert(text);
+   char* write = text;
+   for (int i = 0; i < OPS; ++i)
+      *write++ = 'a' + i % 26;
+   *write = '\0';
+   measure("u8", "ascii", run_u8, text, OPS);
+
+   write = text;
+   for (int i = 0; i < OPS; ++i) {
+      uint32_t codepoint = 0x4E00 + (i * 7919) % 0x5200;
+      *write++ = 0xE0 | codepoint >> 12;
+      *write++ = 0x80 | (codepoint >> 6 & 0x3F);
+      *write++ = 0x80 | (codepoint & 0x3F);
+   }
+   *write = '\0';
+   measure("u8", "cjk", run_u8, text, OPS);
+   free(text);
+}
+
+/**********************************stacks****************************/
+
+/* stack case
+ *
+ * A stack, and how deep to push it before popping it empty.
+ */
+typedef struct {
+   bts_t* stack;
+   int depth;
+} stack_case_t;
+
+static long run_bts(void* arg) {
+   static char str[] = "";
+   stack_case_t* c = arg;
+   long sum = 0;
+   for (int round = 0; round < OPS / c->depth / 2; ++round) {
+      for (int i = 0; i < c->depth; ++i)
+         bts_push(c->stack, i, str, i, false, NULL, 0);
+      while (!bts_empty(c->stack)) {
+         sum += bts_top(c->stack)->index;
+         bts_pop(c->stack);
+      }
+   }
+   return sum;
+}
+
+/** bench_bts
+  *
+  * Push and pop stacks of growing depth. A push and a pop are each an
+  * operation.
+  */
+static void bench_bts() {
+   for (int depth = 4; depth <= 2048; depth *= 8) {
+      stack_case_t c = { bts_new(), depth };
+      char name[32];
+      sprintf(name, "depth=%d", depth);
+      measure("bts", name, run_bts, &c, OPS / depth / 2 * depth * 2);
+      bts_free(c.stack);
+   }
+}
+
+/**********************************ranges****************************/
+
+/* range case
+ *
+ * The number of groups to make ranges of, and a range to copy.
+ */
+typedef struct {
+   int groups;
+   range_t* range;
+} range_case_t;
+
+static long run_range_new(void* arg) {
+   range_case_t* c = arg;
+   long sum = 0;
+   for (int i = 0; i < OPS; ++i) {
+      range_t* range = range_new(c->groups);
+      sum += range_size(range);
+      range_free(range);
+   }
+   return sum;
+}
+
+static long run_range_copy(void* arg) {
+   range_case_t* c = arg;
+   long sum = 0;
+   for (int i = 0; i < OPS; ++i) {
+      range_t* range = range_copy(c->range);
+      sum += range_size(range);
+      range_free(range);
+   }
+   return sum;
+}
+
+/** bench_range
+  *
+  * Make and copy ranges of growing numbers of groups. Making or
+  * copying a range and freeing it is an operation.
+  */
+static void bench_range() {
+   for (int groups = 1; groups <= 64; groups *= 4) {
+      range_case_t c = { groups, range_new(groups) };
+      char name[32];
+      sprintf(name, "new groups=%d", groups);
+      measure("range", name, run_range_new, &c, OPS);
+      sprintf(name, "copy groups=%d", groups);
+      measure("range", name, run_range_copy, &c, OPS);
+      range_free(c.range);
+   }
+}
+
+/*******************************hash tables**************************/
+
+/* table case
+ *
+ * A table, and the keys to look for in it.
+ */
+typedef struct {
+   obhash_t* table;
+   char* keys[OPS];
+} table_case_t;
+
+static long run_obhash(void* arg) {
+   table_case_t* c = arg;
+   long found = 0;
+   for (int i = 0; i < OPS; ++i)
+      found += obhash_find(c->table, c->keys[i]) != NULL;
+   return found;
+}
+
+/** bench_obhash
+  *
+  * Look for keys that are in tables of growing size, and then for
+  * keys that aren't.
+  */
+static void bench_obhash() {
+   static int object;
+   for (int size = 16; size <= 4096; size *= 16) {
+      table_case_t* c = malloc(sizeof(table_case_t));
+      assert(c);
+      c->table = obhash_new(NULL);
+      char key[32];
+      for (int i = 0; i < size; ++i) {
+         sprintf(key, "group_%d", i);
+         obhash_add(c->table, strdup(key), &object);
+      }
+      for (int i = 0; i < OPS; ++i) {
+         sprintf(key, "group_%d", i % size);
+         c->keys[i] = strdup(key);
+      }
+      char name[32];
+      sprintf(name, "hit size=%d", size);
+      measure("obhash", name, run_obhash, c, OPS);
+      for (int i = 0; i < OPS; ++i) {
+         sprintf(key, "missing_%d", i);
+         free(c->keys[i]);
+         c->keys[i] = strdup(key);
+      }
+      sprintf(name, "miss size=%d", size);
+      measure("obhash", name, run_obhash, c, OPS);
+      for (int i = 0; i < OPS; ++i)
+         free(c->keys[i]);
+      obhash_free(c->table);
+      free(c);
+   }
+}
+
+/**********************************strings***************************/
+
+/* string case
+ *
+ * A string atom, a stack to run it on, and an input that it matches.
+ */
+typedef struct {
+   atom_t* atom;
+   bts_t* stack;
+   char* input;
+} string_case_t;
+
+static long run_string(void* arg) {
+   string_case_t* c = arg;
+   long sum = 0;
+   for (int i = 0; i < OPS; ++i) {
+      bts_push(c->stack, 0, c->input, 0, false, NULL, 0);
+      atom_match(c->atom, c->stack, NULL, c->input);
+      sum += bts_top(c->stack)->str - c->input;
+      bts_pop(c->stack);
+   }
+   return sum;
+}
+
+/** bench_string
+  *
+  * Match strings of growing length. Each match is one call to
+  * atom_match, which pops the stack and pushes the end of the match.
+  */
+static void bench_string() {
+   for (int len = 1; len <= 256; len *= 4) {
+      char* string = malloc(len + 1);
+      assert(string);
+      for (int i = 0; i < len; ++i)
+         string[i] = 'a' + i % 26;
+      string[len] = '\0';
+      string_case_t c = { atom_new(0), bts_new(), strdup(string) };
+      atom_set_string(c.atom, string);
+      char name[32];
+      sprintf(name, "length=%d", len);
+      measure("string", name, run_string, &c, OPS);
+      atom_free(c.atom);
+      bts_free(c.stack);
+      free(c.input);
+   }
+}
+
+/********************************************************************/
+
+/* bench
+ *
+ * A bench and the function that runs its cases.
+ */
+typedef struct {
+   const char* name;
+   void (*run)();
+} bench_t;
+
+static const bench_t benches[] = {
+   { "class",  bench_class },
+   { "u8",     bench_u8 },
+   { "bts",    bench_bts },
+   { "range",  bench_range },
+   { "obhash", bench_obhash },
+   { "string", bench_string },
+   { NULL, NULL }
+};
+
+/** wanted
+  *
+  * Check if a bench was asked for on the command line. All of them
+  * are run if none were.
+  */
+static bool wanted(const char* bench, char** names, int n) {
+   if (n == 0)
+      return true;
+   for (int i = 0; i < n; ++i) {
+      if (!strcmp(names[i], bench))
+         return true;
+   }
+   return false;
+}
+
+int main(int argc, char** argv) {
+   int c;
+   while ((c = getopt(argc, argv, "c:")) != -1) {
+      switch (c) {
+         case 'c': load(optarg); break;
+         default:
+            fprintf(stderr, "usage: regex-microbench [-c before] "
+                            "[bench...]\n");
+            return 2;
+      }
+   }
+   for (const bench_t* bench = benches; bench->name; ++bench) {
+      if (wanted(bench->name, argv + optind, argc - optind))
+         bench->run();
+   }
+   for (int i = 0; i < nbefore; ++i)
+      free(before[i]);
+   free(before);
+   return 0;
+}
@@ -1,6 +1,13 @@
 /* obhash.c
  *
- * Implementation of generic string hashtable.
+ * Implementation of generic string hashtable. The table uses open
+ * addressing with Robin Hood linear probing: when an entry that is
+ * being placed has come further from its home slot than the entry
+ * sitting in a slot, the two trade places. This keeps probe
+ * sequences short, and lets a lookup stop as soon as it reaches an
+ * entry that is closer to home than the key would be. Each slot
+ * keeps the full hash of its key, so most mismatches are rejected
+ * without touching the key.
  */
 
 #include <stdlib.h>
@@ -12,155 +19,134 @@
 #include "util.h"
 
 
-#define TABLESIZE 7
+// Initial number of slots. Must be a power of two.
+#define TABLESIZE 8
 
-typedef struct _hnode hnode_t;
-
-struct _obhash {
-   void (*obfree)(void*);
-   hnode_t** chains;
-   int size;
-   int load;
-};
-
-/* hnode
+/* slot
  *
- * Node that holds an object, a key, and a pointer to another node.
+ * A slot in the table. The slot is empty if key is NULL.
  */
-struct _hnode {
-   hnode_t* next;
+typedef struct {
+   uint32_t hash;
    char* key;
    void* obj;
+} slot_t;
+
+struct _obhash {
+   void (*obfree)(void*);
+   slot_t* slots;
+   int size;            // number of slots; a power of two
+   int load;
 };
 
 
 /**************************static functions**************************/
 
-/** free_chains
+/** distance
   *
-  * Deallocates all of the nodes in array of nodes, including the
-  * objects and keys, but doesn't free the array itself.
+  * How far the slot at index i is from the home slot of the hash.
   */
-static void free_chains(hnode_t** chains,
-                               int size, void (*obfree)(void*)) {
-   for (int i = 0; i < size; ++i) {
-      hnode_t* node = chains[i];
-      while (node) {
-         hnode_t* next = node->next;
-         if (obfree)
-            obfree(node->obj);
-         free(node->key);
-         free(node);
-         node = next;
-      }
-      chains[i] = NULL;
-   }
+static inline int distance(obhash_t* table, uint32_t hash, int i) {
+   return (i - (int) (hash & (table->size - 1))) & (table->size - 1);
 }
 
-/** hnode_new
+/** place
   *
-  * Make a new hnode and tree the next field to NULL. Returns the
-  * new node.
+  * Put an entry whose key isn't in the table into the table.
   */
-static hnode_t* hnode_new(char* key, void* obj) {
-   hnode_t* newnode = malloc(sizeof(hnode_t));
-   assert(newnode);
-   newnode->key = key;
-   newnode->obj = obj;
-   newnode->next = NULL;
-   return newnode;
+static void place(obhash_t* table, slot_t entry) {
+   int mask = table->size - 1;
+   int i = entry.hash & mask;
+   for (int dist = 0;; i = (i + 1) & mask, ++dist) {
+      slot_t* slot = &table->slots[i];
+      if (!slot->key) {
+         *slot = entry;
+         return;
+      }
+      int theirs = distance(table, slot->hash, i);
+      if (theirs < dist) {
+         slot_t displaced = *slot;
+         *slot = entry;
+         entry = displaced;
+         dist = theirs;
+      }
+   }
 }
 
-/** get_node
+/** lookup
   *
-  * For a given string return NULL if the bucket is empty. If a node is
-  * returned, then if the bool is set to true, it is the node
-  * containing the key. If false, then the node is the last in the
-  * chain, and doesn't contain the correct key.
+  * Return the slot holding the key, or NULL if the key isn't in the
+  * table.
   */
-static hnode_t* get_node(hnode_t** chains, int index,
-                                   char* key, bool* found) {
-   hnode_t* node = chains[index];
-   if (!node)
-      return NULL;
-   for (;; node = node->next) {
-      if (strcmp(key, node->key) == 0) {
-         *found = true;
-         return node;
-      }
-      if (!node->next)
-         break;
+static slot_t* lookup(obhash_t* table, uint32_t hash, char* key) {
+   int mask = table->size - 1;
+   int i = hash & mask;
+   for (int dist = 0;; i = (i + 1) & mask, ++dist) {
+      slot_t* slot = &table->slots[i];
+      if (!slot->key || distance(table, slot->hash, i) < dist)
+         return NULL;
+      if (slot->hash == hash && strcmp(slot->key, key) == 0)
+         return slot;
    }
-   *found = false;
-   return node;
 }
 
-/** add_to_chains
+/** expand_table
   *
-  * Add an object to the hnode array of chains. Return true if a new
-  * node is created.
+  * Double the number of slots in the table.
   */
-static bool add_to_chains(hnode_t** chains, int size,
-                        char* key, void* obj, void (*obfree)(void*)) {
-   bool found;
-   int i = strhash(key) % size;
-   hnode_t* node = get_node(chains, i, key, &found);
-   if (!node) {
-      chains[i] = hnode_new(key, obj);
-      return true;
-   } else if (found) {
-      if (obfree)
-         obfree(node->obj);
-      node->obj = obj;
-      return false;
-   } else {
-      node->next = hnode_new(key, obj);
-      return true;
+static void expand_table(obhash_t* table) {
+   slot_t* old = table->slots;
+   int oldsize = table->size;
+   table->size *= 2;
+   table->slots = calloc(table->size, sizeof(slot_t));
+   assert(table->slots);
+   for (int i = 0; i < oldsize; ++i) {
+      if (old[i].key)
+         place(table, old[i]);
    }
+   free(old);
 }
 
-/** expand_table
+/** free_slots
   *
-  * Double the internal array of the hash table.
+  * Free the keys and objects in every slot and mark the slots empty.
   */
-static void expand_table(obhash_t* table) {
-   int newsize = table->size * 2 + 1;
-   hnode_t** newchains = calloc(newsize, sizeof(hnode_t*));
-   assert(newchains);
+static void free_slots(obhash_t* table) {
    for (int i = 0; i < table->size; ++i) {
-      hnode_t* node = table->chains[i];
-      while (node) {
-         hnode_t* next = node->next;
-  (void) add_to_chains(newchains, newsize,
-                              node->key, node->obj, table->obfree);
-         free(node);
-         node = next;
+      slot_t* slot = &table->slots[i];
+      if (slot->key) {
+         if (table->obfree)
+            table->obfree(slot->obj);
+         free(slot->key);
+         slot->key = NULL;
       }
    }
-   free(table->chains);
-   table->chains = newchains;
-   table->size = newsize;
 }
 
 /**************************public functions**************************/
 
 void* obhash_find(obhash_t* table, char* key) {
    assert(table && key);
-   bool found = false;
-   int index = strhash(key) % table->size;
-   hnode_t* node = get_node(table->chains, index, key, &found);
-   if (found)
-      return node->obj;
-   return NULL;
+   slot_t* slot = lookup(table, strhash(key), key);
+   return slot ? slot->obj : NULL;
 }
 
 void obhash_add(obhash_t* table, char* key, void* obj) {
    assert(table && key);
-   if (table->load * 2 > table->size)
+   uint32_t hash = strhash(key);
+   slot_t* slot = lookup(table, hash, key);
+   if (slot) {
+      if (table->obfree)
+         table->obfree(slot->obj);
+      slot->obj = obj;
+      free(key);
+      return;
+   }
+   if ((table->load + 1) * 4 > table->size * 3)
       expand_table(table);
-   if (add_to_chains(table->chains, table->size,
-                                    key, obj, table->obfree))
-      ++table->load;
+   slot_t entry = { hash, key, obj };
+   place(table, entry);
+   ++table->load;
 }
 
 int obhash_size(obhash_t* table) {
@@ -168,9 +154,45 @@ int obhash_size(obhash_t* table) {
    return table->load;
 }
 
+size_t obhash_bytes(obhash_t* table) {
+   assert(table);
+   size_t bytes = sizeof(obhash_t) + table->size * sizeof(slot_t);
+   for (int i = 0; i < table->size; ++i) {
+      if (table->slots[i].key)
+         bytes += strlen(table->slots[i].key) + 1;
+   }
+   return bytes;
+}
+
+size_t obhash_pack(obhash_t* table, arena_t* arena, size_t objsize) {
+   assert(table);
+   size_t at = arena_alloc(arena, sizeof(obhash_t));
+   obhash_t* copy = arena_at(arena, at);
+   copy->obfree = NULL;
+   copy->size = table->size;
+   copy->load = table->load;
+   size_t slots = arena_alloc(arena, table->size * sizeof(slot_t));
+   arena_link(arena, at + offsetof(obhash_t, slots), slots);
+   for (int i = 0; i < table->size; ++i) {
+      slot_t* slot = &table->slots[i];
+      if (!slot->key)
+         continue;
+      size_t s = slots + i * sizeof(slot_t);
+      ((slot_t*) arena_at(arena, s))->hash = slot->hash;
+      arena_link(arena, s + offsetof(slot_t, key),
+                        arena_strdup(arena, slot->key));
+      if (objsize && slot->obj) {
+         size_t obj = arena_alloc(arena, objsize);
+         memcpy(arena_at(arena, obj), slot->obj, objsize);
+         arena_link(arena, s + offsetof(slot_t, obj), obj);
+      }
+   }
+   return at;
+}
+
 void obhash_clear(obhash_t* table) {
    assert(table);
-   free_chains(table->chains, table->size, table->obfree);
+   free_slots(table);
    table->load = 0;
 }
 
@@ -180,15 +202,15 @@ obhash_t* obhash_new(void (*obfree)(void*)) {
    table->obfree = obfree;
    table->size = TABLESIZE;
    table->load = 0;
-   table->chains = calloc(table->size, sizeof(hnode_t*));
-   assert(table->chains);
+   table->slots = calloc(table->size, sizeof(slot_t));
+   assert(table->slots);
    return table;
 }
 
 void obhash_free(obhash_t* table) {
    if (table) {
-      free_chains(table->chains, table->size, table->obfree);
-      free(table->chains);
+      free_slots(table);
+      free(table->slots);
       free(table);
    }
 }
@@ -200,15 +222,13 @@ void obhash_free(obhash_t* table) {
 void obhash_hook(obhash_t* table) {
    int count = 0;
    for (int i = 0; i < table->size; ++i) {
-      hnode_t* curr = table->chains[i];
-      while (curr) {
-         printf("%6d\t%s\n", ++count, curr->key);
-         curr = curr->next;
-      }
+      slot_t* slot = &table->slots[i];
+      if (slot->key)
+         printf("%6d\t%s\t(slot %d, %d from home)\n", ++count, slot->key,
+                                 i, distance(table, slot->hash, i));
    }
 }
 
 #endif /* ifdef OBHASH_HOOK */
 
 /********************************************************************/
-
@@ -1,13 +1,15 @@
 /* obhash.h
  *
- * Hashtable using strings as keys. Each node holds a pointer to
+ * Hashtable using strings as keys. Each slot holds a pointer to
  * something.
  */
 
 #ifndef __regex_hash
 #define __regex_hash
 
+#include <stddef.h>
 #include "hooks.h"
+#include "arena.h"
 
 /* obhash
  *
@@ -30,7 +32,8 @@ void* obhash_find(obhash_t*, char*);
   * it automatically frees all of the keys, so you may want to strdup
   * the string you're using. If a key which is in the table
   * is used to add a new object to the table, then the old object is
-  * freed (if the pointer to the freeing function isn't null).
+  * freed (if the pointer to the freeing function isn't null), and so
+  * is the key that was passed in.
   */
 void obhash_add(obhash_t*, char*, void*);
 
@@ -40,6 +43,22 @@ void obhash_add(obhash_t*, char*, void*);
   */
 int obhash_size(obhash_t*);
 
+/** bytes
+  *
+  * Get the number of bytes of memory used by the table and its keys,
+  * not counting the objects.
+  */
+size_t obhash_bytes(obhash_t*);
+
+/** pack
+  *
+  * Copy the table, its keys and its objects into an arena, and return
+  * the offset of the copy. Each object is copied as a block of the
+  * given size. The copy can be searched, but not changed or freed
+  * with obhash_free.
+  */
+size_t obhash_pack(obhash_t*, arena_t*, size_t);
+
 /** clear
   *
   * Delete all nodes in the hashtable without freeing the hashtable
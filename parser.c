@@ -14,6 +14,8 @@
 #include "shre_errno.h"
 #include "parser.h"
 #include "util.h"
+#include "shorthand.h"
+#include "unicode.h"
 
 
 /************subroutines that act on the list of tokens**************/
@@ -24,11 +26,23 @@
   * string case.
   */
 static inline bool part_of_string(tnode_t* node) {
-   return node && tnode_token(node)->flag == LITERAL &&
+   return node && (tnode_token(node)->flag == LITERAL
+                   || tnode_token(node)->flag == ILITERAL) &&
            !(tnode_next(node) != NULL && 
                tnode_token(tnode_next(node))->flag == RANGE);
 }
 
+/** cased_letter
+  *
+  * Check if the node is a literal ascii letter that has to match in
+  * the case it's written in. Such a letter can't be part of the same
+  * string as a caseless literal.
+  */
+static inline bool cased_letter(tnode_t* node) {
+   uint32_t cp = u8_deref(tnode_token(node)->data.literal);
+   return tnode_token(node)->flag == LITERAL && cp < 0x80 && isalpha(cp);
+}
+
 /** need_denullify
   *
   * Check for a character class that matches the zero byte.
@@ -77,17 +91,25 @@ static tnode_t* stringify(tlist_t* list, tnode_t* node) {
    token.flag = STRING; token.ngr = -1;
    tnode_t* end = node;
    tnode_t* insert = NULL;
+   bool caseless = tnode_token(node)->flag == ILITERAL;
+   bool cased = cased_letter(node);
    
    // slice out list of applicable literals
-   while (part_of_string(tnode_next(end))) {
-      end = tnode_next(end);
+   for (tnode_t* next = tnode_next(end); part_of_string(next);
+                                          next = tnode_next(end)) {
+      if ((caseless && cased_letter(next))
+                  || (cased && tnode_token(next)->flag == ILITERAL))
+         break;
+      caseless = caseless || tnode_token(next)->flag == ILITERAL;
+      cased = cased || cased_letter(next);
+      end = next;
    }
    tlist_t* literals = tlist_slice(list, node, end, &insert);
    
    // figure out size of new string and allocate
    int size = 1;
    for (tnode_t* n = tlist_front(literals); n; n = tnode_next(n))
-   	size += u8_bytelen(tlist_token(literals)->data.literal);
+   	size += u8_bytelen(tnode_token(n)->data.literal);
    token.data.string = calloc(sizeof(char), size);
    assert(token.data.string);
    
@@ -99,6 +121,14 @@ static tnode_t* stringify(tlist_t* list, tnode_t* node) {
       tlist_pop_front(literals);
    }
    tlist_free(literals);
+
+   // the other literals of a caseless string have no case, so the
+   //   whole string can be made small
+   if (caseless) {
+      token.flag = ISTRING;
+      for (char* u = token.data.string; *u; ++u)
+         *u = ascii_lower[(unsigned char) *u];
+   }
    return tlist_insert(list, insert, token);
 }
 
@@ -130,10 +160,13 @@ static void denullify(tnode_t* node) {
   * Convert a literal case into a class case.
   */
 static void convert_literal(tnode_t* node) {
+	bool caseless = tnode_token(node)->flag == ILITERAL;
 	tnode_token(node)->flag = CLASS;
 	u8cdpnt_t* literal = tnode_token(node)->data.literal;
 	tnode_token(node)->data.class = class_new();
 	class_insert_codepoint(tnode_token(node)->data.class, u8_deref(literal));
+	if (caseless)
+		unicode_fold_class(tnode_token(node)->data.class);
 	free(literal);
 }
 
@@ -162,7 +195,8 @@ static tlist_t* weedeat(tlist_t* list) {
          node = stringify(list, node);
       } else if (tnode_token(node)->flag == POSSESSIVE) {
          convert_possessive(list, node);
-      } else if (tnode_token(node)->flag == LITERAL) {
+      } else if (tnode_token(node)->flag == LITERAL
+                 || tnode_token(node)->flag == ILITERAL) {
          convert_literal(node);
       }
    }
@@ -401,7 +435,9 @@ static inline bool is_shorthand(char symbol) {
            symbol == 's' ||
            symbol == 'S' ||
            symbol == 'h' ||
-           symbol == 'H';
+           symbol == 'H' ||
+           symbol == 'p' ||
+           symbol == 'P';
 }
 
 /** IsIntersectionOperator
@@ -458,28 +494,143 @@ static inline bool is_shorthand(char symbol) {
   *
   * If the given character represents a shorthand character class,
   * then return true and class the given class variable to point at
-  * a new class representing the class. Otherwise return false. This
-  * works very similarly to the function 'parse_escape' defined above.
+  * a new class representing the class. Otherwise return false. The
+  * class is built straight from the constant ranges of the shorthand.
   */
-static class_t* _parse_class(char*, char*, bool*);
 static bool parse_shorthand(char lit, bool* negate, class_t** class) {
-   char* regex;
-   switch (lit) {
-      case 'd': regex = "[0-9]";         break;
-      case 'D': regex = "[^0-9]";        break;
-      case 'w': regex = "[a-zA-Z0-9_]";  break;
-      case 'W': regex = "[^a-zA-Z0-9_]"; break;
-      case 's': regex = "[ \t\r\n\f]";   break;
-      case 'S': regex = "[^ \t\r\n\f]";  break;
-      case 'h': regex = "[a-fA-F0-9]";   break;
-      case 'H': regex = "[^a-fA-F0-9]";  break;
-      default: return false;
+   const shorthand_t* shorthand = shorthand_find(lit);
+   if (!shorthand || lit == 'N')
+      return false;
+   *class = class_from_ranges(shorthand->ranges, shorthand->nranges);
+   *negate = shorthand->negate;
+   return true;
+}
+
+/** parse_property
+  *
+  * If the string points at the 'p' or 'P' of a unicode property
+  * escape, '\p{Name}', '\p{^Name}' or '\pL', then return true, class
+  * the given class variable to point at a new class holding the
+  * property and move the string past the escape. Otherwise return
+  * false. Like parse_escape, returns true for an unknown property;
+  * calling function has to make sure shre_er == NERROR.
+  */
+static bool parse_property(char** str, bool* negate, class_t** class) {
+   char* regex = *str;
+   char* name;
+   char* name_end;
+   if (*regex != 'p' && *regex != 'P')
+      return false;
+   *negate = *regex == 'P';
+   if (regex[1] == '{') {
+      name = regex + 2;
+      name_end = strchr(name, '}');
+      if (!name_end)
+         return false;
+      if (*name == '^') {
+         ++name;
+         *negate = !*negate;
+      }
+      *str = name_end + 1;
+   } else if (isalpha(regex[1])) {
+      name = regex + 1;
+      name_end = name + 1;
+      *str = name_end;
+   } else {
+      return false;
+   }
+
+   int property = unicode_property(name, name_end - name);
+   if (property < 0) {
+      shre_er = BADPRO;
+      return true;
    }
-   *class = _parse_class(regex, regex + strlen(regex) - 1, negate);
-   assert(*class);
+   *class = unicode_class(property);
    return true;
 }
 
+/** not_newline
+  *
+  * Make the class for '.' and '\N', which match any character
+  * except a newline. The class holds the newlines, and is used
+  * negated.
+  */
+static class_t* not_newline() {
+   const shorthand_t* shorthand = shorthand_find('N');
+   return class_from_ranges(shorthand->ranges, shorthand->nranges);
+}
+
+/** fold_literal
+  *
+  * Make a literal token match without regard to case. A literal with
+  * no other case is left alone. An ascii letter whose only other case
+  * is the other ascii letter becomes a caseless literal, which can be
+  * part of a caseless string. Any other literal, like 's', which is
+  * also matched by U+017F, becomes a class of its case orbit.
+  */
+static void fold_literal(token_t* token) {
+   uint32_t cp = u8_deref(token->data.literal);
+   uint32_t other = unicode_fold_next(cp);
+   if (other == cp)
+      return;
+   if (cp < 0x80 && other < 0x80 && unicode_fold_next(other) == cp) {
+      token->flag = ILITERAL;
+      return;
+   }
+   free(token->data.literal);
+   token->flag = CLASS;
+   token->data.class = class_new();
+   class_insert_codepoint(token->data.class, cp);
+   unicode_fold_class(token->data.class);
+}
+
+/** fold_string
+  *
+  * Make a string token from '\Q...\E' match without regard to case.
+  * It becomes a non-capturing group of the folded literals of the
+  * string, which weedeat makes back into strings and classes.
+  */
+static void fold_string(token_t* token) {
+   tlist_t* group = tlist_new();
+   for (char* u = token->data.string; *u; ) {
+      token_t literal;
+      literal.flag = LITERAL;
+      literal.ngr = -1;
+      literal.data.literal = u8_decode(u);
+      u = u8_end(literal.data.literal);
+      fold_literal(&literal);
+      tlist_push_back(group, literal);
+   }
+   token->flag = GROUP;
+   char* string = token->data.string;
+   token->data.group = weedeat(group);  // copies out of the string
+   free(string);
+}
+
+/** parse_flags
+  *
+  * Read the letters of an inline flag group like '(?i)', '(?-i)' or
+  * '(?i:...)', starting after the '?'. The only flag is 'i', which
+  * makes the rest of the group match without regard to case. Return
+  * false if the syntax is wrong. Otherwise move the string to the ')'
+  * or ':' after the letters, and set *caseless to the new setting.
+  */
+static bool parse_flags(char** str, bool* caseless) {
+   char* regex = *str;
+   bool on = true;
+   for (; *regex == 'i' || *regex == '-'; ++regex) {
+      if (*regex == '-') {
+         if (!on)
+            return false;
+         on = false;
+      } else {
+         *caseless = on;
+      }
+   }
+   *str = regex;
+   return *regex == ')' || *regex == ':';
+}
+
 /** GetBound
   *
   * Helper macro for 'parse_range'.
@@ -518,7 +669,7 @@ static bool parse_range(char** regex, int* a, int* b) {
       }
    }
    GetBound(*b, *regex, end)//;
-   if (!comma)
+   if (!comma || comma > end)
       *a = *b;
    *regex = end + 1;
    return true;
@@ -539,10 +690,10 @@ static inline bool lazy_applicable(tflag prev_flag) {
   * case.
   */
 static inline bool range_applicable(tflag prev_flag) {
-   return prev_flag == LITERAL    || prev_flag == CLASS  || 
+   return prev_flag == LITERAL    || prev_flag == CLASS  ||
           prev_flag == NCLASS     || prev_flag == GROUP  ||
           prev_flag == REFERENCE  || prev_flag == ATOMIC ||
-          prev_flag == SUBROUTINE;
+          prev_flag == SUBROUTINE || prev_flag == ILITERAL;
 }
 
 /** SetRange
@@ -662,6 +813,15 @@ static class_t* _parse_class(char* begin, char* end, bool* negate) {
                break;
             }
 
+            // check for unicode properties
+            if (parse_property(&regex, &nest_negate, &nest_class)) {
+               if (shre_er != NERROR)
+                  goto Error;
+               NestedClass();
+               prev_escape = -1;
+               break;
+            }
+
             // check for shorthand character classes
             if (parse_shorthand(*regex, &nest_negate, &nest_class)) {
                NestedClass();
@@ -693,8 +853,8 @@ class_t* parse_class(char* regex) {
 
 /*****************************parse_regex*********************************/
 
-static tlist_t* _parse_regex(char* regex, char* end,
-                                     int* next_group, tlist_t* name_list) {
+static tlist_t* _parse_regex(char* regex, char* end, int* next_group,
+                                 tlist_t* name_list, bool caseless) {
    tlist_t*    list = tlist_new();
 
    // empty regex case
@@ -709,8 +869,9 @@ static tlist_t* _parse_regex(char* regex, char* end,
    char*       back;
    char*       bracket;
    bool        negate;
+   bool        group_caseless;
    class_t*    class;
-   tflag       prev_flag;
+   tflag       prev_flag = EMPTY;
    int         a, b;
    token_t     name_token; name_token.flag = NAME;
    bool        top_level = *end == '\0';
@@ -739,6 +900,8 @@ static tlist_t* _parse_regex(char* regex, char* end,
             class = _parse_class(regex, back, &negate);
             if (!class)
                goto Error;
+            if (caseless)
+               unicode_fold_class(class);
             token.data.class = class;
             token.flag = negate ? NCLASS : CLASS;
             regex = back + 1;
@@ -748,12 +911,7 @@ static tlist_t* _parse_regex(char* regex, char* end,
          case '.':
             ++regex;
             token.flag = NCLASS;
-            token.data.class = class_new();
-            class_insert_codepoint(token.data.class, '\0');
-            class_insert_codepoint(token.data.class, '\r');
-            class_insert_codepoint(token.data.class, '\n');
-            class_insert_codepoint(token.data.class, '\f');
-            class_insert_codepoint(token.data.class, '\v');
+            token.data.class = not_newline();
             break;
             
          // match the empty string at the front of a string
@@ -776,6 +934,7 @@ static tlist_t* _parse_regex(char* regex, char* end,
          // parentheses
          case '(':
 {  bool capture = false;
+   group_caseless = caseless;
    back = find_closing(regex, '(', ')');
    ErrorCheck(!back || back == end, UNBPAR);
    if (*(regex+1) == '?') {   // (?...) syntax
@@ -858,6 +1017,18 @@ static tlist_t* _parse_regex(char* regex, char* end,
          case ':':
             token.flag = GROUP;
             break;
+
+         // inline flags, for the rest of this group or for a nested
+         //   nocapture group
+         case 'i': case '-':
+            ErrorCheck(!parse_flags(&regex, &group_caseless), QUEPAR);
+            if (*regex == ')') {
+               caseless = group_caseless;
+               regex = back + 1;
+               continue;
+            }
+            token.flag = GROUP;
+            break;
       
          // syntax error
          default:
@@ -870,8 +1041,8 @@ static tlist_t* _parse_regex(char* regex, char* end,
    }
    if (capture)
       token.ngr = (*next_group)++;
-   token.data.group = _parse_regex(regex + 1,
-                                back, next_group, name_list);
+   token.data.group = _parse_regex(regex + 1, back, next_group,
+                                   name_list, group_caseless);
    if (!token.data.group)
       goto Error;
 SkipParse:
@@ -968,12 +1139,16 @@ SkipParse:
             if (*regex == 'N') {
                ++regex;
                token.flag = NCLASS;
-               token.data.class = class_new();
-               class_insert_codepoint(token.data.class, '\0');
-               class_insert_codepoint(token.data.class, '\r');
-					class_insert_codepoint(token.data.class, '\n');
-					class_insert_codepoint(token.data.class, '\f');
-					class_insert_codepoint(token.data.class, '\v');
+               token.data.class = not_newline();
+               break;
+            }
+
+            // unicode property
+            if (parse_property(&regex, &negate, &class)) {
+               if (shre_er != NERROR)
+                  goto Error;
+               token.flag = negate ? NCLASS : CLASS;
+               token.data.class = class;
                break;
             }
 
@@ -1047,9 +1222,21 @@ SkipParse:
             token.data.literal = u8_decode(regex);
             regex = u8_end(token.data.literal);
       }
-      tlist_push_back(list, token);
       prev_flag = token.flag;
+      if (caseless && token.flag == LITERAL)
+         fold_literal(&token);
+      else if (caseless && token.flag == STRING)
+         fold_string(&token);
+      tlist_push_back(list, token);
    } while (regex != end);
+
+   // a regex that only sets flags is empty
+   if (tlist_empty(list)) {
+      token_t token;
+      token.ngr = -1;
+      token.flag = EMPTY;
+      tlist_push_back(list, token);
+   }
    if (top_level)
       ErrorCheck(badref_check(list, *next_group, name_list), BADREF);
    assert(shre_er == NERROR);
@@ -1068,7 +1255,7 @@ tlist_t* parse_regex(char* regex, obhash_t** group_names) {
    tlist_t* name_list = tlist_new();
    int num_groups = 1;
    tlist_t* tokens = _parse_regex(regex, regex + strlen(regex),
-                                              &num_groups, name_list);
+                                  &num_groups, name_list, false);
    if (!tokens)
       return NULL;
    if (!tlist_empty(name_list)) {
@@ -0,0 +1,618 @@
+/* pcache.c
+ *
+ * Implementation of the concurrent pattern cache. The cache is split
+ * into shards by the hash of the key, and each shard is an open
+ * addressing hash table with linear probing.
+ *
+ * Readers don't lock. A shard's table and its entries are only freed
+ * by a writer after a grace period: the writer unlinks them, bumps
+ * the shard's epoch, and waits for every reader that started in the
+ * old epoch to finish. A reader announces itself by incrementing the
+ * counter for the current epoch's parity and then checking that the
+ * epoch didn't change in the meantime, so a reader is either waited
+ * for or sees the new state.
+ *
+ * Writers (inserts, evictions, clears) hold the shard's mutex.
+ * Compiles run without the mutex, so compiling one pattern doesn't
+ * hold up lookups or compiles of others; a list of compiles in
+ * progress lets later threads that miss on the same key wait for the
+ * first one.
+ *
+ * Eviction uses the CLOCK algorithm. A hit sets the entry's
+ * referenced bit. When the cache is over a limit, a hand moves over
+ * the slots of every shard in turn; an entry whose bit is set gets
+ * its bit cleared and a second chance, and an entry whose bit is
+ * clear is evicted. Evicted slots become tombstones, which are
+ * dropped the next time the table is rebuilt.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "pcache.h"
+#include "shre_errno.h"
+#include "util.h"
+
+// Number of shards, as a power of two.
+#define SHARD_BITS 4
+#define NSHARDS (1 << SHARD_BITS)
+
+// Initial number of slots in a shard's table. Must be a power of two.
+#define TABLESIZE 16
+
+/* entry
+ *
+ * A pattern in the cache. Only the referenced bit is changed after
+ * an entry is put in a table.
+ */
+typedef struct {
+   uint32_t hash;
+   char* key;
+   void* obj;
+   size_t bytes;
+   bool referenced;     // set by hits, cleared by the clock hand
+} entry_t;
+
+/* table
+ *
+ * Array of slots. A slot is NULL if it has never been used, and
+ * points at the tombstone if its entry was removed. The hash of each
+ * entry is kept next to the slots as well, so that a probe can pass
+ * over entries with other hashes without loading them.
+ */
+typedef struct {
+   entry_t** slots;
+   uint32_t* hashes;       // written before the slot is published
+   int size;
+} table_t;
+
+/* pending
+ *
+ * A compile in progress. Lives in the shard's pending list until
+ * the compile finishes, and is freed by the last thread waiting on
+ * it.
+ */
+typedef struct _pending pending_t;
+struct _pending {
+   char* key;
+   uint32_t hash;
+   bool done;
+   void* obj;           // the result, once done
+   shre_erflag error;   // shre_er after the compile
+   int waiters;         // threads that still need the result
+   pending_t* next;
+};
+
+/* shard
+ *
+ * One part of the cache. Aligned so that two shards never share a
+ * cache line.
+ */
+typedef struct {
+   table_t* table;         // read without the lock
+   int load;               // number of entries in the table
+   int used;               // number of slots that aren't NULL
+   pending_t* pending;
+   pthread_mutex_t lock;
+   pthread_cond_t done;    // signaled when a compile finishes
+   unsigned epoch;
+   unsigned readers[2];    // readers in an even and an odd epoch
+   int hand;               // next slot for the clock hand
+   long hits;
+   long misses;
+} __attribute__((aligned(64))) shard_t;
+
+/* pcache
+ *
+ * Declaration of the cache. The totals and the limits are read
+ * without a lock.
+ */
+struct _pcache {
+   shard_t shards[NSHARDS];
+   pcache_ops_t ops;
+   int patterns;           // patterns in all of the shards
+   size_t bytes;           // bytes used by those patterns
+   long evictions;
+   int max_patterns;       // zero for no limit
+   size_t max_bytes;       // zero for no limit
+   pthread_mutex_t evict_lock;
+   int hand;               // shard that the clock hand is in
+};
+
+static entry_t tombstone;
+
+/**************************grace periods*****************************/
+
+/** read_lock
+  *
+  * Enter a read section. Return the epoch to pass to read_unlock.
+  */
+static unsigned read_lock(shard_t* sh) {
+   for (;;) {
+      unsigned e = __atomic_load_n(&sh->epoch, __ATOMIC_SEQ_CST);
+      __atomic_add_fetch(&sh->readers[e & 1], 1, __ATOMIC_SEQ_CST);
+      if (__atomic_load_n(&sh->epoch, __ATOMIC_SEQ_CST) == e)
+         return e;
+      __atomic_sub_fetch(&sh->readers[e & 1], 1, __ATOMIC_SEQ_CST);
+   }
+}
+
+/** read_unlock
+  *
+  * Leave a read section.
+  */
+static void read_unlock(shard_t* sh, unsigned e) {
+   __atomic_sub_fetch(&sh->readers[e & 1], 1, __ATOMIC_RELEASE);
+}
+
+/** synchronize
+  *
+  * Wait until no reader can still see anything that was unlinked
+  * before the call. Called by a writer holding the shard's mutex.
+  */
+static void synchronize(shard_t* sh) {
+   unsigned e = sh->epoch;
+   __atomic_store_n(&sh->epoch, e + 1, __ATOMIC_SEQ_CST);
+   while (__atomic_load_n(&sh->readers[e & 1], __ATOMIC_SEQ_CST))
+      sched_yield();
+}
+
+/***************************table operations*************************/
+
+/** table_new
+  *
+  * Make an empty table.
+  */
+static table_t* table_new(int size) {
+   table_t* t = malloc(sizeof(table_t));
+   assert(t);
+   t->size = size;
+   t->slots = calloc(size, sizeof(entry_t*));
+   t->hashes = malloc(size * sizeof(uint32_t));
+   assert(t->slots && t->hashes);
+   return t;
+}
+
+/** table_free
+  *
+  * Free a table, but not its entries.
+  */
+static void table_free(table_t* t) {
+   free(t->slots);
+   free(t->hashes);
+   free(t);
+}
+
+/** probe
+  *
+  * Look for a key in a table. Safe to call from a reader.
+  */
+static entry_t* probe(table_t* t, uint32_t hash, char* key) {
+   int mask = t->size - 1;
+   for (int i = hash & mask;; i = (i + 1) & mask) {
+      entry_t* e = __atomic_load_n(&t->slots[i], __ATOMIC_ACQUIRE);
+      if (!e)
+         return NULL;
+      if (t->hashes[i] == hash && e != &tombstone
+                               && strcmp(e->key, key) == 0)
+         return e;
+   }
+}
+
+/** place
+  *
+  * Put an entry in the first free slot of its probe sequence.
+  */
+static void place(table_t* t, entry_t* e) {
+   int mask = t->size - 1;
+   int i = e->hash & mask;
+   while (t->slots[i])
+      i = (i + 1) & mask;
+   t->hashes[i] = e->hash;
+   __atomic_store_n(&t->slots[i], e, __ATOMIC_RELEASE);
+}
+
+/** insert
+  *
+  * Add an entry to a shard, first moving to a bigger table if the
+  * table would be more than half full. Called with the mutex held.
+  */
+static void insert(shard_t* sh, entry_t* e) {
+   if ((sh->used + 1) * 2 > sh->table->size) {
+      int size = sh->table->size;
+      while ((sh->load + 1) * 4 > size)
+         size *= 2;
+      table_t* old = sh->table;
+      table_t* t = table_new(size);
+      for (int i = 0; i < old->size; ++i) {
+         if (old->slots[i] && old->slots[i] != &tombstone)
+            place(t, old->slots[i]);
+      }
+      __atomic_store_n(&sh->table, t, __ATOMIC_SEQ_CST);
+      synchronize(sh);
+      table_free(old);
+      sh->used = sh->load;
+   }
+   place(sh->table, e);
+   ++sh->load;
+   ++sh->used;
+}
+
+/*******************************eviction*****************************/
+
+/** over_limit
+  *
+  * Return true if the cache holds more than it's allowed to.
+  */
+static bool over_limit(pcache_t* cache) {
+   int max = __atomic_load_n(&cache->max_patterns, __ATOMIC_RELAXED);
+   size_t maxb = __atomic_load_n(&cache->max_bytes, __ATOMIC_RELAXED);
+   return (max && __atomic_load_n(&cache->patterns, __ATOMIC_RELAXED) > max)
+       || (maxb && __atomic_load_n(&cache->bytes, __ATOMIC_RELAXED) > maxb);
+}
+
+/** sweep
+  *
+  * Move the clock hand over a shard, from where it last stopped,
+  * until the cache is under its limits or the hand reaches the end of
+  * the table. Return true if it reached the end. Called with the
+  * eviction lock held.
+  */
+static bool sweep(pcache_t* cache, shard_t* sh, int* evicted) {
+   pthread_mutex_lock(&sh->lock);
+   table_t* t = sh->table;
+   entry_t** victims = malloc(t->size * sizeof(entry_t*));
+   assert(victims);
+   int n = 0;
+   if (sh->hand >= t->size)
+      sh->hand = 0;
+   for (; sh->hand < t->size && over_limit(cache); ++sh->hand) {
+      entry_t* e = t->slots[sh->hand];
+      if (!e || e == &tombstone || cache->ops.held(e->obj))
+         continue;
+      if (__atomic_exchange_n(&e->referenced, false, __ATOMIC_RELAXED))
+         continue;
+      __atomic_store_n(&t->slots[sh->hand], &tombstone, __ATOMIC_RELEASE);
+      --sh->load;
+      __atomic_sub_fetch(&cache->patterns, 1, __ATOMIC_RELAXED);
+      __atomic_sub_fetch(&cache->bytes, e->bytes, __ATOMIC_RELAXED);
+      victims[n++] = e;
+   }
+   bool end = sh->hand == t->size;
+   if (end)
+      sh->hand = 0;
+   if (n)
+      synchronize(sh);
+   pthread_mutex_unlock(&sh->lock);
+
+   for (int i = 0; i < n; ++i) {
+      cache->ops.release(victims[i]->obj);
+      free(victims[i]->key);
+      free(victims[i]);
+   }
+   free(victims);
+   __atomic_add_fetch(&cache->evictions, n, __ATOMIC_RELAXED);
+   *evicted = n;
+   return end;
+}
+
+/** evict
+  *
+  * Evict patterns until the cache is under its limits. Gives up after
+  * the hand has gone around twice without evicting anything, which
+  * means that everything left is pinned.
+  */
+static void evict(pcache_t* cache) {
+   if (!over_limit(cache))
+      return;
+   pthread_mutex_lock(&cache->evict_lock);
+   int idle = 0;  // shards swept since the last eviction
+   while (idle <= 2 * NSHARDS && over_limit(cache)) {
+      int evicted;
+      bool end = sweep(cache, &cache->shards[cache->hand], &evicted);
+      idle = evicted ? 0 : idle + 1;
+      if (end)
+         cache->hand = (cache->hand + 1) % NSHARDS;
+   }
+   pthread_mutex_unlock(&cache->evict_lock);
+}
+
+/**************************static functions**************************/
+
+/** shard_of
+  *
+  * The shard is picked with the high bits of the hash, since the
+  * table index uses the low bits.
+  */
+static inline shard_t* shard_of(pcache_t* cache, uint32_t hash) {
+   return &cache->shards[hash >> (32 - SHARD_BITS)];
+}
+
+/** find_pending
+  *
+  * Look for a compile in progress. Called with the mutex held.
+  */
+static pending_t* find_pending(shard_t* sh, uint32_t hash, char* key) {
+   for (pending_t* p = sh->pending; p; p = p->next) {
+      if (p->hash == hash && strcmp(p->key, key) == 0)
+         return p;
+   }
+   return NULL;
+}
+
+/** unlink_pending
+  *
+  * Remove a compile from the pending list. Called with the mutex
+  * held.
+  */
+static void unlink_pending(shard_t* sh, pending_t* p) {
+   pending_t** link = &sh->pending;
+   while (*link != p)
+      link = &(*link)->next;
+   *link = p->next;
+}
+
+/** wait_pending
+  *
+  * Wait for another thread's compile of the same key. The compiling
+  * thread takes a reference for every waiter. Called with the mutex
+  * held.
+  */
+static void* wait_pending(shard_t* sh, pending_t* p) {
+   ++p->waiters;
+   while (!p->done)
+      pthread_cond_wait(&sh->done, &sh->lock);
+   void* obj = p->obj;
+   shre_er = obj ? NERROR : p->error;
+   if (--p->waiters == 0)
+      free(p);
+   return obj;
+}
+
+/** add_entry
+  *
+  * Add a pattern to a shard, taking over the reference that the
+  * caller holds. Called with the mutex held.
+  */
+static void add_entry(pcache_t* cache, shard_t* sh,
+                            uint32_t hash, char* key, void* obj) {
+   entry_t* e = malloc(sizeof(entry_t));
+   assert(e);
+   e->hash = hash;
+   e->key = strdup(key);
+   assert(e->key);
+   e->obj = obj;
+   e->bytes = cache->ops.bytes(obj);
+   e->referenced = false;
+   insert(sh, e);
+   __atomic_add_fetch(&cache->patterns, 1, __ATOMIC_RELAXED);
+   __atomic_add_fetch(&cache->bytes, e->bytes, __ATOMIC_RELAXED);
+}
+
+/** compile
+  *
+  * Compile a pattern that isn't cached and isn't being compiled, and
+  * add it to the shard. Called with the mutex held, which is released
+  * during the compile.
+  */
+static void* compile(pcache_t* cache, shard_t* sh,
+                                      uint32_t hash, char* key) {
+   pending_t* p = calloc(1, sizeof(pending_t));
+   assert(p);
+   p->key = key;
+   p->hash = hash;
+   p->waiters = 1;
+   p->next = sh->pending;
+   sh->pending = p;
+   pthread_mutex_unlock(&sh->lock);
+
+   void* obj = cache->ops.compile(key);
+   shre_erflag error = shre_er;
+
+   pthread_mutex_lock(&sh->lock);
+   unlink_pending(sh, p);
+   if (obj) {
+      add_entry(cache, sh, hash, key, obj);
+
+      // references for this thread and every waiting thread, taken
+      //   now so that the pattern can't be freed before they wake up
+      for (int i = 0; i < p->waiters; ++i)
+         cache->ops.retain(obj);
+   }
+   p->obj = obj;
+   p->error = error;
+   p->done = true;
+   pthread_cond_broadcast(&sh->done);
+   if (--p->waiters == 0)
+      free(p);
+   return obj;
+}
+
+/**************************public functions**************************/
+
+void* pcache_get(pcache_t* cache, char* key) {
+   assert(cache && key);
+   uint32_t hash = strhash(key);
+   shard_t* sh = shard_of(cache, hash);
+
+   // lock-free lookup
+   void* obj = NULL;
+   unsigned epoch = read_lock(sh);
+   entry_t* e = probe(__atomic_load_n(&sh->table, __ATOMIC_SEQ_CST),
+                                                            hash, key);
+   if (e) {
+      obj = e->obj;
+      cache->ops.retain(obj);
+      if (!__atomic_load_n(&e->referenced, __ATOMIC_RELAXED))
+         __atomic_store_n(&e->referenced, true, __ATOMIC_RELAXED);
+   }
+   read_unlock(sh, epoch);
+   if (obj) {
+      __atomic_add_fetch(&sh->hits, 1, __ATOMIC_RELAXED);
+      shre_er = NERROR;
+      return obj;
+   }
+
+   // miss; compile it or wait for the thread that is
+   pthread_mutex_lock(&sh->lock);
+   pending_t* p;
+   bool compiled = false;
+   if ((e = probe(sh->table, hash, key))) {
+      obj = e->obj;
+      cache->ops.retain(obj);
+      __atomic_store_n(&e->referenced, true, __ATOMIC_RELAXED);
+      __atomic_add_fetch(&sh->hits, 1, __ATOMIC_RELAXED);
+      shre_er = NERROR;
+   } else if ((p = find_pending(sh, hash, key))) {
+      __atomic_add_fetch(&sh->misses, 1, __ATOMIC_RELAXED);
+      obj = wait_pending(sh, p);
+   } else {
+      __atomic_add_fetch(&sh->misses, 1, __ATOMIC_RELAXED);
+      obj = compile(cache, sh, hash, key);
+      compiled = obj != NULL;
+   }
+   pthread_mutex_unlock(&sh->lock);
+
+   // the new pattern is pinned by this thread's reference
+   if (compiled)
+      evict(cache);
+   return obj;
+}
+
+void pcache_put(pcache_t* cache, char* key, void* obj) {
+   assert(cache && key && obj);
+   uint32_t hash = strhash(key);
+   shard_t* sh = shard_of(cache, hash);
+   pthread_mutex_lock(&sh->lock);
+   bool present = probe(sh->table, hash, key)
+               || find_pending(sh, hash, key);
+   if (!present)
+      add_entry(cache, sh, hash, key, obj);
+   pthread_mutex_unlock(&sh->lock);
+   if (present)
+      cache->ops.release(obj);
+   else
+      evict(cache);
+}
+
+void** pcache_snapshot(pcache_t* cache, int* n) {
+   assert(cache && n);
+   int cap = 16;
+   void** objs = malloc(cap * sizeof(void*));
+   assert(objs);
+   *n = 0;
+   for (int i = 0; i < NSHARDS; ++i) {
+      shard_t* sh = &cache->shards[i];
+      pthread_mutex_lock(&sh->lock);
+      for (int j = 0; j < sh->table->size; ++j) {
+         entry_t* e = sh->table->slots[j];
+         if (!e || e == &tombstone)
+            continue;
+         if (*n == cap) {
+            cap *= 2;
+            objs = realloc(objs, cap * sizeof(void*));
+            assert(objs);
+         }
+         cache->ops.retain(e->obj);
+         objs[(*n)++] = e->obj;
+      }
+      pthread_mutex_unlock(&sh->lock);
+   }
+   return objs;
+}
+
+int pcache_size(pcache_t* cache) {
+   assert(cache);
+   return __atomic_load_n(&cache->patterns, __ATOMIC_RELAXED);
+}
+
+void pcache_stats(pcache_t* cache, pcache_stats_t* stats) {
+   assert(cache && stats);
+   stats->hits = 0;
+   stats->misses = 0;
+   for (int i = 0; i < NSHARDS; ++i) {
+      shard_t* sh = &cache->shards[i];
+      stats->hits += __atomic_load_n(&sh->hits, __ATOMIC_RELAXED);
+      stats->misses += __atomic_load_n(&sh->misses, __ATOMIC_RELAXED);
+   }
+   stats->evictions = __atomic_load_n(&cache->evictions, __ATOMIC_RELAXED);
+   stats->patterns = __atomic_load_n(&cache->patterns, __ATOMIC_RELAXED);
+   stats->bytes = __atomic_load_n(&cache->bytes, __ATOMIC_RELAXED);
+}
+
+void pcache_limit(pcache_t* cache, int max_patterns, size_t max_bytes) {
+   assert(cache && max_patterns >= 0);
+   __atomic_store_n(&cache->max_patterns, max_patterns, __ATOMIC_RELAXED);
+   __atomic_store_n(&cache->max_bytes, max_bytes, __ATOMIC_RELAXED);
+   evict(cache);
+}
+
+void pcache_clear(pcache_t* cache) {
+   assert(cache);
+   for (int i = 0; i < NSHARDS; ++i) {
+      shard_t* sh = &cache->shards[i];
+      pthread_mutex_lock(&sh->lock);
+      table_t* old = sh->table;
+      __atomic_store_n(&sh->table, table_new(TABLESIZE), __ATOMIC_SEQ_CST);
+      sh->load = 0;
+      sh->used = 0;
+      sh->hand = 0;
+      synchronize(sh);
+      for (int j = 0; j < old->size; ++j) {
+         entry_t* e = old->slots[j];
+         if (e && e != &tombstone) {
+            __atomic_sub_fetch(&cache->patterns, 1, __ATOMIC_RELAXED);
+            __atomic_sub_fetch(&cache->bytes, e->bytes, __ATOMIC_RELAXED);
+         }
+      }
+      pthread_mutex_unlock(&sh->lock);
+
+      for (int j = 0; j < old->size; ++j) {
+         entry_t* e = old->slots[j];
+         if (e && e != &tombstone) {
+            cache->ops.release(e->obj);
+            free(e->key);
+            free(e);
+         }
+      }
+      table_free(old);
+   }
+}
+
+pcache_t* pcache_new(const pcache_ops_t* ops) {
+   assert(ops && ops->compile && ops->retain && ops->release);
+   assert(ops->held && ops->bytes);
+   pcache_t* cache = calloc(1, sizeof(pcache_t));
+   assert(cache);
+   cache->ops = *ops;
+   pthread_mutex_init(&cache->evict_lock, NULL);
+   for (int i = 0; i < NSHARDS; ++i) {
+      shard_t* sh = &cache->shards[i];
+      sh->table = table_new(TABLESIZE);
+      pthread_mutex_init(&sh->lock, NULL);
+      pthread_cond_init(&sh->done, NULL);
+   }
+   return cache;
+}
+
+void pcache_free(pcache_t* cache) {
+   if (cache) {
+      pcache_clear(cache);
+      for (int i = 0; i < NSHARDS; ++i) {
+         shard_t* sh = &cache->shards[i];
+         assert(!sh->pending);
+         table_free(sh->table);
+         pthread_mutex_destroy(&sh->lock);
+         pthread_cond_destroy(&sh->done);
+      }
+      pthread_mutex_destroy(&cache->evict_lock);
+      free(cache);
+   }
+}
+
+/********************************************************************/
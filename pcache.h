@@ -0,0 +1,131 @@
+/* pcache.h
+ *
+ * Concurrent cache of compiled patterns, keyed by the regular
+ * expression string. Lookups of patterns that are already cached
+ * take no lock, and when several threads ask for the same pattern
+ * that isn't cached yet, it's compiled only once while the others
+ * wait for the result.
+ *
+ * The cache doesn't know what a pattern is; it's given functions to
+ * compile one, to take and drop references to one, and to measure
+ * one. The cache holds one reference to every pattern in it, and
+ * every pattern it hands out comes with a reference for the caller,
+ * so a pattern is only freed once the cache and every caller are
+ * done with it.
+ *
+ * The cache can be limited to a number of patterns and a number of
+ * bytes. When it goes over either limit, patterns are evicted in
+ * CLOCK order, which approximates least recently used. A pattern
+ * that anything besides the cache holds a reference to is pinned and
+ * never evicted.
+ */
+
+#ifndef __regex_pcache
+#define __regex_pcache
+
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct _pcache pcache_t;
+
+/* pcache_ops
+ *
+ * Functions the cache uses on the patterns. compile builds a pattern
+ * with one reference, which becomes the cache's, or returns NULL and
+ * sets shre_er. retain and release take and drop a reference. held
+ * returns true if anything besides the cache holds a reference, and
+ * bytes returns the memory used by the pattern.
+ */
+typedef struct {
+   void* (*compile)(char*);
+   void (*retain)(void*);
+   void (*release)(void*);
+   bool (*held)(void*);
+   size_t (*bytes)(void*);
+} pcache_ops_t;
+
+/* pcache_stats
+ *
+ * Counters for a cache. hits and misses count lookups; a lookup that
+ * waits for another thread's compile is a miss.
+ */
+typedef struct {
+   long hits;
+   long misses;
+   long evictions;
+   int patterns;     // number of patterns in the cache
+   size_t bytes;     // memory used by the patterns in the cache
+} pcache_stats_t;
+
+/** get
+  *
+  * Get the pattern for a regular expression, compiling it if it isn't
+  * in the cache. The caller owns a reference to the returned pattern.
+  * If the regular expression is bad, return NULL with shre_er set;
+  * threads that were waiting for the same compile get the same
+  * error.
+  */
+void* pcache_get(pcache_t*, char*);
+
+/** put
+  *
+  * Add a pattern that was built some other way than by the compile
+  * function, taking over the caller's reference to it. If the key is
+  * already in the cache, or being compiled, the cache keeps what it
+  * has and the reference is dropped.
+  */
+void pcache_put(pcache_t*, char*, void*);
+
+/** snapshot
+  *
+  * Get every pattern in the cache. Return an array of the patterns,
+  * each with a reference for the caller, and set the int to its
+  * length. The caller frees the array.
+  */
+void** pcache_snapshot(pcache_t*, int*);
+
+/** size
+  *
+  * Get the number of patterns in the cache.
+  */
+int pcache_size(pcache_t*);
+
+/** stats
+  *
+  * Fill in the counters for the cache. The counters are updated
+  * without locking, so they're only exact when no other thread is
+  * using the cache.
+  */
+void pcache_stats(pcache_t*, pcache_stats_t*);
+
+/** limit
+  *
+  * Set the largest number of patterns and the largest number of bytes
+  * the cache may hold; zero means no limit. Evicts patterns right away
+  * if the cache is over the new limits.
+  */
+void pcache_limit(pcache_t*, int, size_t);
+
+/** clear
+  *
+  * Remove every pattern from the cache and drop the cache's
+  * references to them. Patterns that callers still hold references
+  * to stay valid until those references are dropped. The counters
+  * aren't reset.
+  */
+void pcache_clear(pcache_t*);
+
+/** new
+  *
+  * Create an empty cache with no limits.
+  */
+pcache_t* pcache_new(const pcache_ops_t*);
+
+/** free
+  *
+  * Clear the cache and deallocate it. No other thread may be using
+  * the cache.
+  */
+void pcache_free(pcache_t*);
+
+#endif
@@ -0,0 +1,244 @@
+/* pool.c
+ *
+ * Implementation of the worker pool. The job being run is kept in
+ * the pool; starting a job bumps a generation number and wakes the
+ * threads, which take tasks from their deques, and steal from the
+ * others' deques once their own are empty.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "pool.h"
+
+/* deque
+ *
+ * The tasks a worker has left: the ones numbered from lo up to but
+ * not including hi. The worker takes them from the front, and other
+ * workers steal from the back. Each deque is on its own cache line,
+ * so workers taking their own tasks don't slow each other down.
+ */
+typedef struct {
+   pthread_mutex_t lock;
+   int lo;
+   int hi;
+} __attribute__((aligned(64))) deque_t;
+
+typedef struct _thread thread_t;
+
+/* pool
+ *
+ * Declaration of the pool object. The job fields are written by the
+ * thread that runs the job while it holds lock, before the
+ * generation changes, and only read by the threads after they see
+ * the change.
+ */
+struct _pool {
+   pthread_mutex_t run;    // held by the thread running a job
+   pthread_mutex_t lock;
+   pthread_cond_t start;   // signaled when a job begins
+   pthread_cond_t done;    // signaled when the last thread leaves a job
+   thread_t* threads;
+   int nthreads;           // threads besides the one running the job
+   long generation;        // number of jobs started
+   int busy;               // threads still working on the job
+   bool quit;
+
+   // the current job
+   task_f task;
+   void* arg;
+   deque_t* deques;        // one for each worker; the thread running
+                           //   the job is worker 0
+};
+
+/* thread
+ *
+ * One of the pool's threads, and the number of the worker it is.
+ */
+struct _thread {
+   pthread_t id;
+   pool_t* pool;
+   int worker;
+};
+
+static pool_t* shared = NULL;
+static pthread_once_t shared_once = PTHREAD_ONCE_INIT;
+
+/***************************static functions*************************/
+
+/** take
+  *
+  * Take the task at the front of a worker's own deque. Return false
+  * if it's empty.
+  */
+static bool take(deque_t* own, int* task) {
+   pthread_mutex_lock(&own->lock);
+   bool any = own->lo < own->hi;
+   if (any)
+      *task = own->lo++;
+   pthread_mutex_unlock(&own->lock);
+   return any;
+}
+
+/** steal
+  *
+  * Take the back half of the tasks in another worker's deque, rounded
+  * up. Put all but the first of them in the worker's own deque, which
+  * is empty, and set *task to the first. Return false if every other
+  * deque is empty.
+  */
+static bool steal(pool_t* pool, int worker, int* task) {
+   int workers = pool->nthreads + 1;
+   for (int k = 1; k < workers; ++k) {
+      deque_t* victim = &pool->deques[(worker + k) % workers];
+      pthread_mutex_lock(&victim->lock);
+      int lo = victim->lo + (victim->hi - victim->lo) / 2;
+      int hi = victim->hi;
+      victim->hi = lo;
+      pthread_mutex_unlock(&victim->lock);
+      if (lo < hi) {
+         deque_t* own = &pool->deques[worker];
+         pthread_mutex_lock(&own->lock);
+         own->lo = lo + 1;
+         own->hi = hi;
+         pthread_mutex_unlock(&own->lock);
+         *task = lo;
+         return true;
+      }
+   }
+   return false;
+}
+
+/** drain
+  *
+  * Run tasks of the current job until there are none left.
+  */
+static void drain(pool_t* pool, int worker) {
+   int task;
+   while (take(&pool->deques[worker], &task)
+                  || steal(pool, worker, &task))
+      pool->task(pool->arg, task, worker);
+}
+
+/** work
+  *
+  * Body of the pool's threads.
+  */
+static void* work(void* arg) {
+   pool_t* pool = ((thread_t*) arg)->pool;
+   int worker = ((thread_t*) arg)->worker;
+   long seen = 0;
+   pthread_mutex_lock(&pool->lock);
+   for (;;) {
+      while (pool->generation == seen && !pool->quit)
+         pthread_cond_wait(&pool->start, &pool->lock);
+      if (pool->quit)
+         break;
+      seen = pool->generation;
+      pthread_mutex_unlock(&pool->lock);
+      drain(pool, worker);
+      pthread_mutex_lock(&pool->lock);
+      if (--pool->busy == 0)
+         pthread_cond_signal(&pool->done);
+   }
+   pthread_mutex_unlock(&pool->lock);
+   return NULL;
+}
+
+/** make_shared
+  *
+  * Make the shared pool.
+  */
+static void make_shared() {
+   long n = sysconf(_SC_NPROCESSORS_ONLN);
+   shared = pool_new(n > 0 ? n : 1);
+}
+
+/***************************public functions*************************/
+
+pool_t* pool_new(int workers) {
+   assert(workers > 0);
+   pool_t* pool = calloc(1, sizeof(pool_t));
+   assert(pool);
+   pthread_mutex_init(&pool->run, NULL);
+   pthread_mutex_init(&pool->lock, NULL);
+   pthread_cond_init(&pool->start, NULL);
+   pthread_cond_init(&pool->done, NULL);
+   pool->nthreads = workers - 1;
+   pool->threads = malloc((workers - 1) * sizeof(thread_t) + 1);
+   int er = posix_memalign((void**) &pool->deques, sizeof(deque_t),
+                           workers * sizeof(deque_t));
+   assert(pool->threads && er == 0);
+   for (int i = 0; i < workers; ++i) {
+      pthread_mutex_init(&pool->deques[i].lock, NULL);
+      pool->deques[i].lo = pool->deques[i].hi = 0;
+   }
+   for (int i = 0; i < pool->nthreads; ++i) {
+      thread_t* thread = &pool->threads[i];
+      thread->pool = pool;
+      thread->worker = i + 1;
+      er = pthread_create(&thread->id, NULL, work, thread);
+      assert(er == 0);
+   }
+   return pool;
+}
+
+pool_t* pool_shared() {
+   pthread_once(&shared_once, make_shared);
+   return shared;
+}
+
+int pool_workers(pool_t* pool) {
+   assert(pool);
+   return pool->nthreads + 1;
+}
+
+void pool_run(pool_t* pool, task_f task, void* arg, int ntasks) {
+   assert(pool && task);
+   pthread_mutex_lock(&pool->run);
+   pthread_mutex_lock(&pool->lock);
+   pool->task = task;
+   pool->arg = arg;
+   int workers = pool->nthreads + 1;
+   for (int i = 0; i < workers; ++i) {
+      pool->deques[i].lo = (long) ntasks * i / workers;
+      pool->deques[i].hi = (long) ntasks * (i + 1) / workers;
+   }
+   pool->busy = pool->nthreads;
+   ++pool->generation;
+   pthread_cond_broadcast(&pool->start);
+   pthread_mutex_unlock(&pool->lock);
+
+   drain(pool, 0);
+
+   pthread_mutex_lock(&pool->lock);
+   while (pool->busy)
+      pthread_cond_wait(&pool->done, &pool->lock);
+   pthread_mutex_unlock(&pool->lock);
+   pthread_mutex_unlock(&pool->run);
+}
+
+void pool_free(pool_t* pool) {
+   if (!pool)
+      return;
+   pthread_mutex_lock(&pool->lock);
+   pool->quit = true;
+   pthread_cond_broadcast(&pool->start);
+   pthread_mutex_unlock(&pool->lock);
+   for (int i = 0; i < pool->nthreads; ++i)
+      pthread_join(pool->threads[i].id, NULL);
+   pthread_mutex_destroy(&pool->run);
+   pthread_mutex_destroy(&pool->lock);
+   pthread_cond_destroy(&pool->start);
+   pthread_cond_destroy(&pool->done);
+   for (int i = 0; i <= pool->nthreads; ++i)
+      pthread_mutex_destroy(&pool->deques[i].lock);
+   free(pool->deques);
+   free(pool->threads);
+   free(pool);
+}
+
+/********************************************************************/
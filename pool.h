@@ -0,0 +1,70 @@
+/* pool.h
+ *
+ * A pool of worker threads for splitting a search into tasks that
+ * run at once. A job is a function and a number of tasks; each task
+ * is a call of the function with the task's number. The thread that
+ * runs a job works on its tasks too, and returns once every task is
+ * done.
+ *
+ * The tasks of a job are dealt out evenly to the workers when it
+ * starts. Each worker runs its own tasks in order, and a worker that
+ * runs out steals the back half of the tasks another worker has
+ * left, so a few long tasks don't hold up the rest.
+ *
+ * One job runs at a time; a thread that runs a job while another is
+ * running waits for it to finish. A task must not run a job on the
+ * same pool.
+ */
+
+#ifndef __regex_pool
+#define __regex_pool
+
+typedef struct _pool pool_t;
+
+/* task
+ *
+ * The function of a job. It's given the job's argument, the number
+ * of the task, and the number of the worker running it, which is
+ * less than the number of workers in the pool. No two tasks run on
+ * the same worker at once, so the worker's number can pick out
+ * memory for the task to use.
+ */
+typedef void (*task_f)(void*, int, int);
+
+/** new
+  *
+  * Make a pool with the given number of workers, counting the thread
+  * that runs a job, so a pool of one worker has no threads of its
+  * own.
+  */
+pool_t* pool_new(int);
+
+/** shared
+  *
+  * Get the pool used by the engine, which has one worker for every
+  * online processor. It's made the first time it's asked for, and
+  * lives until the program exits.
+  */
+pool_t* pool_shared();
+
+/** workers
+  *
+  * Get the number of workers in the pool.
+  */
+int pool_workers(pool_t*);
+
+/** run
+  *
+  * Run a job of the given number of tasks, and return once they're
+  * all done.
+  */
+void pool_run(pool_t*, task_f, void*, int);
+
+/** free
+  *
+  * Stop the pool's threads and deallocate it. The pool must not be
+  * running a job.
+  */
+void pool_free(pool_t*);
+
+#endif
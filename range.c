@@ -32,6 +32,11 @@ int range_size(range_t* ra) {
    return ra->size;
 }
 
+void range_clear(range_t* ra) {
+   assert(ra);
+   memset(ra->groups, 0, ra->size * sizeof(group_t));
+}
+
 range_t* range_copy(range_t* that) {
    assert(that);
    range_t* ra = range_new(that->size);
@@ -38,6 +38,12 @@ group_t* range_group(range_t*, int);
   */
 int range_size(range_t*);
 
+/** clear
+  *
+  * Null out every group, so the range can be used for another match.
+  */
+void range_clear(range_t*);
+
 /** copy
   *
   * Copy the range struct.
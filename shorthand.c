@@ -0,0 +1,56 @@
+/* shorthand.c
+ *
+ * The shorthand tables.
+ */
+
+#include <stddef.h>
+
+#include "shorthand.h"
+
+#define Ranges(NAME) NAME, sizeof(NAME) / sizeof(urange32_t)
+
+static const urange32_t digit[] = { {'0', '9'} };
+static const urange32_t word[]  = { {'0', '9'}, {'A', 'Z'}, {'_', '_'},
+                                    {'a', 'z'} };
+static const urange32_t space[] = { {'\t', '\n'}, {'\f', '\r'},
+                                    {' ', ' '} };
+static const urange32_t hex[]   = { {'0', '9'}, {'A', 'F'}, {'a', 'f'} };
+
+// '\0', '\n', '\v', '\f' and '\r'
+static const urange32_t newline[] = { {'\0', '\0'}, {'\n', '\r'} };
+
+static const shorthand_t shorthands[] = {
+   { Ranges(digit),   false },     // d
+   { Ranges(digit),   true  },     // D
+   { Ranges(word),    false },     // w
+   { Ranges(word),    true  },     // W
+   { Ranges(space),   false },     // s
+   { Ranges(space),   true  },     // S
+   { Ranges(hex),     false },     // h
+   { Ranges(hex),     true  },     // H
+   { Ranges(newline), true  }      // N
+};
+
+const shorthand_t* shorthand_find(char letter) {
+   switch (letter) {
+      case 'd': return &shorthands[0];
+      case 'D': return &shorthands[1];
+      case 'w': return &shorthands[2];
+      case 'W': return &shorthands[3];
+      case 's': return &shorthands[4];
+      case 'S': return &shorthands[5];
+      case 'h': return &shorthands[6];
+      case 'H': return &shorthands[7];
+      case 'N': return &shorthands[8];
+      default:  return NULL;
+   }
+}
+
+const bool word_bytes[256] = {
+   ['0' ... '9'] = true,
+   ['A' ... 'Z'] = true,
+   ['_'] = true,
+   ['a' ... 'z'] = true
+};
+
+/********************************************************************/
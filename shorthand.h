@@ -0,0 +1,41 @@
+/* shorthand.h
+ *
+ * Constant tables for the shorthand character classes, so that the
+ * parser and the matchers never have to build them. Each shorthand
+ * is an array of ranges in the form class_from_ranges takes, and the
+ * word characters also have a table indexed by byte for the word
+ * anchor matchers.
+ */
+
+#ifndef __regex_shorthand
+#define __regex_shorthand
+
+#include <stdbool.h>
+#include "util.h"
+
+/* shorthand
+ *
+ * The ranges of a shorthand class. If negate is true, the class
+ * matches every codepoint that isn't in the ranges.
+ */
+typedef struct {
+   const urange32_t* ranges;
+   int nranges;
+   bool negate;
+} shorthand_t;
+
+/** find
+  *
+  * Get the shorthand for the letter after a backslash: one of
+  * 'dDwWsShH', or 'N' for any character except a newline, which is
+  * also what '.' matches. Return NULL for any other letter.
+  */
+const shorthand_t* shorthand_find(char);
+
+/* word_bytes
+ *
+ * True for the bytes that are word characters, '[a-zA-Z0-9_]'.
+ */
+extern const bool word_bytes[256];
+
+#endif
@@ -6,8 +6,13 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 #include "class.h"
+#include "charset.h"
 #include "core.h"
 #include "parser.h"
 #include "factory.h"
@@ -15,6 +20,14 @@
 #include "range.h"
 #include "util.h"
 #include "obhash.h"
+#include "arena.h"
+#include "pcache.h"
+#include "strsearch.h"
+#include "literal.h"
+#include "simd.h"
+#include "pool.h"
+#include "stats.h"
+#include "shre_errno.h"
 #include "shre.h"
 
 /* pattern
@@ -22,10 +35,62 @@
  * Declaration of the pattern object, which is more or less
  * a wrapper for a core object.
  */
+typedef struct _image image_t;
+
 struct _pattern {
    core_t* core;
    obhash_t* names;    // named groups
    char* regex;        // the string passed into compile
+   litset_t* alternation; // used instead of core for literal
+                          //   alternations
+   strsearch_t* literal; // used instead of core for a single literal
+   inner_t* inner;     // literal that every match contains
+   litset_t* prefixes; // literals that every match begins with
+   int litgroup;       // group that holds the literal(s), or 0
+   charset_t** charsets; // interned charsets the core shares
+   int ncharsets;
+   int ngroups;        // size of the group capture array
+   int refs;           // references held by caches, callers and
+                       //   matches
+   size_t size;        // bytes in the block the pattern was compiled
+                       //   into, or 0 if it came from an image
+   image_t* image;     // image the pattern was loaded from, or NULL
+#ifdef SHRE_STATS
+   shre_stats_t stats; // totals of the searches for the pattern
+#endif
+};
+
+/* image
+ *
+ * A block of patterns loaded from a file or placed in shared memory.
+ * The patterns' cores, names and regex strings live in the block,
+ * which is freed once none of its patterns are left. The pattern
+ * objects themselves are separate, since their reference counts and
+ * fast paths are written after the block is made.
+ */
+struct _image {
+   int refs;           // patterns still using the block
+   void* block;
+   size_t mapped;      // length of the mapping, or 0 if block was
+                       //   malloc'd
+};
+
+/* index
+ *
+ * Root object of a pattern image.
+ */
+typedef struct {
+   size_t n;
+   pattern_t* patterns[];
+} index_t;
+
+/* engine
+ *
+ * Declaration of the engine context. Each engine has its own pattern
+ * cache, which can be shared between threads.
+ */
+struct _engine {
+   pcache_t* cache;
 };
 
 /* match
@@ -34,9 +99,11 @@ struct _pattern {
  * which represent group captures.
  */
 struct _match {
-   obhash_t* names;
+   pattern_t* pattern; // holds a reference
    range_t* groups;
-   uint32_t offset;
+   size_t offset;
+   char* text;         // the input the groups point into, if the match
+                       //   owns a copy of it
 };
 
 /* scanner
@@ -48,8 +115,76 @@ struct _scanner {
    pattern_t* pattern;
    char* start;
    char* curr;
+   char* last;      // the null terminating character, once it's known
 };
 
+/* stream
+ *
+ * Declaration of stream struct. buf holds the input that's kept,
+ * followed by a null character; positions in buf are offsets from
+ * its beginning, which is base bytes from the beginning of the
+ * stream. Every position before curr has been searched, and
+ * positions before the byte before curr are dropped.
+ */
+struct _stream {
+   pattern_t* pattern;  // holds a reference
+   char* buf;
+   size_t len;
+   size_t cap;
+   size_t base;
+   size_t curr;
+};
+
+/* found
+ *
+ * A match found by a parallel search, before it's made into a match
+ * object. next is where a scanner that found the match would go on
+ * searching from.
+ */
+typedef struct {
+   range_t* groups;
+   char* next;
+} found_t;
+
+/* chunk
+ *
+ * A piece of the input of a parallel search, and the matches that
+ * begin in it, as found by a scan that starts at lo.
+ */
+typedef struct {
+   char* lo;
+   char* hi;        // one after the last position of the chunk
+   found_t* found;
+   size_t n;
+   size_t cap;
+} chunk_t;
+
+/* parallel
+ *
+ * A parallel search, which is the argument of the pool's job.
+ */
+typedef struct {
+   pattern_t* pattern;
+   char* head;
+   char* last;
+   chunk_t* chunks;
+} parallel_t;
+
+/* batch
+ *
+ * A batch search, which is the argument of the pool's job. Each
+ * worker has a range for the captures of its searches, big enough
+ * for any of the patterns.
+ */
+typedef struct {
+   pattern_t** patterns;
+   size_t npatterns;
+   char** inputs;
+   size_t n;
+   span_t* results;
+   range_t** scratch;   // one for each worker
+} batch_t;
+
 // static functions
 //   The functions 'match_new' and 'free_pattern' shouldn't be called
 //   by the user.
@@ -58,158 +193,1092 @@ struct _scanner {
   *
   * Make a new match object from the return value of core_match.
   */
-static match_t* match_new(range_t*, obhash_t*, int);
+static match_t* match_new(range_t*, pattern_t*, size_t);
 
 /** free_pattern
   *
-  * Deallocate the memory used by a pattern object. Don't free
-  * the regex string, since that will be freed in the hash table.
+  * Deallocate the memory used by a pattern object. Called when the
+  * last reference is released.
   */
 static void free_pattern(pattern_t* pattern) {
-   obhash_free(pattern->names);
-   core_free(pattern->core);
-   free(pattern);
+   litset_free(pattern->alternation);
+   strsearch_free(pattern->literal);
+   inner_free(pattern->inner);
+   litset_free(pattern->prefixes);
+   image_t* image = pattern->image;
+   if (image) {
+      if (__atomic_sub_fetch(&image->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+         if (image->mapped)
+            munmap(image->block, image->mapped);
+         else
+            free(image->block);
+         free(image);
+      }
+   }
+   for (int i = 0; i < pattern->ncharsets; ++i)
+      charset_release(pattern->charsets[i]);
+   free(pattern);   // a compiled pattern's block holds the rest
 }
 
 
-/*************************global variables***************************/
+/** literal_groups
+  *
+  * Fill in the group captures that the core would have made for a
+  * match of a literal or an alternation of literals.
+  */
+static range_t* literal_groups(pattern_t* pattern, range_t* groups,
+                                         char* begin, char* end) {
+   range_clear(groups);
+   range_group(groups, 0)->begin = begin;
+   range_group(groups, 0)->end   = end;
+   if (pattern->litgroup > 0) {
+      range_group(groups, pattern->litgroup)->begin = begin;
+      range_group(groups, pattern->litgroup)->end   = end;
+   }
+   return groups;
+}
+
+/** bound
+  *
+  * Get how far a searcher has to look to find every occurrence that
+  * begins before stop, given the searcher's reach. Every search stops
+  * at last, and a NULL stop or a negative reach means there's no
+  * bound.
+  */
+static inline char* bound(char* stop, int reach, char* last) {
+   if (!stop || reach < 0 || last - stop < reach)
+      return last;
+   return stop + reach - 1;
+}
+
+/** passed
+  *
+  * Note that a searcher with the given reach has passed over the
+  * positions before the given one. If an occurrence beginning at one
+  * of them could be cut off by the end of the input, more input could
+  * finish it, so the search has read the end in the sense of
+  * atom_read_end. A NULL position means every position up to last.
+  */
+static inline void passed(char* before, int reach, char* last) {
+   if (!before)
+      before = last + 1;
+   if (reach < 0 || last - before < reach - 1)
+      atom_read_end = true;
+}
 
-obhash_t* ptable = NULL;    // global pattern hash table
+/** find_literal
+  *
+  * Search for a pattern that is a single literal with a substring
+  * search. The substring search needs to know where the input ends;
+  * *last caches the position of the null terminating character
+  * between calls, and is NULL if it hasn't been found yet. If stop
+  * isn't NULL, no match that begins at or after it is found. The
+  * captures are written to groups, which is returned on a match.
+  */
+static range_t* find_literal(pattern_t* pattern, char* str,
+                             char** last, char* stop,
+                             range_t* groups, char** end) {
+   if (!*last)
+      *last = str + strlen(str);
+   int len = strsearch_length(pattern->literal);
+   char* limit = bound(stop, len, *last);
+   char* begin = strsearch_find(pattern->literal, str, limit);
+   StatAdd(skips, (begin ? begin : limit) - str);
+   if (!begin) {
+      passed(stop, len, *last);
+      return NULL;
+   }
+   *end = begin + len;
+   return literal_groups(pattern, groups, begin, *end);
+}
 
-class_t* word_characters = NULL;    // values of word characters
+/** find_alternation
+  *
+  * Search for a pattern that is an alternation of literals with a
+  * literal set. The other arguments are as in find_literal.
+  */
+static range_t* find_alternation(pattern_t* pattern, char* str,
+                             char** last, char* stop,
+                             range_t* groups, char** end) {
+   if (!*last)
+      *last = str + strlen(str);
+   litset_t* set = pattern->alternation;
+   int reach = litset_reach(set);
+   char* limit = bound(stop, reach, *last);
+   char* begin = litset_search(set, str, limit, end);
+   StatAdd(skips, (begin ? begin : limit) - str);
+   if (!begin || (stop && begin >= stop)) {
+      passed(stop, reach, *last);
+      return NULL;
+   }
 
-char* trash;
+   // an earlier literal in the set might still match here
+   passed(begin + 1, reach, *last);
+   return literal_groups(pattern, groups, begin, *end);
+}
+
+/** find_inner
+  *
+  * Search for a pattern that has an inner literal. Only try the
+  * positions that inner_window says a match could begin at.
+  */
+static range_t* find_inner(pattern_t* pattern, char* str, char* head,
+                             char** last, char* stop,
+                             range_t* groups, char** end) {
+   if (!*last)
+      *last = str + strlen(str);
+   int reach = inner_reach(pattern->inner);
+   char* limit = bound(stop, reach, *last);
+   char* hi;
+   char* from = str;
+   while ((str = inner_window(pattern->inner, str, limit, &hi))) {
+      StatAdd(skips, str - from);
+      for (; str <= hi; ++str) {
+         if (stop && str >= stop) {
+            passed(stop, reach, *last);
+            return NULL;
+         }
+         StatCount(starts);
+         range_clear(groups);
+         if (core_match(pattern->core, str, NULL, groups,
+                                       NULL, 0, end, head))
+            return groups;
+      }
+      from = str;
+   }
+   StatAdd(skips, limit > from ? limit - from : 0);
+   passed(stop, reach, *last);
+   return NULL;
+}
+
+/** find_prefixed
+  *
+  * Search for a pattern whose matches all begin with one of a set of
+  * literals. Only try the positions where one of the literals occurs.
+  */
+static range_t* find_prefixed(pattern_t* pattern, char* str, char* head,
+                             char** last, char* stop,
+                             range_t* groups, char** end) {
+   if (!*last)
+      *last = str + strlen(str);
+   litset_t* set = pattern->prefixes;
+   int reach = litset_reach(set);
+   char* limit = bound(stop, reach, *last);
+   char* lend;
+   char* from = str;
+   while ((str = litset_search(set, str, limit, &lend))) {
+      StatAdd(skips, str - from);
+      if (stop && str >= stop) {
+         passed(stop, reach, *last);
+         return NULL;
+      }
+      passed(str, reach, *last);
+      StatCount(starts);
+      range_clear(groups);
+      if (core_match(pattern->core, str, NULL, groups,
+                                    NULL, 0, end, head))
+         return groups;
+      from = ++str;
+   }
+   StatAdd(skips, limit > from ? limit - from : 0);
+   passed(stop, reach, *last);
+   return NULL;
+}
+
+/** pattern_find
+  *
+  * Find the leftmost match of the pattern, trying positions from str
+  * onward, and before stop if it isn't NULL. Return the group
+  * captures and set *end to one after the end of the match, or
+  * return NULL if there is no match. The head argument is the
+  * beginning of the whole input string, and *last is as in
+  * find_literal.
+  *
+  * The captures are written to groups if it isn't NULL, which must
+  * have room for the pattern's groups; otherwise a new range is made
+  * for them. Either way, the same range is used for every position
+  * that is tried.
+  */
+static range_t* pattern_find(pattern_t* pattern, char* str, char* head,
+                             char** last, char* stop,
+                             range_t* groups, char** end) {
+   range_t* scratch = groups ? groups : range_new(pattern->ngroups);
+   range_t* found = NULL;
+   if (pattern->literal) {
+      found = find_literal(pattern, str, last, stop, scratch, end);
+   } else if (pattern->alternation) {
+      found = find_alternation(pattern, str, last, stop, scratch, end);
+   } else if (pattern->inner) {
+      found = find_inner(pattern, str, head, last, stop, scratch, end);
+   } else if (pattern->prefixes) {
+      found = find_prefixed(pattern, str, head, last, stop, scratch, end);
+   } else {
+      for (; !stop || str < stop; ++str) {
+         StatCount(starts);
+         range_clear(scratch);
+         found = core_match(pattern->core, str, NULL, scratch,
+                                          NULL, 0, end, head);
+         if (found || *str == '\0')
+            break;
+      }
+   }
+   if (!found && !groups)
+      range_free(scratch);
+#ifdef SHRE_STATS
+   stats_finish(&pattern->stats);
+#endif
+   return found;
+}
+
+/** pattern_entire
+  *
+  * Match the pattern against the entire string. Return the group
+  * captures, or NULL if the pattern doesn't match the entire string.
+  */
+static range_t* pattern_entire(pattern_t* pattern, char* str) {
+   char* end;
+   if (pattern->literal) {
+      if (!strsearch_equal(pattern->literal, str))
+         return NULL;
+      return literal_groups(pattern, range_new(pattern->ngroups), str,
+                            str + strsearch_length(pattern->literal));
+   }
+   StatCount(starts);
+   range_t* groups = core_match(pattern->core, str, NULL, NULL,
+                                                NULL, 0, &end, str);
+#ifdef SHRE_STATS
+   stats_finish(&pattern->stats);
+#endif
+   if (groups && *end != '\0') {
+      range_free(groups);
+      return NULL;
+   }
+   return groups;
+}
+
+/*************************global variables***************************/
+
+// the engine used by the functions that don't take one; only changed
+//   by start_regex_engine and cleanup_regex_engine
+static engine_t* default_engine = NULL;
 
 /**************************regex engine functions********************/
 
 void start_regex_engine() {
-   assert(!ptable);
-   ptable = obhash_new( (void (*)(void*)) &free_pattern);
-   word_characters = parse_class("[\\w]");
+   assert(!default_engine);
+   default_engine = engine_new();
 }
 
 bool engine_is_initialized() {
-   return ptable;
+   return default_engine;
 }
 
 int num_patterns() {
-   assert(ptable);
-   return obhash_size(ptable);
+   assert(default_engine);
+   return engine_num_patterns(default_engine);
+}
+
+long num_cache_hits() {
+   assert(default_engine);
+   return engine_num_cache_hits(default_engine);
+}
+
+long num_cache_misses() {
+   assert(default_engine);
+   return engine_num_cache_misses(default_engine);
+}
+
+long num_cache_evictions() {
+   assert(default_engine);
+   return engine_num_cache_evictions(default_engine);
+}
+
+size_t cache_bytes() {
+   assert(default_engine);
+   return engine_cache_bytes(default_engine);
+}
+
+void set_cache_limit(int max_patterns, size_t max_bytes) {
+   assert(default_engine);
+   engine_set_cache_limit(default_engine, max_patterns, max_bytes);
 }
 
 void clear_cache() {
-   assert(ptable);
-   obhash_clear(ptable);
+   assert(default_engine);
+   engine_clear_cache(default_engine);
+}
+
+bool save_cache(char* path) {
+   assert(default_engine);
+   return engine_save(default_engine, path);
+}
+
+int load_cache(char* path) {
+   assert(default_engine);
+   return engine_load(default_engine, path);
+}
+
+int share_cache() {
+   assert(default_engine);
+   return engine_share(default_engine);
 }
 
 void cleanup_regex_engine() {
-   assert(ptable);
-   obhash_free(ptable);
-   ptable = NULL;
-   class_free(word_characters);
-   word_characters = NULL;
+   assert(default_engine);
+   engine_free(default_engine);
+   default_engine = NULL;
 }
 
-/*****************************regex operations***********************/
+/*************************engine operations**************************/
 
-pattern_t* shre_compile(char* regex) {
-   assert(ptable);
-   assert(regex);
-   
-   // look for pattern in hashtable
-   pattern_t* pattern = (pattern_t*) obhash_find(ptable, regex);
-   if (pattern)
-      return pattern;
+/** find_fast_paths
+  *
+  * Look for literals in the core that let searches skip it. These
+  * objects depend on the instruction sets of the machine, so they're
+  * never put in an image; a loaded pattern gets new ones.
+  */
+static void find_fast_paths(pattern_t* pattern) {
+   int* group = &pattern->litgroup;
+   pattern->literal = literal_whole(pattern->core, group);
+   pattern->alternation = pattern->literal ? NULL
+                        : literal_alternation(pattern->core, group);
+   pattern->inner = pattern->literal || pattern->alternation ? NULL
+                  : literal_inner(pattern->core);
+   pattern->prefixes = pattern->literal || pattern->alternation
+                       || pattern->inner ? NULL
+                       : literal_prefixes(pattern->core);
+}
+
+/** pack_pattern
+  *
+  * Copy everything in a pattern except the fast paths into an arena.
+  * Return the offset of the copy.
+  */
+static size_t pack_pattern(pattern_t* pattern, arena_t* arena) {
+   size_t at = arena_alloc(arena, sizeof(pattern_t));
+   pattern_t* copy = arena_at(arena, at);
+   copy->ngroups = pattern->ngroups;
+   arena_link(arena, at + offsetof(pattern_t, regex),
+                     arena_strdup(arena, pattern->regex));
+   arena_link(arena, at + offsetof(pattern_t, core),
+                     core_pack(pattern->core, arena));
+   if (pattern->names)
+      arena_link(arena, at + offsetof(pattern_t, names),
+                        obhash_pack(pattern->names, arena, sizeof(int)));
 
-   // build a new pattern
+   // a local arena shares charsets instead of copying them; the
+   //   pattern keeps a list of them to release when it's freed
+   size_t n;
+   void** externs = arena_externs(arena, &n);
+   if (n) {
+      size_t list = arena_alloc(arena, n * sizeof(charset_t*));
+      memcpy(arena_at(arena, list), externs, n * sizeof(charset_t*));
+      arena_link(arena, at + offsetof(pattern_t, charsets), list);
+      ((pattern_t*) arena_at(arena, at))->ncharsets = n;
+   }
+   return at;
+}
+
+/** compile_pattern
+  *
+  * Build a new pattern object with one reference. Return NULL and set
+  * shre_er if the regular expression is bad. Everything in the
+  * pattern except the reference count is filled in here; nothing
+  * changes it afterwards.
+  *
+  * The parser and builder make the core out of many small
+  * allocations. Once it's built, the pattern, its core, its names
+  * and its regex string are packed into a single block, which is
+  * freed with the pattern object.
+  */
+static pattern_t* compile_pattern(char* regex) {
    obhash_t* names = NULL;
    tlist_t* tokens = parse_regex(regex, &names);
    if (!tokens)
       return NULL;   // bad regular expression; shre_er is tree
-   pattern = malloc(sizeof(pattern_t));
-   assert(pattern);
-   pattern->regex = strdup(regex);
-   pattern->names = names;
-   pattern->core = build_core(tokens);
-   obhash_add(ptable, pattern->regex, pattern); // add new pattern
+   pattern_t built;
+   built.regex = regex;
+   built.names = names;
+   built.core = build_core(tokens);
+   built.ngroups = core_groups(built.core);
+
+   arena_t* arena = arena_new(true);
+   size_t at = pack_pattern(&built, arena);
+   size_t size = arena_size(arena);
+   pattern_t* pattern = arena_finish(arena, at);
+   obhash_free(names);
+   core_free(built.core);
+   pattern->size = size;
+   pattern->refs = 1;
+   pattern->image = NULL;
+#ifdef SHRE_STATS
+   memset(&pattern->stats, 0, sizeof(shre_stats_t));
+#endif
+   find_fast_paths(pattern);
    return pattern;
 }
 
+/** pattern_held
+  *
+  * Return true if anything besides the cache holds the pattern. The
+  * cache never evicts a pattern that's held.
+  */
+static bool pattern_held(pattern_t* pattern) {
+   return __atomic_load_n(&pattern->refs, __ATOMIC_RELAXED) > 1;
+}
+
+/** pattern_bytes
+  *
+  * Get the number of bytes of memory used by a pattern. This is what
+  * the cache's byte limit counts.
+  */
+static size_t pattern_bytes(pattern_t* pattern) {
+   size_t bytes = pattern->size;
+   if (!bytes) {
+      bytes = sizeof(pattern_t) + strlen(pattern->regex) + 1
+            + core_bytes(pattern->core);
+      if (pattern->names)
+         bytes += obhash_bytes(pattern->names)
+                + obhash_size(pattern->names) * sizeof(int);
+   }
+   if (pattern->literal)
+      bytes += strsearch_bytes(pattern->literal);
+   if (pattern->alternation)
+      bytes += litset_bytes(pattern->alternation);
+   if (pattern->inner)
+      bytes += inner_bytes(pattern->inner);
+   if (pattern->prefixes)
+      bytes += litset_bytes(pattern->prefixes);
+   return bytes;
+}
+
+// how the cache handles patterns
+static const pcache_ops_t pattern_ops = {
+   .compile = (void* (*)(char*)) &compile_pattern,
+   .retain  = (void (*)(void*)) &shre_retain,
+   .release = (void (*)(void*)) &shre_release,
+   .held    = (bool (*)(void*)) &pattern_held,
+   .bytes   = (size_t (*)(void*)) &pattern_bytes
+};
+
+engine_t* engine_new() {
+   simd_init();
+   engine_t* engine = malloc(sizeof(engine_t));
+   assert(engine);
+   engine->cache = pcache_new(&pattern_ops);
+   return engine;
+}
+
+pattern_t* engine_compile(engine_t* engine, char* regex) {
+   pattern_t* pattern = engine_acquire(engine, regex);
+   if (pattern)
+      shre_release(pattern);    // the cache still holds it
+   return pattern;
+}
+
+pattern_t* engine_compile_flags(engine_t* engine, char* regex, int flags) {
+   assert(regex);
+   if (!(flags & SHRE_CASELESS))
+      return engine_compile(engine, regex);
+   char* prefixed = malloc(strlen(regex) + 5);
+   assert(prefixed);
+   strcpy(prefixed, "(?i)");
+   strcat(prefixed, regex);
+   pattern_t* pattern = engine_compile(engine, prefixed);
+   free(prefixed);
+   return pattern;
+}
+
+pattern_t* engine_acquire(engine_t* engine, char* regex) {
+   assert(engine);
+   assert(regex);
+   return pcache_get(engine->cache, regex);
+}
+
+bool engine_quick_search(engine_t* engine, char* regex, char* str) {
+   assert(str);
+   pattern_t* pattern = engine_acquire(engine, regex);
+   if (!pattern)
+      return false;
+   char* last = NULL;
+   char* end;
+   range_t* groups = pattern_find(pattern, str, str, &last,
+                                  NULL, NULL, &end);
+   shre_release(pattern);
+   if (groups) {
+      range_free(groups);
+      return true;
+   }
+   return false;
+}
+
+bool engine_quick_entire(engine_t* engine, char* regex, char* str) {
+   assert(str);
+   pattern_t* pattern = engine_acquire(engine, regex);
+   if (!pattern)
+      return false;
+   range_t* groups = pattern_entire(pattern, str);
+   shre_release(pattern);
+   if (!groups)
+      return false;
+   range_free(groups);
+   return true;
+}
+
+int engine_num_patterns(engine_t* engine) {
+   assert(engine);
+   return pcache_size(engine->cache);
+}
+
+long engine_num_cache_hits(engine_t* engine) {
+   assert(engine);
+   pcache_stats_t stats;
+   pcache_stats(engine->cache, &stats);
+   return stats.hits;
+}
+
+long engine_num_cache_misses(engine_t* engine) {
+   assert(engine);
+   pcache_stats_t stats;
+   pcache_stats(engine->cache, &stats);
+   return stats.misses;
+}
+
+long engine_num_cache_evictions(engine_t* engine) {
+   assert(engine);
+   pcache_stats_t stats;
+   pcache_stats(engine->cache, &stats);
+   return stats.evictions;
+}
+
+size_t engine_cache_bytes(engine_t* engine) {
+   assert(engine);
+   pcache_stats_t stats;
+   pcache_stats(engine->cache, &stats);
+   return stats.bytes;
+}
+
+void engine_set_cache_limit(engine_t* engine,
+                            int max_patterns, size_t max_bytes) {
+   assert(engine);
+   pcache_limit(engine->cache, max_patterns, max_bytes);
+}
+
+void engine_clear_cache(engine_t* engine) {
+   assert(engine);
+   pcache_clear(engine->cache);
+}
+
+/** pack_cache
+  *
+  * Copy every pattern in an engine's cache into a new arena, under an
+  * index. Set *index to the offset of the index.
+  */
+static arena_t* pack_cache(engine_t* engine, size_t* index) {
+   int n;
+   pattern_t** patterns = (pattern_t**) pcache_snapshot(engine->cache, &n);
+   arena_t* arena = arena_new(false);
+   *index = arena_alloc(arena, sizeof(index_t) + n * sizeof(pattern_t*));
+   ((index_t*) arena_at(arena, *index))->n = n;
+   for (int i = 0; i < n; ++i) {
+      arena_link(arena, *index + offsetof(index_t, patterns)
+                               + i * sizeof(pattern_t*),
+                        pack_pattern(patterns[i], arena));
+      shre_release(patterns[i]);
+   }
+   free(patterns);
+   return arena;
+}
+
+/** adopt_image
+  *
+  * Put the patterns of an image into an engine's cache. Each one gets
+  * a pattern object of its own that refers to the core, names and
+  * regex string in the block, and new fast paths. Return the number of
+  * patterns in the image; the image is freed if there are none.
+  */
+static int adopt_image(engine_t* engine, index_t* index, void* block,
+                                                    size_t mapped) {
+   int n = index->n;
+   if (!n) {
+      if (mapped)
+         munmap(block, mapped);
+      else
+         free(block);
+      return 0;
+   }
+   image_t* image = malloc(sizeof(image_t));
+   assert(image);
+   image->refs = n;
+   image->block = block;
+   image->mapped = mapped;
+   for (int i = 0; i < n; ++i) {
+      pattern_t* packed = index->patterns[i];
+      pattern_t* pattern = malloc(sizeof(pattern_t));
+      assert(pattern);
+      pattern->core = packed->core;
+      pattern->names = packed->names;
+      pattern->regex = packed->regex;
+      pattern->ngroups = packed->ngroups;
+      pattern->charsets = NULL;
+      pattern->ncharsets = 0;
+      pattern->size = 0;
+      pattern->refs = 1;
+      pattern->image = image;
+#ifdef SHRE_STATS
+      memset(&pattern->stats, 0, sizeof(shre_stats_t));
+#endif
+      find_fast_paths(pattern);
+      pcache_put(engine->cache, pattern->regex, pattern);
+   }
+   return n;
+}
+
+bool engine_save(engine_t* engine, char* path) {
+   assert(engine && path);
+   size_t index;
+   arena_t* arena = pack_cache(engine, &index);
+   int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+   bool ok = fd >= 0 && arena_write(arena, index, fd);
+   if (fd >= 0 && close(fd) < 0)
+      ok = false;
+   arena_free(arena);
+   return ok;
+}
+
+int engine_load(engine_t* engine, char* path) {
+   assert(engine && path);
+   int fd = open(path, O_RDONLY);
+   if (fd < 0)
+      return -1;
+   void* block;
+   index_t* index = image_read(fd, &block);
+   close(fd);
+   if (!index)
+      return -1;
+   return adopt_image(engine, index, block, 0);
+}
+
+int engine_share(engine_t* engine) {
+   assert(engine);
+   size_t index;
+   arena_t* arena = pack_cache(engine, &index);
+   size_t size = arena_size(arena);
+   void* block = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+   if (block == MAP_FAILED) {
+      arena_free(arena);
+      return -1;
+   }
+   index_t* shared = arena_finish_at(arena, index, block);
+   if (mprotect(block, size, PROT_READ) < 0) {
+      munmap(block, size);
+      return -1;
+   }
+   engine_clear_cache(engine);
+   return adopt_image(engine, shared, block, size);
+}
+
+void engine_free(engine_t* engine) {
+   if (engine) {
+      pcache_free(engine->cache);
+      free(engine);
+   }
+}
+
+/*****************************regex operations***********************/
+
+pattern_t* shre_compile(char* regex) {
+   assert(default_engine);
+   return engine_compile(default_engine, regex);
+}
+
+pattern_t* shre_compile_flags(char* regex, int flags) {
+   assert(default_engine);
+   return engine_compile_flags(default_engine, regex, flags);
+}
+
+pattern_t* shre_acquire(char* regex) {
+   assert(default_engine);
+   return engine_acquire(default_engine, regex);
+}
+
+void shre_retain(pattern_t* pattern) {
+   assert(pattern);
+   __atomic_add_fetch(&pattern->refs, 1, __ATOMIC_RELAXED);
+}
+
+void shre_release(pattern_t* pattern) {
+   assert(pattern);
+   if (__atomic_sub_fetch(&pattern->refs, 1, __ATOMIC_ACQ_REL) == 0)
+      free_pattern(pattern);
+}
+
 const char* shre_expression(pattern_t* obj) {
-   assert(ptable);
    assert(obj);
    return obj->regex;
 }
 
 match_t* shre_search(pattern_t* pattern, char* str) {
-   assert(ptable);
    assert(pattern);
    assert(str);
-   char* start = str;
-   for (;; ++str) {
-      range_t* groups = core_match(pattern->core, str,
-                              NULL, NULL, NULL, 0, &trash, start);
-      if (groups)
-         return match_new(groups, pattern->names,
-                          range_group(groups, 0)->begin - start);
-      if (*str == '\0')
-         break;
-   }
+   char* last = NULL;
+   char* end;
+   range_t* groups = pattern_find(pattern, str, str, &last,
+                                  NULL, NULL, &end);
+   if (groups)
+      return match_new(groups, pattern,
+                       range_group(groups, 0)->begin - str);
    return NULL;
 }
 
 match_t* shre_entire(pattern_t* pattern, char* str) {
-   assert(ptable);
    assert(pattern);
    assert(str);
-   range_t* groups =
-          core_match(pattern->core, str, NULL, NULL,
-                                  NULL, 0, &trash, str);
+   range_t* groups = pattern_entire(pattern, str);
    if (!groups)
       return NULL;
-   if (*(range_group(groups, 0)->end) == '\0') {
-      return match_new(groups, pattern->names,
-                          range_group(groups, 0)->begin - str);
-   }
-   return NULL;
+   return match_new(groups, pattern, 0);
 }
 
 bool quick_search(char* regex, char* str) {
-   assert(regex);
-   assert(str);
-   pattern_t* pattern = shre_compile(regex);
-   if (!pattern)
-      return false;
-   char* start = str;
-   while (*str != '\0') {
-      range_t* groups =
-           core_match(pattern->core, ++str, NULL, NULL, 
-                                  NULL, 0, &trash, start);
-      if (groups) {
-         range_free(groups);
-         return true;
-      }
-   }
-   return false;
+   assert(default_engine);
+   return engine_quick_search(default_engine, regex, str);
 }
 
 bool quick_entire(char* regex, char* str) {
-   assert(regex);
-   assert(str);
-   pattern_t* pattern = shre_compile(regex);
-   if (!pattern)
-      return false;
-   range_t* groups =
-             core_match(pattern->core, str, NULL, NULL,
-                                       NULL, 0, &trash, str);
+   assert(default_engine);
+   return engine_quick_entire(default_engine, regex, str);
+}
+
+/*****************************parallel search************************/
+
+// A parallel search gives each worker about this many chunks, so
+//   that workers that finish early can take more, but makes no chunk
+//   smaller than CHUNK bytes.
+#define CHUNKS_PER_WORKER 4
+#define CHUNK (1 << 16)
+
+/** find_next
+  *
+  * Find the match that a scanner at curr would find next, if it
+  * begins before stop. Return false if there's no such match.
+  */
+static bool find_next(parallel_t* job, char* curr, char* stop,
+                                                  found_t* found) {
+   char* last = job->last;
+   char* end;
+   range_t* groups = pattern_find(job->pattern, curr, job->head,
+                                  &last, stop, NULL, &end);
    if (!groups)
       return false;
-   if (*(range_group(groups, 0)->end) == '\0') {
-      range_free(groups);
-      return true;
+   found->groups = groups;
+   found->next = end;
+   if (range_group(groups, 0)->begin == end)
+      ++found->next;    // past the end after an empty match there
+   return true;
+}
+
+/** add_found
+  *
+  * Add a match to the end of a chunk's list.
+  */
+static void add_found(chunk_t* chunk, found_t found) {
+   if (chunk->n == chunk->cap) {
+      chunk->cap = chunk->cap ? chunk->cap * 2 : 16;
+      chunk->found = realloc(chunk->found, chunk->cap * sizeof(found_t));
+      assert(chunk->found);
+   }
+   chunk->found[chunk->n++] = found;
+}
+
+/** found_matches
+  *
+  * Make an array of match objects, followed by NULL, from a list of
+  * matches found in str, which begins base bytes into the input, and
+  * deallocate the list. Set *n to the number of matches.
+  */
+static match_t** found_matches(chunk_t* all, pattern_t* pattern,
+                               char* str, size_t base, size_t* n) {
+   match_t** matches = malloc((all->n + 1) * sizeof(match_t*));
+   assert(matches);
+   for (size_t i = 0; i < all->n; ++i) {
+      range_t* groups = all->found[i].groups;
+      matches[i] = match_new(groups, pattern,
+                        base + (range_group(groups, 0)->begin - str));
+   }
+   matches[all->n] = NULL;
+   *n = all->n;
+   free(all->found);
+   return matches;
+}
+
+/** scan_chunk
+  *
+  * Task of a parallel search: find the matches that begin in a chunk,
+  * scanning from the beginning of the chunk.
+  */
+static void scan_chunk(void* arg, int i, int worker) {
+   (void) worker;
+   parallel_t* job = arg;
+   chunk_t* chunk = &job->chunks[i];
+   found_t found;
+   for (char* curr = chunk->lo; curr < chunk->hi
+                  && find_next(job, curr, chunk->hi, &found);
+                                           curr = found.next)
+      add_found(chunk, found);
+}
+
+/** splice
+  *
+  * Move the matches of a chunk onto the end of a list of the matches
+  * of the chunks before it. curr is where a scanner that found those
+  * matches would be; return where it is after this chunk's matches.
+  *
+  * If the last match before the chunk ends inside of it, the scan
+  * from the beginning of the chunk may have found matches that a
+  * scanner would skip over. Scan again from curr until a match is
+  * the same as one that was found from the beginning of the chunk;
+  * from there on, the two scans are the same.
+  */
+static char* splice(parallel_t* job, chunk_t* chunk, char* curr,
+                                                      chunk_t* all) {
+   size_t i = 0;
+   if (curr > chunk->lo) {
+      bool met = false;
+      found_t found;
+      while (!met && curr < chunk->hi
+                  && find_next(job, curr, chunk->hi, &found)) {
+         char* begin = range_group(found.groups, 0)->begin;
+         for (; i < chunk->n; ++i) {
+            if (range_group(chunk->found[i].groups, 0)->begin >= begin)
+               break;
+            range_free(chunk->found[i].groups);
+         }
+         met = i < chunk->n && chunk->found[i].next == found.next
+               && range_group(chunk->found[i].groups, 0)->begin == begin;
+         if (met) {
+            range_free(found.groups);
+         } else {
+            add_found(all, found);
+            curr = found.next;
+         }
+      }
+      if (!met) {
+         for (; i < chunk->n; ++i)
+            range_free(chunk->found[i].groups);
+      }
+   }
+   for (; i < chunk->n; ++i) {
+      add_found(all, chunk->found[i]);
+      curr = chunk->found[i].next;
+   }
+   free(chunk->found);
+   return curr;
+}
+
+match_t** shre_search_parallel(pattern_t* pattern, char* str,
+                                         size_t len, size_t* n) {
+   assert(pattern && str && n);
+   assert(str[len] == '\0');
+   pool_t* pool = pool_shared();
+   size_t nchunks = pool_workers(pool) * CHUNKS_PER_WORKER;
+   if (len / nchunks < CHUNK)
+      nchunks = len / CHUNK + 1;
+
+   parallel_t job;
+   job.pattern = pattern;
+   job.head = str;
+   job.last = str + len;
+   job.chunks = calloc(nchunks, sizeof(chunk_t));
+   assert(job.chunks);
+   for (size_t i = 0; i < nchunks; ++i) {
+      job.chunks[i].lo = str + len * i / nchunks;
+      job.chunks[i].hi = str + len * (i + 1) / nchunks;
+   }
+   job.chunks[nchunks - 1].hi = job.last + 1;  // an empty match can
+                                               //   begin at the end
+   if (nchunks == 1)
+      scan_chunk(&job, 0, 0);
+   else
+      pool_run(pool, scan_chunk, &job, nchunks);
+
+   chunk_t all = { NULL, NULL, NULL, 0, 0 };
+   char* curr = str;
+   for (size_t i = 0; i < nchunks; ++i)
+      curr = splice(&job, &job.chunks[i], curr, &all);
+   free(job.chunks);
+
+   return found_matches(&all, pattern, str, 0, n);
+}
+
+// Each task of a batch search searches this many inputs, so that
+//   workers don't take a lock for every input.
+#define BATCH 64
+
+/** search_inputs
+  *
+  * Task of a batch search: search a group of BATCH inputs for every
+  * pattern.
+  */
+static void search_inputs(void* arg, int task, int worker) {
+   batch_t* job = arg;
+   range_t* scratch = job->scratch[worker];
+   size_t lo = (size_t) task * BATCH;
+   size_t hi = lo + BATCH < job->n ? lo + BATCH : job->n;
+   for (size_t i = lo; i < hi; ++i) {
+      char* str = job->inputs[i];
+      assert(str);
+      char* last = NULL;
+      for (size_t j = 0; j < job->npatterns; ++j) {
+         span_t* span = &job->results[i * job->npatterns + j];
+         char* end;
+         if (pattern_find(job->patterns[j], str, str, &last,
+                                          NULL, scratch, &end)) {
+            span->begin = range_group(scratch, 0)->begin - str;
+            span->end = end - str;
+         } else {
+            span->begin = span->end = -1;
+         }
+      }
+   }
+}
+
+size_t shre_search_batch_set(pattern_t** patterns, size_t npatterns,
+                 char** inputs, size_t n, span_t* results) {
+   assert(patterns && inputs && results);
+   if (!npatterns || !n)
+      return 0;
+   int ngroups = 1;
+   for (size_t j = 0; j < npatterns; ++j) {
+      assert(patterns[j]);
+      if (patterns[j]->ngroups > ngroups)
+         ngroups = patterns[j]->ngroups;
+   }
+   pool_t* pool = pool_shared();
+   size_t ntasks = (n + BATCH - 1) / BATCH;
+   assert(ntasks <= INT_MAX);
+   int workers = ntasks == 1 ? 1 : pool_workers(pool);
+
+   batch_t job;
+   job.patterns = patterns;
+   job.npatterns = npatterns;
+   job.inputs = inputs;
+   job.n = n;
+   job.results = results;
+   job.scratch = malloc(workers * sizeof(range_t*));
+   assert(job.scratch);
+   for (int i = 0; i < workers; ++i)
+      job.scratch[i] = range_new(ngroups);
+   if (ntasks == 1)
+      search_inputs(&job, 0, 0);
+   else
+      pool_run(pool, search_inputs, &job, ntasks);
+   for (int i = 0; i < workers; ++i)
+      range_free(job.scratch[i]);
+   free(job.scratch);
+
+   size_t matched = 0;
+   for (size_t i = 0; i < n * npatterns; ++i)
+      matched += results[i].begin >= 0;
+   return matched;
+}
+
+size_t shre_search_batch(pattern_t* pattern, char** inputs, size_t n,
+                                                 span_t* results) {
+   assert(pattern);
+   return shre_search_batch_set(&pattern, 1, inputs, n, results);
+}
+
+/** candidate
+  *
+  * Find the first position from str up to last that is on a line
+  * that could hold a match, using the pattern's literals. Return
+  * NULL if there's no such line. If the pattern is a literal, so
+  * that the occurrence found is a match, set *sure to one after its
+  * end; otherwise set it to NULL.
+  */
+static char* candidate(pattern_t* pattern, char* str, char* last,
+                                                      char** sure) {
+   char* hit;
+   *sure = NULL;
+   if (pattern->literal) {
+      hit = strsearch_find(pattern->literal, str, last);
+      if (hit)
+         *sure = hit + strsearch_length(pattern->literal);
+      return hit;
+   }
+   if (pattern->alternation) {
+      hit = litset_search(pattern->alternation, str, last, sure);
+      if (!hit)
+         *sure = NULL;
+      return hit;
+   }
+   if (pattern->inner) {
+      char* hi;
+      return inner_window(pattern->inner, str, last, &hi) ? hi : NULL;
+   }
+   if (pattern->prefixes) {
+      char* end;
+      return litset_search(pattern->prefixes, str, last, &end);
+   }
+   return str;
+}
+
+size_t shre_search_lines(pattern_t* pattern, char* buf, size_t len,
+                                                   span_t** lines) {
+   assert(pattern && buf && lines);
+   span_t* spans = NULL;
+   size_t n = 0, cap = 0;
+   size_t linecap = 256;
+   char* line = malloc(linecap);
+   assert(line);
+   range_t* groups = range_new(pattern->ngroups);
+
+   char* last = buf + len;
+   char* hit;
+   char* sure;
+   for (char* str = buf; str < last
+                  && (hit = candidate(pattern, str, last, &sure)); ) {
+      char* lo = hit;
+      while (lo > str && lo[-1] != '\n')
+         --lo;
+      char* hi = memchr(hit, '\n', last - hit);
+      if (!hi)
+         hi = last;
+      str = hi + 1;
+
+      // search a null terminated copy of the line, unless the
+      //   occurrence found is a match inside of it
+      if (!sure || sure > hi) {
+         size_t size = hi - lo;
+         if (size >= linecap) {
+            while (size >= linecap)
+               linecap *= 2;
+            line = realloc(line, linecap);
+            assert(line);
+         }
+         memcpy(line, lo, size);
+         line[size] = '\0';
+         char* linelast = line + size;
+         char* end;
+         if (!pattern_find(pattern, line, line, &linelast,
+                                          NULL, groups, &end))
+            continue;
+      }
+      if (n == cap) {
+         cap = cap ? cap * 2 : 64;
+         spans = realloc(spans, cap * sizeof(span_t));
+         assert(spans);
+      }
+      spans[n].begin = lo - buf;
+      spans[n].end = hi - buf;
+      ++n;
    }
    range_free(groups);
-   return false;
+   free(line);
+   *lines = spans;
+   return n;
 }
 
 /*****************************match operations************************/
@@ -225,11 +1294,17 @@ int match_num_groups(match_t* match) {
    return range_size(match->groups);;
 }
 
-uint32_t match_offset(match_t* match) {
+size_t match_offset(match_t* match) {
    assert(match);
    return match->offset;
 }
 
+size_t match_length(match_t* match) {
+   assert(match);
+   group_t* main = range_group(match->groups, 0);
+   return main->end - main->begin;
+}
+
 char* match_group(match_t* match, int gr) {
    assert(match);
    group_t* captcha = range_group(match->groups, gr);
@@ -241,25 +1316,59 @@ char* match_group(match_t* match, int gr) {
 char* match_named_group(match_t* match, char* grname) {
    assert(match);
    int* gr = NULL;
-   if (match->names)
-      gr = (int*) obhash_find(match->names, grname);
+   if (match->pattern->names)
+      gr = (int*) obhash_find(match->pattern->names, grname);
    if (!gr)
       return NULL;
    return match_group(match, *gr);
 }
 
-match_t* match_new(range_t* groups, obhash_t* names, int offset) {
+match_t* match_new(range_t* groups, pattern_t* pattern, size_t offset) {
    match_t* match = malloc(sizeof(match_t));
    assert(match);
+   shre_retain(pattern);
    match->offset = offset;
-   match->names = names;
+   match->pattern = pattern;
    match->groups = groups;
+   match->text = NULL;
    return match;
 }
 
+/** match_detach
+  *
+  * Give a match its own copy of the part of the input that its
+  * groups point into, so that it outlives the input.
+  */
+static void match_detach(match_t* match) {
+   char* lo = NULL;
+   char* hi = NULL;
+   for (int i = 0; i < range_size(match->groups); ++i) {
+      group_t* group = range_group(match->groups, i);
+      if (!group->begin)
+         continue;
+      if (!lo || group->begin < lo)
+         lo = group->begin;
+      if (!hi || group->end > hi)
+         hi = group->end;
+   }
+   match->text = malloc(hi - lo + 1);
+   assert(match->text);
+   memcpy(match->text, lo, hi - lo);
+   match->text[hi - lo] = '\0';
+   for (int i = 0; i < range_size(match->groups); ++i) {
+      group_t* group = range_group(match->groups, i);
+      if (group->begin) {
+         group->begin = match->text + (group->begin - lo);
+         group->end   = match->text + (group->end - lo);
+      }
+   }
+}
+
 void match_free(match_t* match) {
    if (match) {;
+      free(match->text);
       range_free(match->groups);
+      shre_release(match->pattern);
       free(match);
    }
 }
@@ -274,35 +1383,33 @@ scanner_t* scan_new(pattern_t* pattern, char* input) {
    assert(scanner);
    scanner->pattern = pattern;
    scanner->start = scanner->curr = input;
+   scanner->last = NULL;
    return scanner;
 }
 
 match_t* scan_next(scanner_t* sc) {
-   assert(ptable);
    assert(sc);
-   for (;; ++sc->curr) {
-      char* pos = sc->curr;
-      range_t* groups = core_match(sc->pattern->core, sc->curr,
-                           NULL, NULL, NULL, 0, &sc->curr, sc->start);
-      if (groups) {
-         if (pos == sc->curr)
-            scan_increment(sc);
-         return match_new(groups, sc->pattern->names,
-                          range_group(groups, 0)->begin - sc->start);
-      }
-      if (*sc->curr == '\0')
-         break;
-   }
-   return NULL;
+   range_t* groups = pattern_find(sc->pattern, sc->curr, sc->start,
+                                  &sc->last, NULL, NULL, &sc->curr);
+   if (!groups)
+      return NULL;
+   if (range_group(groups, 0)->begin == sc->curr)
+      scan_increment(sc);
+   return match_new(groups, sc->pattern,
+                    range_group(groups, 0)->begin - sc->start);
 }
 
 match_t* scan_try(scanner_t* sc) {
-   assert(ptable);
    assert(sc);
+   char* end;
+   StatCount(starts);
    range_t* groups = core_match(sc->pattern->core, sc->curr, NULL,
-                                     NULL, NULL, 0, &trash, sc->start);
+                                     NULL, NULL, 0, &end, sc->start);
+#ifdef SHRE_STATS
+   stats_finish(&sc->pattern->stats);
+#endif
    if (groups)
-      return match_new(groups, sc->pattern->names,
+      return match_new(groups, sc->pattern,
                        range_group(groups, 0)->begin - sc->start);
    return NULL;
 }
@@ -324,4 +1431,191 @@ void scan_increment(scanner_t* sc) {
       ++sc->curr;
 }
 
+/**************************stream operations*************************/
+
+/** stream_find
+  *
+  * Search the stream's input from curr for a match that begins
+  * before stop, as pattern_find does, and tell whether the search
+  * read the end of the input.
+  */
+static range_t* stream_find(stream_t* st, char* curr, char* stop,
+                            range_t* groups, char** end, bool* read) {
+   char* last = st->buf + st->len;
+   atom_read_end = false;
+   groups = pattern_find(st->pattern, curr, st->buf, &last, stop,
+                                                   groups, end);
+   *read = atom_read_end;
+   return groups;
+}
+
+/** stream_hold
+  *
+  * Find the first position from curr that more input could change
+  * the result of, given that a search from curr for a match that
+  * begins before hi read the end of the input. Bisect with
+  * pattern_find first; since what it skips reads to the end of the
+  * input sooner than the matcher does, go on from there by trying
+  * the positions one at a time.
+  */
+static char* stream_hold(stream_t* st, char* curr, char* hi) {
+   char* last = st->buf + st->len;
+   range_t* scratch = range_new(st->pattern->ngroups);
+   char* lo = curr;
+   char* end;
+   bool read;
+   while (hi - lo > 1) {
+      char* mid = lo + (hi - lo) / 2;
+      stream_find(st, curr, mid, scratch, &end, &read);
+      if (read)
+         hi = mid;
+      else
+         lo = mid;
+   }
+   for (; lo <= last; ++lo) {
+      atom_read_end = false;
+      range_clear(scratch);
+      core_match(st->pattern->core, lo, NULL, scratch,
+                                 NULL, 0, &end, st->buf);
+      if (atom_read_end)
+         break;
+   }
+   range_free(scratch);
+   return lo;
+}
+
+/** stream_settle
+  *
+  * Search the stream's input from curr, adding the matches to a
+  * list. A search whose result more input can't change is final:
+  * that's any search that didn't read the end of the input, and
+  * every search once the stream is closed. Stop at the first
+  * position whose search isn't final.
+  */
+static void stream_settle(stream_t* st, bool closed, chunk_t* all) {
+   char* last = st->buf + st->len;
+   char* curr = st->buf + st->curr;
+   char* stop = last + 1;
+   bool held = closed;
+   while (curr < stop) {
+      char* end;
+      bool read;
+      range_t* groups = stream_find(st, curr, stop, NULL, &end, &read);
+      if (read && !held) {
+         char* hi = groups ? range_group(groups, 0)->begin + 1 : stop;
+         if (groups)
+            range_free(groups);
+         stop = stream_hold(st, curr, hi);
+         held = true;
+         continue;
+      }
+      if (!groups) {
+         curr = stop;
+         break;
+      }
+      found_t found = { groups, end };
+      if (range_group(groups, 0)->begin == end)
+         ++found.next;
+      add_found(all, found);
+      curr = found.next;
+   }
+   st->curr = curr - st->buf;
+}
+
+/** stream_matches
+  *
+  * Make the list of matches the array that stream_feed and
+  * stream_close return.
+  */
+static match_t** stream_matches(stream_t* st, chunk_t* all, size_t* n) {
+   match_t** matches = found_matches(all, st->pattern, st->buf,
+                                             st->base, n);
+   for (size_t i = 0; i < *n; ++i)
+      match_detach(matches[i]);
+   return matches;
+}
+
+stream_t* stream_open(pattern_t* pattern) {
+   assert(pattern);
+   stream_t* st = malloc(sizeof(stream_t));
+   assert(st);
+   shre_retain(pattern);
+   st->pattern = pattern;
+   st->cap = 64;
+   st->buf = malloc(st->cap);
+   assert(st->buf);
+   st->buf[0] = '\0';
+   st->len = st->base = st->curr = 0;
+   return st;
+}
+
+match_t** stream_feed(stream_t* st, char* data, size_t len, size_t* n) {
+   assert(st && data && n);
+   if (st->len + len >= st->cap) {
+      while (st->len + len >= st->cap)
+         st->cap *= 2;
+      st->buf = realloc(st->buf, st->cap);
+      assert(st->buf);
+   }
+   memcpy(st->buf + st->len, data, len);
+   st->len += len;
+   st->buf[st->len] = '\0';
+
+   chunk_t all = { NULL, NULL, NULL, 0, 0 };
+   stream_settle(st, false, &all);
+   match_t** matches = stream_matches(st, &all, n);
+
+   // keep the byte before curr for the word anchor
+   if (st->curr > 1) {
+      size_t drop = st->curr - 1;
+      memmove(st->buf, st->buf + drop, st->len - drop + 1);
+      st->len -= drop;
+      st->base += drop;
+      st->curr -= drop;
+   }
+   return matches;
+}
+
+match_t** stream_close(stream_t* st, size_t* n) {
+   assert(st && n);
+   chunk_t all = { NULL, NULL, NULL, 0, 0 };
+   stream_settle(st, true, &all);
+   match_t** matches = stream_matches(st, &all, n);
+   shre_release(st->pattern);
+   free(st->buf);
+   free(st);
+   return matches;
+}
+
+/****************************statistics******************************/
+
+bool pattern_stats(pattern_t* pattern, shre_stats_t* stats) {
+   assert(pattern && stats);
+#ifdef SHRE_STATS
+   stats_copy(stats, &pattern->stats);
+   return true;
+#else
+   memset(stats, 0, sizeof(shre_stats_t));
+   return false;
+#endif
+}
+
+void pattern_stats_reset(pattern_t* pattern) {
+   assert(pattern);
+#ifdef SHRE_STATS
+   stats_reset(&pattern->stats);
+#endif
+}
+
+bool last_search_stats(shre_stats_t* stats) {
+   assert(stats);
+#ifdef SHRE_STATS
+   stats_last(stats);
+   return true;
+#else
+   memset(stats, 0, sizeof(shre_stats_t));
+   return false;
+#endif
+}
+
 /********************************************************************/
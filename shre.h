@@ -77,6 +77,15 @@
  *       '\h' --> '[a-fA-F0-9]'
  *       '\H' --> '[^a-fA-F0-9]'
  *
+ *    \p{name}, \P{name}, \pL
+ *    Unicode property classes. '\p{name}' matches any character that
+ *    has the property, and '\P{name}' or '\p{^name}' any character
+ *    that doesn't. The name is a general category, like 'Lu' or
+ *    'Uppercase_Letter', a script, like 'Greek', or 'White_Space'
+ *    or 'Any'; see unicode.h. A one letter name can be written
+ *    without braces. Property classes can be used inside character
+ *    classes. An unknown name is an error.
+ *
  *    *
  *    Match zero or more of the preceding token. If the preceding token
  *    cannot be repeated, an error occurs.
@@ -116,6 +125,17 @@
  *    Negative lookahead assertion; matches the empty string if ...
  *    does not match the next portion of the input string.
  *
+ *    (?i), (?-i)
+ *    Ignore case, or stop ignoring it, for the rest of the enclosing
+ *    group, including later alternatives. Letters then match either
+ *    case, following the simple case folding of Unicode, so 'k' also
+ *    matches the Kelvin sign. Character classes get both cases of
+ *    their letters; shorthand and property classes are unchanged.
+ *    Backreferences still compare exactly.
+ *
+ *    (?i:...), (?-i:...)
+ *    Non-capturing group that ignores case, or doesn't.
+ *
  *    (?>...)
  *    Atomic group. Same as a normal group, but the engine never
  *    backtracks into the group. Doesn't capture matches. If you want
@@ -190,7 +210,14 @@
  *
  *   Use 'scan_new' to get a pointer to a scanner object, which
  *   allows you to use 'scan_next' to get every match in the input
- *   string one-by-one.
+ *   string one-by-one. To find every match in a large buffer, such
+ *   as a whole file, 'shre_search_parallel' splits the work between
+ *   threads. To search many small inputs, 'shre_search_batch'
+ *   splits them between threads and writes where each match is to
+ *   an array.
+ *
+ *   Input that arrives in pieces can be searched with a stream: see
+ *   'stream_open'.
  *
  *   If a match is found, you will get a pointer to a match object.
  *   Use 'match_get' to get a copy of the matching portion of the
@@ -201,17 +228,56 @@
  *
  *   Remember to free string copies that you get from 'match_get',
  *   'match_group', 'match_named_group', and 'shre_replace'.
+ *
+ * Threads:
+ *
+ *   A compiled pattern is never changed after 'shre_compile' returns
+ *   it, so one pattern can be used for searches in many threads at
+ *   once. Match and scanner objects belong to the thread that made
+ *   them. The compile functions, the quick functions and the cache
+ *   functions can be called from any thread, and shre_er is kept
+ *   per thread. Looking up a pattern that is already in the cache
+ *   takes no lock, and when several threads compile the same
+ *   regular expression at once, it's compiled only once.
+ *
+ *   A pattern returned by 'shre_compile' is only valid until the
+ *   cache is cleared or the pattern is evicted (see
+ *   'set_cache_limit'). A thread that might race with 'clear_cache'
+ *   or with eviction should use 'shre_acquire' instead, which returns
+ *   a pattern that stays valid until it's given back with
+ *   'shre_release'. A match keeps its pattern alive until the match
+ *   is freed.
+ *
+ *   Instead of the engine set up by 'start_regex_engine', a program
+ *   can make its own engine contexts with 'engine_new'; each one has
+ *   its own pattern cache.
  */
 
 #ifndef __regex_interface
 #define __regex_interface
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "shre_stats.h"
 
 
 typedef struct _pattern pattern_t;
 typedef struct _match match_t;
 typedef struct _scanner scanner_t;
+typedef struct _stream stream_t;
+typedef struct _engine engine_t;
+
+/* span
+ *
+ * A part of an input, as offsets from its beginning: begin is the
+ * offset of the first character and end is one after the last. A
+ * batch search sets both to -1 if there was no match.
+ */
+typedef struct {
+   long begin;
+   long end;
+} span_t;
 
 //
 // regex engine functions
@@ -240,19 +306,134 @@ bool engine_is_initialized();
   */
 int num_patterns();
 
+/** num_cache_hits
+  *
+  * Get the number of times a pattern was found in the pattern cache
+  * instead of being compiled.
+  */
+long num_cache_hits();
+
+/** num_cache_misses
+  *
+  * Get the number of times a pattern wasn't in the pattern cache and
+  * had to be compiled.
+  */
+long num_cache_misses();
+
+/** num_cache_evictions
+  *
+  * Get the number of patterns that were evicted from the pattern
+  * cache to keep it under its limits.
+  */
+long num_cache_evictions();
+
+/** cache_bytes
+  *
+  * Get the number of bytes of memory used by the patterns in the
+  * pattern cache.
+  */
+size_t cache_bytes();
+
+/** set_cache_limit
+  *
+  * Limit the pattern cache to a number of patterns and a number of
+  * bytes. Zero means no limit, which is the default. When the cache
+  * goes over either limit, the patterns that were used least recently
+  * are evicted, except for ones that are held with 'shre_acquire' or
+  * 'shre_retain' or by a match. A pointer returned by 'shre_compile'
+  * doesn't hold its pattern, so with a limit set it's only valid
+  * until the next compile.
+  */
+void set_cache_limit(int, size_t);
+
 /** clear_cache
   *
   * Clear regex memory cache. This deallocates all patterns held in
-  * the pattern cache. Any pointer to a pattern is now invalid.
+  * the pattern cache, except for ones that are still held with
+  * 'shre_acquire' or 'shre_retain' or by a match, which are freed
+  * when they're released. Any other pointer to a pattern is now
+  * invalid.
   */
 void clear_cache();
 
+/** save_cache
+  *
+  * Write every pattern in the pattern cache to a file, so that a
+  * later run can load them with 'load_cache' instead of compiling
+  * them again. The file can only be loaded by a build of the engine
+  * with the same data layout, on a machine with the same byte order
+  * and pointer size. Returns false and leaves errno set if the file
+  * can't be written.
+  */
+bool save_cache(char*);
+
+/** load_cache
+  *
+  * Read patterns written by 'save_cache' into the pattern cache, with
+  * a single read of the file and no parsing. Patterns that are
+  * already in the cache are kept. Returns the number of patterns in
+  * the file, or -1 if the file can't be read or wasn't written by a
+  * compatible build.
+  */
+int load_cache(char*);
+
+/** share_cache
+  *
+  * Move every pattern in the pattern cache into a read-only shared
+  * mapping, for servers that compile their patterns and then fork
+  * worker processes. The mapping is inherited by every child at the
+  * same address, so all of them match against the same physical
+  * pages instead of each holding its own copy. Patterns compiled
+  * after this, in the parent or in a child, are private as usual.
+  * Patterns acquired before the call stay valid, but keep their own
+  * memory until they're released. Call it before starting any other
+  * threads. Returns the number of patterns shared, or -1 if the
+  * mapping can't be made.
+  */
+int share_cache();
+
 /** cleanup_regex_engine
   *
   * Free all the memory used by the regex engine.
   */
 void cleanup_regex_engine();
 
+//
+// engine contexts
+//
+
+/** engine_new
+  *
+  * Make a new engine context with an empty pattern cache. The
+  * functions below are the same as the ones without the 'engine_'
+  * prefix, except that they use the given engine instead of the one
+  * made by start_regex_engine. Patterns compiled by an engine stay
+  * valid until its cache is cleared or the engine is freed; acquired
+  * ones stay valid until they're released.
+  */
+engine_t* engine_new();
+pattern_t* engine_compile(engine_t*, char*);
+pattern_t* engine_compile_flags(engine_t*, char*, int);
+pattern_t* engine_acquire(engine_t*, char*);
+bool engine_quick_search(engine_t*, char*, char*);
+bool engine_quick_entire(engine_t*, char*, char*);
+int engine_num_patterns(engine_t*);
+long engine_num_cache_hits(engine_t*);
+long engine_num_cache_misses(engine_t*);
+long engine_num_cache_evictions(engine_t*);
+size_t engine_cache_bytes(engine_t*);
+void engine_set_cache_limit(engine_t*, int, size_t);
+void engine_clear_cache(engine_t*);
+bool engine_save(engine_t*, char*);
+int engine_load(engine_t*, char*);
+int engine_share(engine_t*);
+
+/** engine_free
+  *
+  * Free an engine context and every pattern in its cache.
+  */
+void engine_free(engine_t*);
+
 //
 // regex operations
 //
@@ -267,6 +448,43 @@ void cleanup_regex_engine();
   */
 pattern_t* shre_compile(char*);
 
+/* compile flags
+ *
+ * Flags for 'shre_compile_flags', which can be or'd together.
+ */
+#define SHRE_CASELESS 1  // ignore case, as if the regex began with '(?i)'
+
+/** compile_flags
+  *
+  * Same as 'shre_compile', with flags that change how the regular
+  * expression is read. The flags become part of the pattern's
+  * expression, so 'shre_compile_flags("abc", SHRE_CASELESS)' gives
+  * the same pattern as 'shre_compile("(?i)abc")'.
+  */
+pattern_t* shre_compile_flags(char*, int);
+
+/** acquire
+  *
+  * Same as 'shre_compile', but the caller gets its own reference to
+  * the pattern, which stays valid even if the cache is cleared. Give
+  * the reference back with 'shre_release'.
+  */
+pattern_t* shre_acquire(char*);
+
+/** retain
+  *
+  * Take another reference to a pattern.
+  */
+void shre_retain(pattern_t*);
+
+/** release
+  *
+  * Drop a reference taken with 'shre_acquire' or 'shre_retain'. The
+  * pattern is freed when it's no longer in the cache and nothing
+  * else holds it.
+  */
+void shre_release(pattern_t*);
+
 /** expression
   *
   * Returns the original regular expression that was used to compile
@@ -290,6 +508,61 @@ match_t* shre_search(pattern_t*, char*);
   */
 match_t* shre_entire(pattern_t*, char*);
 
+/** search_parallel
+  *
+  * Find every match in a buffer of the given length, which holds no
+  * null characters and is followed by a null terminating character.
+  * These are the same matches, in the same order, that a scanner
+  * would find by calling 'scan_next' until it returns NULL, except
+  * that an empty match at the end of the buffer is only found once.
+  * The buffer is split into chunks that are searched at once, on a
+  * pool with one thread for every processor. Returns an array of the
+  * matches followed by NULL, and sets the last argument to the
+  * number of matches. Free each match with 'match_free' and the
+  * array with 'free'.
+  */
+match_t** shre_search_parallel(pattern_t*, char*, size_t, size_t*);
+
+/** search_batch
+  *
+  * Search each of an array of the given number of input strings for
+  * the pattern, as 'shre_search' would, and write where the match in
+  * the i'th input is to the i'th span of the last argument. The
+  * inputs are split between the threads of the same pool that
+  * 'shre_search_parallel' uses, and each thread reuses the same
+  * memory for its searches, so this is much faster than calling
+  * 'shre_search' for every input. Returns the number of inputs that
+  * matched.
+  */
+size_t shre_search_batch(pattern_t*, char**, size_t, span_t*);
+
+/** search_batch_set
+  *
+  * Same as shre_search_batch, but searches every input for each of an
+  * array of patterns. The first size is the number of patterns and
+  * the second is the number of inputs; the match of the j'th pattern
+  * in the i'th input is written to span i * npatterns + j. Returns
+  * the number of spans that hold a match.
+  */
+size_t shre_search_batch_set(pattern_t**, size_t, char**, size_t,
+                                                        span_t*);
+
+/** search_lines
+  *
+  * Find the lines of a buffer of the given length that the pattern
+  * matches, like grep. The buffer needn't be null terminated, so it
+  * can be a file mapped with mmap. Each line is searched as if it
+  * were an input of its own, without its newline. Sets the last
+  * argument to an array of the lines that match, in order, and
+  * returns the number of them; free the array with 'free'.
+  *
+  * When the pattern has a literal that every match must contain, the
+  * whole buffer is searched for the literal first, and only the
+  * lines it occurs in are searched for the pattern. The buffer
+  * should hold no null characters.
+  */
+size_t shre_search_lines(pattern_t*, char*, size_t, span_t**);
+
 /** quick_search/ quick_match
   *
   * Same as shre_search and shre_match, except that these versions take
@@ -344,7 +617,13 @@ int match_num_groups(match_t*);
   * Gives the offset from the beginning of the input string to the
   * beginning of the match.
   */
-uint32_t match_offset(match_t*);
+size_t match_offset(match_t*);
+
+/** length
+  *
+  * Gives the length of the match in bytes, without copying it.
+  */
+size_t match_length(match_t*);
 
 /** group
   *
@@ -415,4 +694,76 @@ uint32_t scan_tell(scanner_t*);
   */
 void scan_increment(scanner_t*);
 
+//
+// stream
+//
+
+/** stream_open
+  *
+  * Make a stream, which searches input that arrives in pieces, like
+  * reads from a file or a socket, for the pattern. A match may span
+  * any number of pieces. The stream keeps only the input it still
+  * needs: the part a match could begin in, and the byte before it.
+  * The search from a position is settled as soon as it ends without
+  * reading up to the end of the input so far, so what's kept is
+  * mostly a match that could still grow, like digits at the end of
+  * the input for '\d+'. Only a search that runs to the end of the
+  * input from early on, such as '.*' over input with no newlines,
+  * keeps input back until more arrives or the stream is closed.
+  */
+stream_t* stream_open(pattern_t*);
+
+/** stream_feed
+  *
+  * Give the stream the next piece of its input, which is the given
+  * number of bytes long and holds no null characters. Return the
+  * matches that more input can't change, as an array followed by
+  * NULL, and set the last argument to the number of matches. These
+  * are the matches that a scanner searching the whole input would
+  * find, in the same order; a match's offset is from the beginning
+  * of the stream, and the match holds a copy of the input it points
+  * into. Free each match with 'match_free' and the array with 'free'.
+  */
+match_t** stream_feed(stream_t*, char*, size_t, size_t*);
+
+/** stream_close
+  *
+  * Tell the stream its input has ended, and deallocate it. Return
+  * the rest of its matches, in the same way as stream_feed.
+  */
+match_t** stream_close(stream_t*, size_t*);
+
+//
+// statistics
+//
+
+/** pattern_stats
+  *
+  * Copy the counts of the work done in every search for the pattern
+  * since it was compiled or its counts were reset, by any thread.
+  * The counts are only kept if the engine was compiled with
+  * SHRE_STATS defined, and cost nothing otherwise; without it, the
+  * counts are all zero and false is returned.
+  *
+  * A search here is one attempt to find the next match: each call of
+  * 'shre_search' or 'scan_next' is one, and the functions that find
+  * many matches make one for each match they find, and one more
+  * that fails.
+  */
+bool pattern_stats(pattern_t*, shre_stats_t*);
+
+/** pattern_stats_reset
+  *
+  * Set the pattern's counts to zero.
+  */
+void pattern_stats_reset(pattern_t*);
+
+/** last_search_stats
+  *
+  * Copy the counts of the last search that the calling thread made,
+  * for any pattern. Returns false, and gives zeros, if the engine was
+  * compiled without SHRE_STATS.
+  */
+bool last_search_stats(shre_stats_t*);
+
 #endif
@@ -5,7 +5,7 @@
 
 #include "shre_errno.h"
 
-shre_erflag shre_er = NERROR;
+__thread shre_erflag shre_er = NERROR;
 
 char* shre_strerror(shre_erflag flag) {
    switch (flag) {
@@ -22,6 +22,7 @@ case NAMEXT: return "group name already exists";
 case GRPDIG: return "group name must not begin with digit";
 case NOTREP: return "nothing to repeat";
 case BADREF: return "reference or subroutine call to invalid group"   ;
+case BADPRO: return "unknown unicode property";
 case NERROR: return "no error";
    }
    return "";
@@ -29,15 +29,18 @@ typedef enum {
    GRPDIG,  // group name must not begin with digit
    NOTREP,  // nothing to repeat
    BADREF,  // reference or subroutine call to invalid group
+   BADPRO,  // unknown unicode property
    NERROR   // no error; default value
 } shre_erflag;
 
 /* shre_errno
  *
  * If a regular expression fails to compile, NULL is returned and
- * this flag is class.
+ * this flag is class. Every thread has its own copy of the flag, so
+ * a failed compile in one thread doesn't change what another thread
+ * sees.
  */
-extern shre_erflag shre_er;
+extern __thread shre_erflag shre_er;
 
 /** shre_strerror
   *
@@ -0,0 +1,35 @@
+/* shre_stats.h
+ *
+ * Defines the counts that the engine keeps of the work it does when
+ * it's compiled with SHRE_STATS. It's included by shre.h.
+ */
+
+#ifndef __regex_shre_stats
+#define __regex_shre_stats
+
+#include <stdint.h>
+
+/* stats
+ *
+ * Counts of the work done by the matcher in searching for a pattern;
+ * see 'pattern_stats'. The atoms array counts the times an atom of
+ * each type began matching, in this order: classes, strings, groups,
+ * atomic groups, backreferences, subroutine calls, lookaheads, word
+ * anchors, and edge anchors.
+ */
+#define SHRE_ATOM_TYPES 9
+
+typedef struct {
+   uint64_t atoms[SHRE_ATOM_TYPES];
+   uint64_t pushes;     // states pushed on backtracking stacks
+   uint64_t pops;       // states popped off them
+   uint64_t max_depth;  // most states on one stack at once
+   uint64_t groups;     // times a group was entered
+   uint64_t lookaheads; // lookaheads tried
+   uint64_t starts;     // positions the whole pattern was tried at
+   uint64_t skips;      // positions passed over without being tried,
+                        //   because a literal search ruled them out
+   uint64_t searches;   // searches made
+} shre_stats_t;
+
+#endif
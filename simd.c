@@ -0,0 +1,80 @@
+/* simd.c
+ *
+ * Implementation of instruction set detection.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "simd.h"
+
+static const char* names[] = {
+   "scalar", "sse2", "sse4.2", "avx2", "avx512"
+};
+
+// Written once by the first call to simd_init, and only read after
+//   that.
+static simd_level level = SIMD_SCALAR;
+static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+/***************************static functions*************************/
+
+/** detect
+  *
+  * Ask the processor which instruction sets it has. The compiler's
+  * builtin also checks that the operating system saves the wider
+  * registers.
+  */
+static simd_level detect() {
+#ifdef SIMD_X86
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx512f")
+                             && __builtin_cpu_supports("avx512bw"))
+      return SIMD_AVX512;
+   if (__builtin_cpu_supports("avx2"))
+      return SIMD_AVX2;
+   if (__builtin_cpu_supports("sse4.2")
+                             && __builtin_cpu_supports("ssse3"))
+      return SIMD_SSE42;
+   if (__builtin_cpu_supports("sse2"))
+      return SIMD_SSE2;
+#endif
+   return SIMD_SCALAR;
+}
+
+/** select_level
+  *
+  * Set the level from the processor and the environment.
+  */
+static void select_level() {
+   level = detect();
+   char* forced = getenv("SHRE_SIMD");
+   if (!forced)
+      return;
+   for (simd_level l = SIMD_SCALAR; l <= SIMD_AVX512; ++l) {
+      if (strcmp(forced, names[l]) == 0) {
+         if (l < level)
+            level = l;
+         return;
+      }
+   }
+}
+
+/***************************public functions*************************/
+
+void simd_init() {
+   pthread_once(&once, &select_level);
+}
+
+simd_level simd_get_level() {
+   return level;
+}
+
+const char* simd_name(simd_level l) {
+   assert(l >= SIMD_SCALAR && l <= SIMD_AVX512);
+   return names[l];
+}
+
+/********************************************************************/
@@ -0,0 +1,59 @@
+/* simd.h
+ *
+ * Runtime selection of the vector instruction set used by the search
+ * kernels. The level is detected once, when the engine is started,
+ * so that one binary can use the widest vectors of whatever machine
+ * it runs on. Every kernel has a scalar version that gives the same
+ * results, which is what non-x86 machines always use.
+ *
+ * Setting the environment variable SHRE_SIMD to one of 'scalar',
+ * 'sse2', 'sse4.2', 'avx2' or 'avx512' before the engine is started
+ * forces a lower level, for benchmarking and for checking kernels
+ * against each other. A level the machine doesn't support is
+ * lowered to the best one it does.
+ */
+
+#ifndef __regex_simd
+#define __regex_simd
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SIMD_X86
+#endif
+
+/* simd_level
+ *
+ * Instruction set levels, in increasing order. Each level includes
+ * everything below it; SIMD_SSE42 also means that SSSE3 is available,
+ * and SIMD_AVX512 means AVX-512BW.
+ */
+typedef enum {
+   SIMD_SCALAR,
+   SIMD_SSE2,
+   SIMD_SSE42,
+   SIMD_AVX2,
+   SIMD_AVX512
+} simd_level;
+
+/** init
+  *
+  * Detect the best level the machine supports and apply the
+  * environment override. Only the first call does anything, so it's
+  * safe to call from every engine and from several threads. Kernels
+  * that are chosen before this is called use the scalar versions.
+  */
+void simd_init();
+
+/** get_level
+  *
+  * Get the selected level. Kernels are picked according to this level
+  * when the object that uses them is built.
+  */
+simd_level simd_get_level();
+
+/** name
+  *
+  * Get the name of a level, in the form accepted by SHRE_SIMD.
+  */
+const char* simd_name(simd_level);
+
+#endif
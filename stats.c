@@ -0,0 +1,79 @@
+/* stats.c
+ *
+ * Implementation of the matcher's counters. A pattern's totals can be
+ * added to by threads searching it at once, so they're only changed
+ * with atomic operations.
+ */
+
+#include <string.h>
+#include <stdint.h>
+
+#include "stats.h"
+
+#ifdef SHRE_STATS
+
+__thread shre_stats_t stats_now;
+
+// the counts of the last search the thread ran
+static __thread shre_stats_t last;
+
+/************************static functions****************************/
+
+/** add
+  *
+  * Add a count to a total.
+  */
+static inline void add(uint64_t* total, uint64_t n) {
+   if (n)
+      __atomic_fetch_add(total, n, __ATOMIC_RELAXED);
+}
+
+/** raise_max
+  *
+  * Raise a maximum to a value if the value is larger.
+  */
+static inline void raise_max(uint64_t* max, uint64_t n) {
+   uint64_t old = __atomic_load_n(max, __ATOMIC_RELAXED);
+   while (n > old && !__atomic_compare_exchange_n(max, &old, n, true,
+                                  __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+      ;
+}
+
+/************************public functions****************************/
+
+void stats_finish(shre_stats_t* total) {
+   ++stats_now.searches;
+   for (int i = 0; i < SHRE_ATOM_TYPES; ++i)
+      add(&total->atoms[i], stats_now.atoms[i]);
+   add(&total->pushes, stats_now.pushes);
+   add(&total->pops, stats_now.pops);
+   raise_max(&total->max_depth, stats_now.max_depth);
+   add(&total->groups, stats_now.groups);
+   add(&total->lookaheads, stats_now.lookaheads);
+   add(&total->starts, stats_now.starts);
+   add(&total->skips, stats_now.skips);
+   add(&total->searches, stats_now.searches);
+   last = stats_now;
+   memset(&stats_now, 0, sizeof(shre_stats_t));
+}
+
+void stats_copy(shre_stats_t* to, shre_stats_t* total) {
+   uint64_t* from = (uint64_t*) total;
+   uint64_t* into = (uint64_t*) to;
+   for (size_t i = 0; i < sizeof(shre_stats_t) / sizeof(uint64_t); ++i)
+      into[i] = __atomic_load_n(&from[i], __ATOMIC_RELAXED);
+}
+
+void stats_reset(shre_stats_t* total) {
+   uint64_t* counts = (uint64_t*) total;
+   for (size_t i = 0; i < sizeof(shre_stats_t) / sizeof(uint64_t); ++i)
+      __atomic_store_n(&counts[i], 0, __ATOMIC_RELAXED);
+}
+
+void stats_last(shre_stats_t* to) {
+   *to = last;
+}
+
+#endif /* ifdef SHRE_STATS */
+
+/********************************************************************/
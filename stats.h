@@ -0,0 +1,72 @@
+/* stats.h
+ *
+ * Counters of the work the matcher does, for finding out why a
+ * pattern is slow. They're only compiled in when SHRE_STATS is
+ * defined; otherwise the macros below compile to nothing, and the
+ * matcher is the same as if they weren't there.
+ *
+ * While a search runs, its counts are kept in the searching thread's
+ * own copy of the counters, so counting needs no locking. When the
+ * search ends, they're added to the pattern's totals with
+ * stats_finish.
+ */
+
+#ifndef __regex_stats
+#define __regex_stats
+
+#include <stdbool.h>
+#include "shre_stats.h"
+
+#ifdef SHRE_STATS
+
+// the counts of the search the thread is running
+extern __thread shre_stats_t stats_now;
+
+// Count one more of something, or n more.
+#define StatCount(FIELD) (++stats_now.FIELD)
+#define StatAdd(FIELD, N) (stats_now.FIELD += (N))
+
+// Note the depth a stack has reached.
+#define StatDepth(DEPTH) \
+   do { \
+      if ((uint64_t) (DEPTH) > stats_now.max_depth) \
+         stats_now.max_depth = (DEPTH); \
+   } while (0)
+
+/** finish
+  *
+  * End the search the thread is running: add its counts to a
+  * pattern's totals, keep them as the thread's last search, and
+  * start counting from zero.
+  */
+void stats_finish(shre_stats_t*);
+
+/** copy
+  *
+  * Copy a pattern's totals, which other threads may be adding to.
+  */
+void stats_copy(shre_stats_t*, shre_stats_t*);
+
+/** reset
+  *
+  * Set a pattern's totals to zero.
+  */
+void stats_reset(shre_stats_t*);
+
+/** last
+  *
+  * Copy the counts of the last search the thread ran.
+  */
+void stats_last(shre_stats_t*);
+
+#else
+
+// The arguments are named so that variables kept only for the counts
+//   aren't unused, but they're never evaluated.
+#define StatCount(FIELD) ((void) 0)
+#define StatAdd(FIELD, N) ((void) sizeof(N))
+#define StatDepth(DEPTH) ((void) sizeof(DEPTH))
+
+#endif /* ifdef SHRE_STATS */
+
+#endif
@@ -0,0 +1,294 @@
+/* strsearch.c
+ *
+ * Implementation of literal substring search. Short literals are
+ * found with a vectorized filter that compares the first and the
+ * last byte of the literal against a whole vector of positions at a
+ * time, and only calls memcmp where both bytes agree. Long literals,
+ * the tail of the input that's too short for a vector, and machines
+ * without vectors use the Boyer-Moore-Horspool algorithm, which can
+ * skip up to the length of the literal at every step.
+ *
+ * The filter comes in SSE2, AVX2 and AVX-512 versions; which one is
+ * used is decided by simd_get_level when the object is built.
+ *
+ * A caseless literal is kept with small letters. The filter sets the
+ * 0x20 bit of the input bytes it compares against a letter, which
+ * makes a capital letter small and leaves only the two cases of the
+ * letter equal to it; the candidates are then compared with
+ * fold_equal instead of memcmp.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "simd.h"
+
+#ifdef SIMD_X86
+#include <immintrin.h>
+#endif
+
+#include "strsearch.h"
+#include "util.h"
+
+/* Literals at least this long are searched with Horspool alone; the
+ * skips are long enough that the vector filter doesn't pay off.
+ */
+#define LONG_LITERAL 32
+
+/* strsearch
+ *
+ * Declaration of the search object. skip[b] is how far the search
+ * window can be moved when byte b is under the last position of
+ * the window. find is the kernel picked for this literal.
+ */
+struct _strsearch {
+   char* literal;
+   int len;
+   bool caseless;
+   unsigned char first_bit;   // 0x20 if the first byte is a caseless
+                              //   letter, so that it's set in the input
+   unsigned char last_bit;    // the same for the last byte
+   int skip[256];
+   char* (*find)(strsearch_t*, char*, char*);
+};
+
+/***************************static functions*************************/
+
+/** single
+  *
+  * Search for a literal of one byte.
+  */
+static char* single(strsearch_t* obj, char* str, char* end) {
+   return memchr(str, obj->literal[0], end - str);
+}
+
+/** horspool
+  *
+  * Boyer-Moore-Horspool search. This is also the scalar version of
+  * the filters below.
+  */
+static char* horspool(strsearch_t* obj, char* str, char* end) {
+   int m = obj->len;
+   unsigned char last = obj->literal[m-1];
+   while (end - str >= m) {
+      unsigned char u = str[m-1];
+      if (u == last && memcmp(str, obj->literal, m - 1) == 0)
+         return str;
+      str += obj->skip[u];
+   }
+   return NULL;
+}
+
+/** horspool_caseless
+  *
+  * Horspool search ignoring case. The skip table has entries for
+  * both cases of every letter.
+  */
+static char* horspool_caseless(strsearch_t* obj, char* str, char* end) {
+   int m = obj->len;
+   unsigned char last = obj->literal[m-1];
+   while (end - str >= m) {
+      unsigned char u = str[m-1];
+      if (ascii_lower[u] == last && fold_equal(str, obj->literal, m - 1))
+         return str;
+      str += obj->skip[u];
+   }
+   return NULL;
+}
+
+#ifdef SIMD_X86
+
+/** verify
+  *
+  * Check the candidates in a mask of positions that passed the
+  * filter, lowest position first.
+  */
+static inline char* verify(strsearch_t* obj, char* str,
+                                         unsigned long long mask) {
+   int n = obj->len > 2 ? obj->len - 2 : 0;
+   while (mask) {
+      int bit = __builtin_ctzll(mask);
+      if (obj->caseless ? fold_equal(str + bit + 1, obj->literal + 1, n)
+                : memcmp(str + bit + 1, obj->literal + 1, n) == 0)
+         return str + bit;
+      mask &= mask - 1;
+   }
+   return NULL;
+}
+
+/** rest
+  *
+  * Search the tail of the input that's too short for the filter.
+  */
+static inline char* rest(strsearch_t* obj, char* str, char* end) {
+   return obj->caseless ? horspool_caseless(obj, str, end)
+                        : horspool(obj, str, end);
+}
+
+/** pair_filter16
+  *
+  * Compare the first and last byte of the literal against sixteen
+  * positions at once, and verify the candidates that pass.
+  */
+__attribute__((target("sse2")))
+static char* pair_filter16(strsearch_t* obj, char* str, char* end) {
+   int m = obj->len;
+   __m128i first = _mm_set1_epi8(obj->literal[0]);
+   __m128i last  = _mm_set1_epi8(obj->literal[m-1]);
+   __m128i first_bit = _mm_set1_epi8(obj->first_bit);
+   __m128i last_bit  = _mm_set1_epi8(obj->last_bit);
+   for (; end - str >= m + 15; str += 16) {
+      __m128i head = _mm_or_si128(first_bit,
+                                  _mm_loadu_si128((__m128i*) str));
+      __m128i tail = _mm_or_si128(last_bit,
+                        _mm_loadu_si128((__m128i*) (str + m - 1)));
+      unsigned mask = _mm_movemask_epi8(
+                         _mm_and_si128(_mm_cmpeq_epi8(head, first),
+                                       _mm_cmpeq_epi8(tail, last)));
+      char* found = verify(obj, str, mask);
+      if (found)
+         return found;
+   }
+   return rest(obj, str, end);
+}
+
+/** pair_filter32
+  *
+  * Thirty-two positions at once.
+  */
+__attribute__((target("avx2")))
+static char* pair_filter32(strsearch_t* obj, char* str, char* end) {
+   int m = obj->len;
+   __m256i first = _mm256_set1_epi8(obj->literal[0]);
+   __m256i last  = _mm256_set1_epi8(obj->literal[m-1]);
+   __m256i first_bit = _mm256_set1_epi8(obj->first_bit);
+   __m256i last_bit  = _mm256_set1_epi8(obj->last_bit);
+   for (; end - str >= m + 31; str += 32) {
+      __m256i head = _mm256_or_si256(first_bit,
+                                     _mm256_loadu_si256((__m256i*) str));
+      __m256i tail = _mm256_or_si256(last_bit,
+                        _mm256_loadu_si256((__m256i*) (str + m - 1)));
+      unsigned mask = _mm256_movemask_epi8(
+                         _mm256_and_si256(_mm256_cmpeq_epi8(head, first),
+                                          _mm256_cmpeq_epi8(tail, last)));
+      char* found = verify(obj, str, mask);
+      if (found)
+         return found;
+   }
+   return rest(obj, str, end);
+}
+
+/** pair_filter64
+  *
+  * Sixty-four positions at once.
+  */
+__attribute__((target("avx512f,avx512bw")))
+static char* pair_filter64(strsearch_t* obj, char* str, char* end) {
+   int m = obj->len;
+   __m512i first = _mm512_set1_epi8(obj->literal[0]);
+   __m512i last  = _mm512_set1_epi8(obj->literal[m-1]);
+   __m512i first_bit = _mm512_set1_epi8(obj->first_bit);
+   __m512i last_bit  = _mm512_set1_epi8(obj->last_bit);
+   for (; end - str >= m + 63; str += 64) {
+      __m512i head = _mm512_or_si512(first_bit,
+                                     _mm512_loadu_si512((void*) str));
+      __m512i tail = _mm512_or_si512(last_bit,
+                        _mm512_loadu_si512((void*) (str + m - 1)));
+      __mmask64 mask = _mm512_cmpeq_epi8_mask(head, first)
+                     & _mm512_cmpeq_epi8_mask(tail, last);
+      char* found = verify(obj, str, mask);
+      if (found)
+         return found;
+   }
+   return rest(obj, str, end);
+}
+
+#endif /* ifdef SIMD_X86 */
+
+/** pick_kernel
+  *
+  * Choose the search function for the literal.
+  */
+static void pick_kernel(strsearch_t* obj) {
+   obj->find = obj->caseless ? &horspool_caseless : &horspool;
+   if (obj->len == 1 && !obj->first_bit) {
+      obj->find = &single;
+      return;
+   }
+   if (obj->len >= LONG_LITERAL)
+      return;
+#ifdef SIMD_X86
+   switch (simd_get_level()) {
+      case SIMD_AVX512: obj->find = &pair_filter64; break;
+      case SIMD_AVX2:   obj->find = &pair_filter32; break;
+      case SIMD_SSE42:
+      case SIMD_SSE2:   obj->find = &pair_filter16; break;
+      default: break;
+   }
+#endif
+}
+
+/***************************public functions*************************/
+
+char* strsearch_find(strsearch_t* obj, char* str, char* end) {
+   assert(obj && str && end);
+   return obj->find(obj, str, end);
+}
+
+bool strsearch_equal(strsearch_t* obj, char* str) {
+   assert(obj && str);
+   if (!obj->caseless)
+      return strcmp(str, obj->literal) == 0;
+   return fold_equal(str, obj->literal, obj->len) && str[obj->len] == '\0';
+}
+
+int strsearch_length(strsearch_t* obj) {
+   assert(obj);
+   return obj->len;
+}
+
+char* strsearch_literal(strsearch_t* obj) {
+   assert(obj);
+   return obj->literal;
+}
+
+size_t strsearch_bytes(strsearch_t* obj) {
+   assert(obj);
+   return sizeof(strsearch_t) + obj->len + 1;
+}
+
+strsearch_t* strsearch_new(char* literal, bool caseless) {
+   assert(literal && *literal);
+   strsearch_t* obj = malloc(sizeof(strsearch_t));
+   assert(obj);
+   obj->literal = strdup(literal);
+   assert(obj->literal);
+   obj->len = strlen(literal);
+   obj->caseless = caseless;
+   obj->first_bit = obj->last_bit = 0;
+   if (caseless) {
+      unsigned char first = literal[0], last = literal[obj->len - 1];
+      obj->first_bit = first >= 'a' && first <= 'z' ? 0x20 : 0;
+      obj->last_bit  = last  >= 'a' && last  <= 'z' ? 0x20 : 0;
+   }
+   for (int i = 0; i < 256; ++i)
+      obj->skip[i] = obj->len;
+   for (int i = 0; i < obj->len - 1; ++i) {
+      unsigned char u = literal[i];
+      obj->skip[u] = obj->len - 1 - i;
+      if (caseless && u >= 'a' && u <= 'z')
+         obj->skip[u - 0x20] = obj->len - 1 - i;
+   }
+   pick_kernel(obj);
+   return obj;
+}
+
+void strsearch_free(strsearch_t* obj) {
+   if (obj) {
+      free(obj->literal);
+      free(obj);
+   }
+}
+
+/********************************************************************/
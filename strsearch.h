@@ -0,0 +1,67 @@
+/* strsearch.h
+ *
+ * Substring search for a fixed literal. Used when a whole regular
+ * expression is a single literal, like 'hello' or '\Qa.b\E', so
+ * that searching doesn't have to go through the core at all. A
+ * literal can also be searched for without regard to the case of
+ * ascii letters.
+ */
+
+#ifndef __regex_strsearch
+#define __regex_strsearch
+
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef struct _strsearch strsearch_t;
+
+/** find
+  *
+  * Find the first occurrence of the literal in the input between the
+  * two pointers, where the second pointer points one after the last
+  * byte that may be read. Returns a pointer to the beginning of the
+  * occurrence, or NULL if there is none.
+  */
+char* strsearch_find(strsearch_t*, char*, char*);
+
+/** equal
+  *
+  * Check if a null terminated string is the literal, ignoring case
+  * if the object does.
+  */
+bool strsearch_equal(strsearch_t*, char*);
+
+/** length
+  *
+  * Get the length in bytes of the literal.
+  */
+int strsearch_length(strsearch_t*);
+
+/** literal
+  *
+  * Get the literal being searched for.
+  */
+char* strsearch_literal(strsearch_t*);
+
+/** bytes
+  *
+  * Get the number of bytes of memory used by the object.
+  */
+size_t strsearch_bytes(strsearch_t*);
+
+/** new
+  *
+  * Preprocess a non-empty literal for searching. The object keeps its
+  * own copy of the literal. If the bool is true, the case of ascii
+  * letters is ignored, and the letters of the literal must be small
+  * letters.
+  */
+strsearch_t* strsearch_new(char*, bool caseless);
+
+/** free
+  *
+  * Deallocate the object.
+  */
+void strsearch_free(strsearch_t*);
+
+#endif
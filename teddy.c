@@ -0,0 +1,308 @@
+/* teddy.c
+ *
+ * Implementation of the packed literal search. Every literal gets a
+ * bucket, which is a bit in a byte. For each of the first few bytes
+ * of the literals, two sixteen entry tables map a low nibble and a
+ * high nibble to the buckets of the literals that have that nibble at
+ * that offset. A byte shuffle looks up a whole vector of input
+ * nibbles in a table at once; and-ing the lookups for both nibbles at
+ * every offset leaves, at each input position, the buckets of the
+ * literals whose first bytes might begin there. Those literals are
+ * then compared in bucket order, which is the order they were given
+ * in, so the first one that matches is the leftmost-first one. A
+ * caseless literal puts both cases of its letters in the tables.
+ *
+ * There are SSSE3, AVX2 and AVX-512 versions of the shuffle loop,
+ * picked by simd_get_level when the object is built. The scalar
+ * version uses exact per-byte tables instead of nibble tables.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "simd.h"
+
+#ifdef SIMD_X86
+#include <immintrin.h>
+#endif
+
+#include "teddy.h"
+#include "util.h"
+
+/* Number of leading bytes of each literal that go into the tables.
+ * More bytes mean fewer false candidates, but a literal can't be
+ * shorter than the fingerprint, so it's cut to the shortest literal.
+ */
+#define FINGERPRINT 3
+
+/* teddy
+ *
+ * Declaration of the search object.
+ */
+struct _teddy {
+   char* literals[TEDDY_MAX];
+   int len[TEDDY_MAX];
+   bool caseless[TEDDY_MAX];
+   int nlit;
+   int minlen;             // length of the shortest literal
+   int nfp;                // number of bytes in the fingerprint
+   unsigned char masks[FINGERPRINT][256];  // byte to buckets
+   unsigned char lo[FINGERPRINT][16];      // low nibble to buckets
+   unsigned char hi[FINGERPRINT][16];      // high nibble to buckets
+   char* (*find)(teddy_t*, char*, char*, int*);
+};
+
+/***************************static functions*************************/
+
+/** verify
+  *
+  * Compare the literals in the given buckets against the input at
+  * pos, in bucket order. Return true and set *which to the first one
+  * that occurs there.
+  */
+static inline bool verify(teddy_t* obj, char* pos, char* end,
+                                   unsigned buckets, int* which) {
+   while (buckets) {
+      int i = __builtin_ctz(buckets);
+      if (end - pos >= obj->len[i]
+              && (obj->caseless[i]
+                  ? fold_equal(pos, obj->literals[i], obj->len[i])
+                  : memcmp(pos, obj->literals[i], obj->len[i]) == 0)) {
+         *which = i;
+         return true;
+      }
+      buckets &= buckets - 1;
+   }
+   return false;
+}
+
+/** scalar
+  *
+  * Check one position at a time with the per-byte tables. This is
+  * also the reference version of the shuffle loops below.
+  */
+static char* scalar(teddy_t* obj, char* str, char* end, int* which) {
+   for (; end - str >= obj->minlen; ++str) {
+      unsigned buckets = obj->masks[0][(unsigned char) str[0]];
+      for (int k = 1; buckets && k < obj->nfp; ++k)
+         buckets &= obj->masks[k][(unsigned char) str[k]];
+      if (buckets && verify(obj, str, end, buckets, which))
+         return str;
+   }
+   return NULL;
+}
+
+#ifdef SIMD_X86
+
+/** check
+  *
+  * Verify the candidate positions in a mask, lowest position first.
+  * buckets holds the bucket mask of every position in the block.
+  */
+static inline char* check(teddy_t* obj, char* str, char* end,
+             unsigned long long bits, unsigned char* buckets, int* which) {
+   while (bits) {
+      int b = __builtin_ctzll(bits);
+      if (verify(obj, str + b, end, buckets[b], which))
+         return str + b;
+      bits &= bits - 1;
+   }
+   return NULL;
+}
+
+/** packed16
+  *
+  * Check sixteen positions at a time.
+  */
+__attribute__((target("ssse3")))
+static char* packed16(teddy_t* obj, char* str, char* end, int* which) {
+   __m128i nibble = _mm_set1_epi8(0x0f);
+   __m128i lo[FINGERPRINT], hi[FINGERPRINT];
+   for (int k = 0; k < obj->nfp; ++k) {
+      lo[k] = _mm_loadu_si128((__m128i*) obj->lo[k]);
+      hi[k] = _mm_loadu_si128((__m128i*) obj->hi[k]);
+   }
+   for (; end - str >= 16 + obj->nfp - 1; str += 16) {
+      __m128i m = _mm_set1_epi8(-1);
+      for (int k = 0; k < obj->nfp; ++k) {
+         __m128i v = _mm_loadu_si128((__m128i*) (str + k));
+         __m128i l = _mm_shuffle_epi8(lo[k], _mm_and_si128(v, nibble));
+         __m128i h = _mm_shuffle_epi8(hi[k],
+                           _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+         m = _mm_and_si128(m, _mm_and_si128(l, h));
+      }
+      unsigned bits = 0xffff & ~(unsigned) _mm_movemask_epi8(
+                                _mm_cmpeq_epi8(m, _mm_setzero_si128()));
+      if (!bits)
+         continue;
+      unsigned char buckets[16];
+      _mm_storeu_si128((__m128i*) buckets, m);
+      char* found = check(obj, str, end, bits, buckets, which);
+      if (found)
+         return found;
+   }
+   return scalar(obj, str, end, which);
+}
+
+/** packed32
+  *
+  * Check thirty-two positions at a time. The shuffle works within
+  * each sixteen byte lane, so the tables are copied into both lanes.
+  */
+__attribute__((target("avx2")))
+static char* packed32(teddy_t* obj, char* str, char* end, int* which) {
+   __m256i nibble = _mm256_set1_epi8(0x0f);
+   __m256i lo[FINGERPRINT], hi[FINGERPRINT];
+   for (int k = 0; k < obj->nfp; ++k) {
+      lo[k] = _mm256_broadcastsi128_si256(
+                 _mm_loadu_si128((__m128i*) obj->lo[k]));
+      hi[k] = _mm256_broadcastsi128_si256(
+                 _mm_loadu_si128((__m128i*) obj->hi[k]));
+   }
+   for (; end - str >= 32 + obj->nfp - 1; str += 32) {
+      __m256i m = _mm256_set1_epi8(-1);
+      for (int k = 0; k < obj->nfp; ++k) {
+         __m256i v = _mm256_loadu_si256((__m256i*) (str + k));
+         __m256i l = _mm256_shuffle_epi8(lo[k],
+                                         _mm256_and_si256(v, nibble));
+         __m256i h = _mm256_shuffle_epi8(hi[k],
+                     _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+         m = _mm256_and_si256(m, _mm256_and_si256(l, h));
+      }
+      unsigned bits = ~(unsigned) _mm256_movemask_epi8(
+                         _mm256_cmpeq_epi8(m, _mm256_setzero_si256()));
+      if (!bits)
+         continue;
+      unsigned char buckets[32];
+      _mm256_storeu_si256((__m256i*) buckets, m);
+      char* found = check(obj, str, end, bits, buckets, which);
+      if (found)
+         return found;
+   }
+   return scalar(obj, str, end, which);
+}
+
+/** packed64
+  *
+  * Check sixty-four positions at a time; the tables are copied into
+  * all four lanes.
+  */
+__attribute__((target("avx512f,avx512bw")))
+static char* packed64(teddy_t* obj, char* str, char* end, int* which) {
+   __m512i nibble = _mm512_set1_epi8(0x0f);
+   __m512i lo[FINGERPRINT], hi[FINGERPRINT];
+   for (int k = 0; k < obj->nfp; ++k) {
+      lo[k] = _mm512_broadcast_i32x4(
+                 _mm_loadu_si128((__m128i*) obj->lo[k]));
+      hi[k] = _mm512_broadcast_i32x4(
+                 _mm_loadu_si128((__m128i*) obj->hi[k]));
+   }
+   for (; end - str >= 64 + obj->nfp - 1; str += 64) {
+      __m512i m = _mm512_set1_epi8(-1);
+      for (int k = 0; k < obj->nfp; ++k) {
+         __m512i v = _mm512_loadu_si512((void*) (str + k));
+         __m512i l = _mm512_shuffle_epi8(lo[k],
+                                         _mm512_and_si512(v, nibble));
+         __m512i h = _mm512_shuffle_epi8(hi[k],
+                     _mm512_and_si512(_mm512_srli_epi16(v, 4), nibble));
+         m = _mm512_and_si512(m, _mm512_and_si512(l, h));
+      }
+      __mmask64 bits = _mm512_test_epi8_mask(m, m);
+      if (!bits)
+         continue;
+      unsigned char buckets[64];
+      _mm512_storeu_si512((void*) buckets, m);
+      char* found = check(obj, str, end, bits, buckets, which);
+      if (found)
+         return found;
+   }
+   return scalar(obj, str, end, which);
+}
+
+#endif /* ifdef SIMD_X86 */
+
+/** pick_kernel
+  *
+  * Choose the search function for the selected level.
+  */
+static void pick_kernel(teddy_t* obj) {
+   obj->find = &scalar;
+#ifdef SIMD_X86
+   switch (simd_get_level()) {
+      case SIMD_AVX512: obj->find = &packed64; break;
+      case SIMD_AVX2:   obj->find = &packed32; break;
+      case SIMD_SSE42:  obj->find = &packed16; break;
+      default: break;
+   }
+#endif
+}
+
+/***************************public functions*************************/
+
+char* teddy_find(teddy_t* obj, char* str, char* end, int* which) {
+   assert(obj && str && end && which);
+   return obj->find(obj, str, end, which);
+}
+
+int teddy_length(teddy_t* obj, int which) {
+   assert(obj && which >= 0 && which < obj->nlit);
+   return obj->len[which];
+}
+
+size_t teddy_bytes(teddy_t* obj) {
+   assert(obj);
+   size_t bytes = sizeof(teddy_t);
+   for (int i = 0; i < obj->nlit; ++i)
+      bytes += obj->len[i] + 1;
+   return bytes;
+}
+
+/** add_byte
+  *
+  * Put a byte of a literal at the given offset into the tables.
+  */
+static void add_byte(teddy_t* obj, int k, unsigned char u, int i) {
+   obj->masks[k][u] |= 1 << i;
+   obj->lo[k][u & 0x0f] |= 1 << i;
+   obj->hi[k][u >> 4]   |= 1 << i;
+}
+
+teddy_t* teddy_new(char** literals, const bool* caseless, int n) {
+   assert(literals && n > 0 && n <= TEDDY_MAX);
+   teddy_t* obj = calloc(1, sizeof(teddy_t));
+   assert(obj);
+   obj->nlit = n;
+   obj->minlen = -1;
+   for (int i = 0; i < n; ++i) {
+      assert(literals[i] && *literals[i]);
+      obj->literals[i] = strdup(literals[i]);
+      assert(obj->literals[i]);
+      obj->len[i] = strlen(literals[i]);
+      obj->caseless[i] = caseless && caseless[i];
+      if (obj->minlen < 0 || obj->len[i] < obj->minlen)
+         obj->minlen = obj->len[i];
+   }
+   obj->nfp = obj->minlen < FINGERPRINT ? obj->minlen : FINGERPRINT;
+   for (int i = 0; i < n; ++i) {
+      for (int k = 0; k < obj->nfp; ++k) {
+         unsigned char u = obj->literals[i][k];
+         add_byte(obj, k, u, i);
+         if (obj->caseless[i] && u >= 'a' && u <= 'z')
+            add_byte(obj, k, u - 0x20, i);
+      }
+   }
+   pick_kernel(obj);
+   return obj;
+}
+
+void teddy_free(teddy_t* obj) {
+   if (obj) {
+      for (int i = 0; i < obj->nlit; ++i)
+         free(obj->literals[i]);
+      free(obj);
+   }
+}
+
+/********************************************************************/
@@ -0,0 +1,66 @@
+/* teddy.h
+ *
+ * Packed search for a small set of short literals, after the Teddy
+ * algorithm. The first few bytes of every literal are summarized in
+ * nibble tables, so that sixteen or thirty-two positions of the input
+ * can be checked against all of the literals at once with a couple of
+ * byte shuffles. Only the positions that pass are compared against
+ * the literals themselves. Any of the literals can be searched for
+ * without regard to the case of ascii letters.
+ */
+
+#ifndef __regex_teddy
+#define __regex_teddy
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* The most literals a single object can hold. Each literal gets its
+ * own bit in an eight bit bucket mask.
+ */
+#define TEDDY_MAX 8
+
+typedef struct _teddy teddy_t;
+
+/** find
+  *
+  * Find the leftmost-first occurrence of any of the literals in the
+  * input between the two pointers, where the second pointer points
+  * one after the last byte that may be read: the occurrence that
+  * begins closest to the front of the input, and of the literals that
+  * occur there, the one that comes first in the array passed to
+  * teddy_new. Return a pointer to the beginning of the occurrence and
+  * set *which to the index of the literal, or return NULL if none of
+  * the literals occur in the input.
+  */
+char* teddy_find(teddy_t*, char*, char*, int* which);
+
+/** length
+  *
+  * Get the length in bytes of the literal with the given index.
+  */
+int teddy_length(teddy_t*, int);
+
+/** bytes
+  *
+  * Get the number of bytes of memory used by the object.
+  */
+size_t teddy_bytes(teddy_t*);
+
+/** new
+  *
+  * Build the tables for an array of between one and TEDDY_MAX
+  * non-empty literals. The object keeps its own copies of the
+  * literals. The array of bools says which literals ignore the case
+  * of ascii letters; their letters must be small letters. It may be
+  * NULL if none of them do.
+  */
+teddy_t* teddy_new(char**, const bool* caseless, int);
+
+/** free
+  *
+  * Deallocate the object.
+  */
+void teddy_free(teddy_t*);
+
+#endif
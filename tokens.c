@@ -203,10 +203,10 @@ void tlist_obliterate(tlist_t* list) {
          case GROUP: case ATOMIC: case LOOKAHEAD: case NLOOKAHEAD:
             tlist_obliterate(token.data.group);
             break;
-         case LITERAL:
+         case LITERAL: case ILITERAL:
             free(token.data.literal);
             break;
-         case STRING: case NAME:
+         case STRING: case ISTRING: case NAME:
             free(token.data.string);
             break;
          default:
@@ -235,7 +235,7 @@ static uint32_t lowest(class_t* tree) {
 static char* token_info(token_t* token) {
    static char buff[1 << 12];
    switch (token->flag) {
-      case LITERAL: {
+      case LITERAL: case ILITERAL: {
          char* str = u8_duplicate(token->data.literal);
          sprintf(buff, "Literal: U+%X; %s",
                        u8_deref(token->data.literal), str);
@@ -243,7 +243,7 @@ static char* token_info(token_t* token) {
          return buff;
       }
 
-      case STRING: 
+      case STRING: case ISTRING:
          sprintf(buff, "String: \"%s\"", token->data.string);
          return buff;
 
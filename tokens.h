@@ -20,7 +20,10 @@
  */
 typedef enum {
    LITERAL,     // single literal character
+   ILITERAL,    // literal ascii letter, matched in either case
    STRING,      // match a series of literals
+   ISTRING,     // match a series of literals, ignoring the case of
+                //   ascii letters; the letters are kept small
    NAME,        // stores the name of a named group
    ALTERNATOR,  // alternator; x|y where x and y are patterns, matches a
                 //   string that matches either x or y.
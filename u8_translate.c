@@ -55,7 +55,7 @@ static inline uint32_t u8decode3bytes(char* u) {
 }
 
 static inline uint32_t u8decode4bytes(char* u) {
-   int b1 = *u     & 0x08;
+   int b1 = *u     & 0x07;
    int b2 = *(u+1) & 0x3F;
    int b3 = *(u+2) & 0x3F;
    int b4 = *(u+3) & 0x3F;
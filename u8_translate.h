@@ -7,6 +7,8 @@
 #ifndef __regex_u8_translate
 #define __regex_u8_translate
 
+#include <stdint.h>
+
 /* Codepoint to indicate that we have attempted to decode a malformed
  * unicode code sequence.
  */
@@ -0,0 +1,318 @@
+/* unicode.c
+ *
+ * Implementation of unicode properties. A property number holds the
+ * kind of property in its high bits and which one of that kind in its
+ * low eight bits.
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "unicode.h"
+#include "unicode_tables.h"
+
+#define MAXCP 0x110000
+
+// Kinds of properties.
+enum {
+   Category = 1,     // a general category
+   Major,            // codepoints whose category begins with a letter
+   Cased,            // Lu, Ll and Lt
+   Script,
+   Space,
+   Any
+};
+
+#define Property(KIND, VALUE) ((KIND) << 8 | (VALUE))
+#define Kind(P)  ((P) >> 8)
+#define Value(P) ((P) & 0xFF)
+
+// Codepoints per block of the third stage.
+#define BLOCK (1 << UNICODE_SHIFT3)
+
+/* alias
+ *
+ * A long name of a general category. These are fixed by the Unicode
+ * stability policy, so they're kept here instead of being generated.
+ */
+typedef struct {
+   const char* name;
+   const char* category;
+} alias_t;
+
+static const alias_t aliases[] = {
+   { "Letter",                "L"  },
+   { "Cased_Letter",          "LC" },
+   { "Uppercase_Letter",      "Lu" },
+   { "Lowercase_Letter",      "Ll" },
+   { "Titlecase_Letter",      "Lt" },
+   { "Modifier_Letter",       "Lm" },
+   { "Other_Letter",          "Lo" },
+   { "Mark",                  "M"  },
+   { "Nonspacing_Mark",       "Mn" },
+   { "Spacing_Mark",          "Mc" },
+   { "Enclosing_Mark",        "Me" },
+   { "Number",                "N"  },
+   { "Decimal_Number",        "Nd" },
+   { "Letter_Number",         "Nl" },
+   { "Other_Number",          "No" },
+   { "Punctuation",           "P"  },
+   { "Connector_Punctuation", "Pc" },
+   { "Dash_Punctuation",      "Pd" },
+   { "Open_Punctuation",      "Ps" },
+   { "Close_Punctuation",     "Pe" },
+   { "Initial_Punctuation",   "Pi" },
+   { "Final_Punctuation",     "Pf" },
+   { "Other_Punctuation",     "Po" },
+   { "Symbol",                "S"  },
+   { "Math_Symbol",           "Sm" },
+   { "Currency_Symbol",       "Sc" },
+   { "Modifier_Symbol",       "Sk" },
+   { "Other_Symbol",          "So" },
+   { "Separator",             "Z"  },
+   { "Space_Separator",       "Zs" },
+   { "Line_Separator",        "Zl" },
+   { "Paragraph_Separator",   "Zp" },
+   { "Other",                 "C"  },
+   { "Control",               "Cc" },
+   { "Format",                "Cf" },
+   { "Surrogate",             "Cs" },
+   { "Private_Use",           "Co" },
+   { "Unassigned",            "Cn" }
+};
+
+/***************************static functions*************************/
+
+/** record
+  *
+  * Get the record of a codepoint.
+  */
+static inline const unicode_record_t* record(uint32_t cp) {
+   uint32_t b = unicode_stage1[cp >> (UNICODE_SHIFT2 + UNICODE_SHIFT3)];
+   b = unicode_stage2[(b << UNICODE_SHIFT2)
+                      + (cp >> UNICODE_SHIFT3 & ((1 << UNICODE_SHIFT2) - 1))];
+   return &unicode_records[unicode_stage3[(b << UNICODE_SHIFT3)
+                                          + (cp & (BLOCK - 1))]];
+}
+
+/** loose_equal
+  *
+  * Compare a name to a null terminated string, ignoring case, spaces,
+  * hyphens and underscores.
+  */
+static bool loose_equal(const char* name, size_t len, const char* str) {
+   const char* end = name + len;
+   for (;;) {
+      while (name != end && (*name == ' ' || *name == '-' || *name == '_'))
+         ++name;
+      while (*str == ' ' || *str == '-' || *str == '_')
+         ++str;
+      if (name == end || !*str)
+         return name == end && !*str;
+      if (tolower((unsigned char) *name) != tolower((unsigned char) *str))
+         return false;
+      ++name;
+      ++str;
+   }
+}
+
+/** find_category
+  *
+  * Get the property for a short general category name, which may be
+  * one of the seven major categories, or "LC" or "L&".
+  */
+static int find_category(const char* name, size_t len) {
+   if (len == 2 && name[0] == 'L' && (name[1] == 'C' || name[1] == '&'))
+      return Property(Cased, 0);
+   if (len == 1 && strchr("LMNPSZC", *name))
+      return Property(Major, *name);
+   for (int i = 0; i < UNICODE_CATEGORIES; ++i) {
+      if (loose_equal(name, len, unicode_category_names[i]))
+         return Property(Category, i);
+   }
+   for (size_t i = 0; i < sizeof(aliases) / sizeof(alias_t); ++i) {
+      if (loose_equal(name, len, aliases[i].name))
+         return find_category(aliases[i].category,
+                              strlen(aliases[i].category));
+   }
+   return -1;
+}
+
+/** find_script
+  *
+  * Get the property for a script name.
+  */
+static int find_script(const char* name, size_t len) {
+   for (int i = 0; i < UNICODE_SCRIPTS; ++i) {
+      if (loose_equal(name, len, unicode_script_names[i]))
+         return Property(Script, i);
+   }
+   return -1;
+}
+
+/** has_record
+  *
+  * Check if a record has a property.
+  */
+static inline bool has_record(int property, const unicode_record_t* rec) {
+   switch (Kind(property)) {
+      case Category:
+         return rec->category == Value(property);
+      case Major:
+         return unicode_category_names[rec->category][0] == Value(property);
+      case Cased: {
+         const char* name = unicode_category_names[rec->category];
+         return name[0] == 'L' && strchr("ult", name[1]);
+      }
+      case Script:
+         return rec->script == Value(property);
+      case Space:
+         return rec->space;
+      default:
+         return true;
+   }
+}
+
+/** find_orbit
+  *
+  * Get the orbit entry of a codepoint, or NULL if it has none.
+  */
+static const unicode_orbit_t* find_orbit(uint32_t cp) {
+   int lo = 0, hi = UNICODE_ORBITS - 1;
+   while (lo <= hi) {
+      int mid = (lo + hi) / 2;
+      if (cp < unicode_orbits[mid].cp)
+         hi = mid - 1;
+      else if (cp > unicode_orbits[mid].cp)
+         lo = mid + 1;
+      else
+         return &unicode_orbits[mid];
+   }
+   return NULL;
+}
+
+/* runs
+ *
+ * The ranges of a class being built from the tables, in order.
+ */
+typedef struct {
+   urange32_t* ranges;
+   int n;
+   int cap;
+   bool in;          // true if the last codepoint seen is in the class
+   uint32_t start;   // where the current range began, if in is true
+} runs_t;
+
+/** extend
+  *
+  * Tell runs whether a codepoint is in the class. Codepoints must be
+  * given in order; any that are skipped are taken to be the same as
+  * the last one given.
+  */
+static void extend(runs_t* runs, bool has, uint32_t cp) {
+   if (has == runs->in)
+      return;
+   runs->in = has;
+   if (has) {
+      runs->start = cp;
+      return;
+   }
+   if (runs->n == runs->cap) {
+      runs->cap = runs->cap ? runs->cap * 2 : 64;
+      runs->ranges = realloc(runs->ranges, runs->cap * sizeof(urange32_t));
+      assert(runs->ranges);
+   }
+   runs->ranges[runs->n].lo = runs->start;
+   runs->ranges[runs->n].hi = cp - 1;
+   ++runs->n;
+}
+
+/***************************public functions*************************/
+
+int unicode_property(const char* name, size_t len) {
+   assert(name);
+   const char* eq = memchr(name, '=', len);
+   if (eq) {
+      size_t keylen = eq - name;
+      const char* value = eq + 1;
+      size_t vallen = len - keylen - 1;
+      if (loose_equal(name, keylen, "gc")
+                || loose_equal(name, keylen, "General_Category"))
+         return find_category(value, vallen);
+      if (loose_equal(name, keylen, "sc")
+                || loose_equal(name, keylen, "Script"))
+         return find_script(value, vallen);
+      return -1;
+   }
+   if (loose_equal(name, len, "White_Space") || loose_equal(name, len, "space")
+                || loose_equal(name, len, "WSpace"))
+      return Property(Space, 0);
+   if (loose_equal(name, len, "Any"))
+      return Property(Any, 0);
+   int property = find_category(name, len);
+   return property >= 0 ? property : find_script(name, len);
+}
+
+bool unicode_has(int property, uint32_t cp) {
+   assert(property >= 0);
+   if (cp >= MAXCP)
+      return false;
+   return has_record(property, record(cp));
+}
+
+class_t* unicode_class(int property) {
+   assert(property >= 0);
+
+   // Many blocks of the third stage are shared, so remember whether
+   //   all, none or only some of each block has the property.
+   enum { Unknown, All, None, Some };
+   int nblocks = sizeof(unicode_stage3) / sizeof(unicode_stage3[0]) / BLOCK;
+   char* seen = calloc(nblocks, 1);
+   assert(seen);
+
+   runs_t runs = { NULL, 0, 0, false, 0 };
+   for (uint32_t base = 0; base < MAXCP; base += BLOCK) {
+      uint32_t b = unicode_stage1[base >> (UNICODE_SHIFT2 + UNICODE_SHIFT3)];
+      uint32_t mid = base >> UNICODE_SHIFT3 & ((1 << UNICODE_SHIFT2) - 1);
+      b = unicode_stage2[(b << UNICODE_SHIFT2) + mid];
+      if (seen[b] == Unknown) {
+         int count = 0;
+         for (int i = 0; i < BLOCK; ++i)
+            count += has_record(property, record(base + i));
+         seen[b] = count == BLOCK ? All : count ? Some : None;
+      }
+      if (seen[b] == Some) {
+         for (int i = 0; i < BLOCK; ++i)
+            extend(&runs, has_record(property, record(base + i)), base + i);
+      } else {
+         extend(&runs, seen[b] == All, base);
+      }
+   }
+   extend(&runs, false, MAXCP);
+   free(seen);
+
+   class_t* class = class_from_ranges(runs.ranges, runs.n);
+   free(runs.ranges);
+   return class;
+}
+
+uint32_t unicode_fold_next(uint32_t cp) {
+   const unicode_orbit_t* orbit = find_orbit(cp);
+   return orbit ? orbit->next : cp;
+}
+
+void unicode_fold_class(class_t* class) {
+   assert(class);
+   for (int i = 0; i < UNICODE_ORBITS; ++i) {
+      uint32_t cp = unicode_orbits[i].cp;
+      if (!class_search(class, cp))
+         continue;
+      for (uint32_t u = unicode_orbits[i].next; u != cp;
+                                        u = unicode_fold_next(u))
+         class_insert_codepoint(class, u);
+   }
+}
+
+/********************************************************************/
@@ -0,0 +1,68 @@
+/* unicode.h
+ *
+ * Unicode properties of codepoints, for the '\p{..}' and '\P{..}'
+ * classes. The properties come from tables generated from the Unicode
+ * Character Database by gen_unicode_tables.py; looking up the
+ * properties of a codepoint takes three array accesses.
+ *
+ * A property is named the way it's written between the braces:
+ *
+ *    a general category        \p{Lu}, \p{Uppercase_Letter}, \p{gc=Lu}
+ *    a major category          \p{L}, \p{Letter}, \p{LC}, \p{L&}
+ *    a script                  \p{Greek}, \p{sc=Greek}, \p{Script=Greek}
+ *    white space               \p{White_Space}, \p{space}
+ *    every codepoint           \p{Any}
+ *
+ * Names are matched loosely: case, spaces, hyphens and underscores
+ * are ignored.
+ *
+ * The tables also hold the simple case folding, which is used to
+ * match without regard to case.
+ */
+
+#ifndef __regex_unicode
+#define __regex_unicode
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "class.h"
+#include "util.h"
+
+/** property
+  *
+  * Get the number of the property with the given name, which is the
+  * given number of characters long and needn't be null terminated.
+  * Return -1 if there is no such property.
+  */
+int unicode_property(const char*, size_t);
+
+/** has
+  *
+  * Check if a codepoint has a property.
+  */
+bool unicode_has(int, uint32_t);
+
+/** class
+  *
+  * Make a class holding every codepoint that has a property.
+  */
+class_t* unicode_class(int);
+
+/** fold_next
+  *
+  * Get the next codepoint of the case orbit of a codepoint, which
+  * holds the codepoints that are the same when case is ignored, like
+  * 'k', 'K' and the Kelvin sign. Following it from any codepoint
+  * visits the whole orbit and comes back. Returns the codepoint itself
+  * if it has no other case.
+  */
+uint32_t unicode_fold_next(uint32_t);
+
+/** fold_class
+  *
+  * Add to a class every codepoint that is the same as one of its
+  * codepoints when case is ignored.
+  */
+void unicode_fold_class(class_t*);
+
+#endif
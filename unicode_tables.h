@@ -0,0 +1,3080 @@
+/* unicode_tables.h
+ *
+ * Generated by gen_unicode_tables.py from version 14.0.0 of the
+ * Unicode Character Database. Don't edit it by hand.
+ *
+ * The record of a codepoint is found in three steps:
+ *
+ *    b = unicode_stage1[cp >> (UNICODE_SHIFT2 + UNICODE_SHIFT3)]
+ *    b = unicode_stage2[(b << UNICODE_SHIFT2)
+ *                       + (cp >> UNICODE_SHIFT3 & ((1 << UNICODE_SHIFT2) - 1))]
+ *    r = unicode_stage3[(b << UNICODE_SHIFT3)
+ *                       + (cp & ((1 << UNICODE_SHIFT3) - 1))]
+ *
+ * and unicode_records[r] is the record.
+ *
+ * Only unicode.c includes this file.
+ */
+
+#ifndef __regex_unicode_tables
+#define __regex_unicode_tables
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define UNICODE_VERSION "14.0.0"
+#define UNICODE_SHIFT2 5
+#define UNICODE_SHIFT3 3
+#define UNICODE_CATEGORIES 30
+#define UNICODE_SCRIPTS 162
+#define UNICODE_ORBITS 2878
+
+/* unicode_record
+ *
+ * The properties of a codepoint. category and script are indices
+ * into the name arrays below.
+ */
+typedef struct {
+   uint8_t category;
+   uint8_t script;
+   bool space;         // White_Space
+} unicode_record_t;
+
+static const char* const unicode_category_names[] = {
+   "Cn", "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd",
+   "Nl", "No", "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po", "Sm",
+   "Sc", "Sk", "So", "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co",
+};
+
+static const char* const unicode_script_names[] = {
+   "Unknown",
+   "Adlam",
+   "Ahom",
+   "Anatolian_Hieroglyphs",
+   "Arabic",
+   "Armenian",
+   "Avestan",
+   "Balinese",
+   "Bamum",
+   "Bassa_Vah",
+   "Batak",
+   "Bengali",
+   "Bhaiksuki",
+   "Bopomofo",
+   "Brahmi",
+   "Braille",
+   "Buginese",
+   "Buhid",
+   "Canadian_Aboriginal",
+   "Carian",
+   "Caucasian_Albanian",
+   "Chakma",
+   "Cham",
+   "Cherokee",
+   "Chorasmian",
+   "Common",
+   "Coptic",
+   "Cuneiform",
+   "Cypriot",
+   "Cypro_Minoan",
+   "Cyrillic",
+   "Deseret",
+   "Devanagari",
+   "Dives_Akuru",
+   "Dogra",
+   "Duployan",
+   "Egyptian_Hieroglyphs",
+   "Elbasan",
+   "Elymaic",
+   "Ethiopic",
+   "Georgian",
+   "Glagolitic",
+   "Gothic",
+   "Grantha",
+   "Greek",
+   "Gujarati",
+   "Gunjala_Gondi",
+   "Gurmukhi",
+   "Han",
+   "Hangul",
+   "Hanifi_Rohingya",
+   "Hanunoo",
+   "Hatran",
+   "Hebrew",
+   "Hiragana",
+   "Imperial_Aramaic",
+   "Inherited",
+   "Inscriptional_Pahlavi",
+   "Inscriptional_Parthian",
+   "Javanese",
+   "Kaithi",
+   "Kannada",
+   "Katakana",
+   "Kayah_Li",
+   "Kharoshthi",
+   "Khitan_Small_Script",
+   "Khmer",
+   "Khojki",
+   "Khudawadi",
+   "Lao",
+   "Latin",
+   "Lepcha",
+   "Limbu",
+   "Linear_A",
+   "Linear_B",
+   "Lisu",
+   "Lycian",
+   "Lydian",
+   "Mahajani",
+   "Makasar",
+   "Malayalam",
+   "Mandaic",
+   "Manichaean",
+   "Marchen",
+   "Masaram_Gondi",
+   "Medefaidrin",
+   "Meetei_Mayek",
+   "Mende_Kikakui",
+   "Meroitic_Cursive",
+   "Meroitic_Hieroglyphs",
+   "Miao",
+   "Modi",
+   "Mongolian",
+   "Mro",
+   "Multani",
+   "Myanmar",
+   "Nabataean",
+   "Nandinagari",
+   "New_Tai_Lue",
+   "Newa",
+   "Nko",
+   "Nushu",
+   "Nyiakeng_Puachue_Hmong",
+   "Ogham",
+   "Ol_Chiki",
+   "Old_Hungarian",
+   "Old_Italic",
+   "Old_North_Arabian",
+   "Old_Permic",
+   "Old_Persian",
+   "Old_Sogdian",
+   "Old_South_Arabian",
+   "Old_Turkic",
+   "Old_Uyghur",
+   "Oriya",
+   "Osage",
+   "Osmanya",
+   "Pahawh_Hmong",
+   "Palmyrene",
+   "Pau_Cin_Hau",
+   "Phags_Pa",
+   "Phoenician",
+   "Psalter_Pahlavi",
+   "Rejang",
+   "Runic",
+   "Samaritan",
+   "Saurashtra",
+   "Sharada",
+   "Shavian",
+   "Siddham",
+   "SignWriting",
+   "Sinhala",
+   "Sogdian",
+   "Sora_Sompeng",
+   "Soyombo",
+   "Sundanese",
+   "Syloti_Nagri",
+   "Syriac",
+   "Tagalog",
+   "Tagbanwa",
+   "Tai_Le",
+   "Tai_Tham",
+   "Tai_Viet",
+   "Takri",
+   "Tamil",
+   "Tangsa",
+   "Tangut",
+   "Telugu",
+   "Thaana",
+   "Thai",
+   "Tibetan",
+   "Tifinagh",
+   "Tirhuta",
+   "Toto",
+   "Ugaritic",
+   "Vai",
+   "Vithkuqi",
+   "Wancho",
+   "Warang_Citi",
+   "Yezidi",
+   "Yi",
+   "Zanabazar_Square",
+};
+
+static const unicode_record_t unicode_records[] = {
+   { 0, 0, false },
+   { 26, 25, false },
+   { 26, 25, true },
+   { 23, 25, true },
+   { 18, 25, false },
+   { 20, 25, false },
+   { 14, 25, false },
+   { 15, 25, false },
+   { 19, 25, false },
+   { 13, 25, false },
+   { 9, 25, false },
+   { 1, 70, false },
+   { 21, 25, false },
+   { 12, 25, false },
+   { 2, 70, false },
+   { 22, 25, false },
+   { 5, 70, false },
+   { 16, 25, false },
+   { 27, 25, false },
+   { 11, 25, false },
+   { 2, 25, false },
+   { 17, 25, false },
+   { 3, 70, false },
+   { 4, 70, false },
+   { 4, 25, false },
+   { 21, 13, false },
+   { 6, 56, false },
+   { 1, 44, false },
+   { 2, 44, false },
+   { 21, 44, false },
+   { 4, 44, false },
+   { 1, 26, false },
+   { 2, 26, false },
+   { 19, 44, false },
+   { 1, 30, false },
+   { 2, 30, false },
+   { 22, 30, false },
+   { 6, 30, false },
+   { 8, 30, false },
+   { 1, 5, false },
+   { 4, 5, false },
+   { 18, 5, false },
+   { 2, 5, false },
+   { 13, 5, false },
+   { 22, 5, false },
+   { 20, 5, false },
+   { 6, 53, false },
+   { 13, 53, false },
+   { 18, 53, false },
+   { 5, 53, false },
+   { 27, 4, false },
+   { 19, 4, false },
+   { 18, 4, false },
+   { 20, 4, false },
+   { 22, 4, false },
+   { 6, 4, false },
+   { 5, 4, false },
+   { 9, 4, false },
+   { 4, 4, false },
+   { 18, 137, false },
+   { 27, 137, false },
+   { 5, 137, false },
+   { 6, 137, false },
+   { 5, 148, false },
+   { 6, 148, false },
+   { 9, 100, false },
+   { 5, 100, false },
+   { 6, 100, false },
+   { 4, 100, false },
+   { 22, 100, false },
+   { 18, 100, false },
+   { 20, 100, false },
+   { 5, 125, false },
+   { 6, 125, false },
+   { 4, 125, false },
+   { 18, 125, false },
+   { 5, 81, false },
+   { 6, 81, false },
+   { 18, 81, false },
+   { 21, 4, false },
+   { 6, 32, false },
+   { 7, 32, false },
+   { 5, 32, false },
+   { 9, 32, false },
+   { 18, 32, false },
+   { 4, 32, false },
+   { 5, 11, false },
+   { 6, 11, false },
+   { 7, 11, false },
+   { 9, 11, false },
+   { 20, 11, false },
+   { 11, 11, false },
+   { 22, 11, false },
+   { 18, 11, false },
+   { 6, 47, false },
+   { 7, 47, false },
+   { 5, 47, false },
+   { 9, 47, false },
+   { 18, 47, false },
+   { 6, 45, false },
+   { 7, 45, false },
+   { 5, 45, false },
+   { 9, 45, false },
+   { 18, 45, false },
+   { 20, 45, false },
+   { 6, 114, false },
+   { 7, 114, false },
+   { 5, 114, false },
+   { 9, 114, false },
+   { 22, 114, false },
+   { 11, 114, false },
+   { 6, 144, false },
+   { 5, 144, false },
+   { 7, 144, false },
+   { 9, 144, false },
+   { 11, 144, false },
+   { 22, 144, false },
+   { 20, 144, false },
+   { 6, 147, false },
+   { 7, 147, false },
+   { 5, 147, false },
+   { 9, 147, false },
+   { 18, 147, false },
+   { 11, 147, false },
+   { 22, 147, false },
+   { 5, 61, false },
+   { 6, 61, false },
+   { 7, 61, false },
+   { 18, 61, false },
+   { 9, 61, false },
+   { 6, 80, false },
+   { 7, 80, false },
+   { 5, 80, false },
+   { 22, 80, false },
+   { 11, 80, false },
+   { 9, 80, false },
+   { 6, 131, false },
+   { 7, 131, false },
+   { 5, 131, false },
+   { 9, 131, false },
+   { 18, 131, false },
+   { 5, 149, false },
+   { 6, 149, false },
+   { 4, 149, false },
+   { 18, 149, false },
+   { 9, 149, false },
+   { 5, 69, false },
+   { 6, 69, false },
+   { 4, 69, false },
+   { 9, 69, false },
+   { 5, 150, false },
+   { 22, 150, false },
+   { 18, 150, false },
+   { 6, 150, false },
+   { 9, 150, false },
+   { 11, 150, false },
+   { 14, 150, false },
+   { 15, 150, false },
+   { 7, 150, false },
+   { 5, 95, false },
+   { 7, 95, false },
+   { 6, 95, false },
+   { 9, 95, false },
+   { 18, 95, false },
+   { 22, 95, false },
+   { 1, 40, false },
+   { 2, 40, false },
+   { 4, 40, false },
+   { 5, 49, false },
+   { 5, 39, false },
+   { 6, 39, false },
+   { 18, 39, false },
+   { 11, 39, false },
+   { 22, 39, false },
+   { 1, 23, false },
+   { 2, 23, false },
+   { 13, 18, false },
+   { 5, 18, false },
+   { 22, 18, false },
+   { 18, 18, false },
+   { 23, 103, true },
+   { 5, 103, false },
+   { 14, 103, false },
+   { 15, 103, false },
+   { 5, 124, false },
+   { 10, 124, false },
+   { 5, 138, false },
+   { 6, 138, false },
+   { 7, 138, false },
+   { 5, 51, false },
+   { 6, 51, false },
+   { 7, 51, false },
+   { 5, 17, false },
+   { 6, 17, false },
+   { 5, 139, false },
+   { 6, 139, false },
+   { 5, 66, false },
+   { 6, 66, false },
+   { 7, 66, false },
+   { 18, 66, false },
+   { 4, 66, false },
+   { 20, 66, false },
+   { 9, 66, false },
+   { 11, 66, false },
+   { 18, 92, false },
+   { 13, 92, false },
+   { 6, 92, false },
+   { 27, 92, false },
+   { 9, 92, false },
+   { 5, 92, false },
+   { 4, 92, false },
+   { 5, 72, false },
+   { 6, 72, false },
+   { 7, 72, false },
+   { 22, 72, false },
+   { 18, 72, false },
+   { 9, 72, false },
+   { 5, 140, false },
+   { 5, 98, false },
+   { 9, 98, false },
+   { 11, 98, false },
+   { 22, 98, false },
+   { 22, 66, false },
+   { 5, 16, false },
+   { 6, 16, false },
+   { 7, 16, false },
+   { 18, 16, false },
+   { 5, 141, false },
+   { 7, 141, false },
+   { 6, 141, false },
+   { 9, 141, false },
+   { 18, 141, false },
+   { 4, 141, false },
+   { 8, 56, false },
+   { 6, 7, false },
+   { 7, 7, false },
+   { 5, 7, false },
+   { 9, 7, false },
+   { 18, 7, false },
+   { 22, 7, false },
+   { 6, 135, false },
+   { 7, 135, false },
+   { 5, 135, false },
+   { 9, 135, false },
+   { 5, 10, false },
+   { 6, 10, false },
+   { 7, 10, false },
+   { 18, 10, false },
+   { 5, 71, false },
+   { 7, 71, false },
+   { 6, 71, false },
+   { 18, 71, false },
+   { 9, 71, false },
+   { 9, 104, false },
+   { 5, 104, false },
+   { 4, 104, false },
+   { 18, 104, false },
+   { 18, 135, false },
+   { 7, 25, false },
+   { 5, 25, false },
+   { 4, 30, false },
+   { 3, 44, false },
+   { 27, 56, false },
+   { 24, 25, true },
+   { 25, 25, true },
+   { 1, 25, false },
+   { 10, 70, false },
+   { 22, 15, false },
+   { 1, 41, false },
+   { 2, 41, false },
+   { 22, 26, false },
+   { 6, 26, false },
+   { 18, 26, false },
+   { 11, 26, false },
+   { 5, 151, false },
+   { 4, 151, false },
+   { 18, 151, false },
+   { 6, 151, false },
+   { 22, 48, false },
+   { 4, 48, false },
+   { 10, 48, false },
+   { 7, 49, false },
+   { 5, 54, false },
+   { 4, 54, false },
+   { 5, 62, false },
+   { 4, 62, false },
+   { 5, 13, false },
+   { 22, 49, false },
+   { 22, 62, false },
+   { 5, 48, false },
+   { 5, 160, false },
+   { 4, 160, false },
+   { 22, 160, false },
+   { 5, 75, false },
+   { 4, 75, false },
+   { 18, 75, false },
+   { 5, 155, false },
+   { 4, 155, false },
+   { 18, 155, false },
+   { 9, 155, false },
+   { 5, 30, false },
+   { 18, 30, false },
+   { 5, 8, false },
+   { 10, 8, false },
+   { 6, 8, false },
+   { 18, 8, false },
+   { 5, 136, false },
+   { 6, 136, false },
+   { 7, 136, false },
+   { 22, 136, false },
+   { 5, 120, false },
+   { 18, 120, false },
+   { 7, 126, false },
+   { 5, 126, false },
+   { 6, 126, false },
+   { 18, 126, false },
+   { 9, 126, false },
+   { 9, 63, false },
+   { 5, 63, false },
+   { 6, 63, false },
+   { 18, 63, false },
+   { 5, 123, false },
+   { 6, 123, false },
+   { 7, 123, false },
+   { 18, 123, false },
+   { 6, 59, false },
+   { 7, 59, false },
+   { 5, 59, false },
+   { 18, 59, false },
+   { 9, 59, false },
+   { 4, 95, false },
+   { 5, 22, false },
+   { 6, 22, false },
+   { 7, 22, false },
+   { 9, 22, false },
+   { 18, 22, false },
+   { 5, 142, false },
+   { 6, 142, false },
+   { 4, 142, false },
+   { 18, 142, false },
+   { 5, 86, false },
+   { 7, 86, false },
+   { 6, 86, false },
+   { 18, 86, false },
+   { 4, 86, false },
+   { 9, 86, false },
+   { 28, 0, false },
+   { 29, 0, false },
+   { 19, 53, false },
+   { 5, 74, false },
+   { 10, 44, false },
+   { 11, 44, false },
+   { 22, 44, false },
+   { 5, 76, false },
+   { 5, 19, false },
+   { 5, 106, false },
+   { 11, 106, false },
+   { 5, 42, false },
+   { 10, 42, false },
+   { 5, 108, false },
+   { 6, 108, false },
+   { 5, 154, false },
+   { 18, 154, false },
+   { 5, 109, false },
+   { 18, 109, false },
+   { 10, 109, false },
+   { 1, 31, false },
+   { 2, 31, false },
+   { 5, 128, false },
+   { 5, 116, false },
+   { 9, 116, false },
+   { 1, 115, false },
+   { 2, 115, false },
+   { 5, 37, false },
+   { 5, 20, false },
+   { 18, 20, false },
+   { 1, 156, false },
+   { 2, 156, false },
+   { 5, 73, false },
+   { 5, 28, false },
+   { 5, 55, false },
+   { 18, 55, false },
+   { 11, 55, false },
+   { 5, 118, false },
+   { 22, 118, false },
+   { 11, 118, false },
+   { 5, 96, false },
+   { 11, 96, false },
+   { 5, 52, false },
+   { 11, 52, false },
+   { 5, 121, false },
+   { 11, 121, false },
+   { 18, 121, false },
+   { 5, 77, false },
+   { 18, 77, false },
+   { 5, 89, false },
+   { 5, 88, false },
+   { 11, 88, false },
+   { 5, 64, false },
+   { 6, 64, false },
+   { 11, 64, false },
+   { 18, 64, false },
+   { 5, 111, false },
+   { 11, 111, false },
+   { 18, 111, false },
+   { 5, 107, false },
+   { 11, 107, false },
+   { 5, 82, false },
+   { 22, 82, false },
+   { 6, 82, false },
+   { 11, 82, false },
+   { 18, 82, false },
+   { 5, 6, false },
+   { 18, 6, false },
+   { 5, 58, false },
+   { 11, 58, false },
+   { 5, 57, false },
+   { 11, 57, false },
+   { 5, 122, false },
+   { 18, 122, false },
+   { 11, 122, false },
+   { 5, 112, false },
+   { 1, 105, false },
+   { 2, 105, false },
+   { 11, 105, false },
+   { 5, 50, false },
+   { 6, 50, false },
+   { 9, 50, false },
+   { 11, 4, false },
+   { 5, 159, false },
+   { 6, 159, false },
+   { 13, 159, false },
+   { 5, 110, false },
+   { 11, 110, false },
+   { 5, 132, false },
+   { 6, 132, false },
+   { 11, 132, false },
+   { 18, 132, false },
+   { 5, 113, false },
+   { 6, 113, false },
+   { 18, 113, false },
+   { 5, 24, false },
+   { 11, 24, false },
+   { 5, 38, false },
+   { 7, 14, false },
+   { 6, 14, false },
+   { 5, 14, false },
+   { 18, 14, false },
+   { 11, 14, false },
+   { 9, 14, false },
+   { 6, 60, false },
+   { 7, 60, false },
+   { 5, 60, false },
+   { 18, 60, false },
+   { 27, 60, false },
+   { 5, 133, false },
+   { 9, 133, false },
+   { 6, 21, false },
+   { 5, 21, false },
+   { 7, 21, false },
+   { 9, 21, false },
+   { 18, 21, false },
+   { 5, 78, false },
+   { 6, 78, false },
+   { 18, 78, false },
+   { 6, 127, false },
+   { 7, 127, false },
+   { 5, 127, false },
+   { 18, 127, false },
+   { 9, 127, false },
+   { 11, 131, false },
+   { 5, 67, false },
+   { 7, 67, false },
+   { 6, 67, false },
+   { 18, 67, false },
+   { 5, 94, false },
+   { 18, 94, false },
+   { 5, 68, false },
+   { 6, 68, false },
+   { 7, 68, false },
+   { 9, 68, false },
+   { 6, 43, false },
+   { 7, 43, false },
+   { 5, 43, false },
+   { 5, 99, false },
+   { 7, 99, false },
+   { 6, 99, false },
+   { 18, 99, false },
+   { 9, 99, false },
+   { 5, 152, false },
+   { 7, 152, false },
+   { 6, 152, false },
+   { 18, 152, false },
+   { 9, 152, false },
+   { 5, 129, false },
+   { 7, 129, false },
+   { 6, 129, false },
+   { 18, 129, false },
+   { 5, 91, false },
+   { 7, 91, false },
+   { 6, 91, false },
+   { 18, 91, false },
+   { 9, 91, false },
+   { 5, 143, false },
+   { 6, 143, false },
+   { 7, 143, false },
+   { 18, 143, false },
+   { 9, 143, false },
+   { 5, 2, false },
+   { 6, 2, false },
+   { 7, 2, false },
+   { 9, 2, false },
+   { 11, 2, false },
+   { 18, 2, false },
+   { 22, 2, false },
+   { 5, 34, false },
+   { 7, 34, false },
+   { 6, 34, false },
+   { 18, 34, false },
+   { 1, 158, false },
+   { 2, 158, false },
+   { 9, 158, false },
+   { 11, 158, false },
+   { 5, 158, false },
+   { 5, 33, false },
+   { 7, 33, false },
+   { 6, 33, false },
+   { 18, 33, false },
+   { 9, 33, false },
+   { 5, 97, false },
+   { 7, 97, false },
+   { 6, 97, false },
+   { 18, 97, false },
+   { 5, 161, false },
+   { 6, 161, false },
+   { 7, 161, false },
+   { 18, 161, false },
+   { 5, 134, false },
+   { 6, 134, false },
+   { 7, 134, false },
+   { 18, 134, false },
+   { 5, 119, false },
+   { 5, 12, false },
+   { 7, 12, false },
+   { 6, 12, false },
+   { 18, 12, false },
+   { 9, 12, false },
+   { 11, 12, false },
+   { 18, 83, false },
+   { 5, 83, false },
+   { 6, 83, false },
+   { 7, 83, false },
+   { 5, 84, false },
+   { 6, 84, false },
+   { 9, 84, false },
+   { 5, 46, false },
+   { 7, 46, false },
+   { 6, 46, false },
+   { 9, 46, false },
+   { 5, 79, false },
+   { 6, 79, false },
+   { 7, 79, false },
+   { 18, 79, false },
+   { 18, 144, false },
+   { 5, 27, false },
+   { 10, 27, false },
+   { 18, 27, false },
+   { 5, 29, false },
+   { 18, 29, false },
+   { 5, 36, false },
+   { 27, 36, false },
+   { 5, 3, false },
+   { 5, 93, false },
+   { 9, 93, false },
+   { 18, 93, false },
+   { 5, 145, false },
+   { 9, 145, false },
+   { 5, 9, false },
+   { 6, 9, false },
+   { 18, 9, false },
+   { 5, 117, false },
+   { 6, 117, false },
+   { 18, 117, false },
+   { 22, 117, false },
+   { 4, 117, false },
+   { 9, 117, false },
+   { 11, 117, false },
+   { 1, 85, false },
+   { 2, 85, false },
+   { 11, 85, false },
+   { 18, 85, false },
+   { 5, 90, false },
+   { 6, 90, false },
+   { 7, 90, false },
+   { 4, 90, false },
+   { 4, 146, false },
+   { 4, 101, false },
+   { 18, 48, false },
+   { 6, 65, false },
+   { 7, 48, false },
+   { 5, 146, false },
+   { 5, 65, false },
+   { 5, 101, false },
+   { 5, 35, false },
+   { 22, 35, false },
+   { 6, 35, false },
+   { 18, 35, false },
+   { 6, 44, false },
+   { 22, 130, false },
+   { 6, 130, false },
+   { 18, 130, false },
+   { 6, 41, false },
+   { 5, 102, false },
+   { 6, 102, false },
+   { 4, 102, false },
+   { 9, 102, false },
+   { 22, 102, false },
+   { 5, 153, false },
+   { 6, 153, false },
+   { 5, 157, false },
+   { 6, 157, false },
+   { 9, 157, false },
+   { 20, 157, false },
+   { 5, 87, false },
+   { 11, 87, false },
+   { 6, 87, false },
+   { 1, 1, false },
+   { 2, 1, false },
+   { 6, 1, false },
+   { 4, 1, false },
+   { 9, 1, false },
+   { 18, 1, false },
+   { 22, 54, false },
+};
+
+/* unicode_orbit
+ *
+ * A codepoint whose case orbit has more than one codepoint, and
+ * the next codepoint of the orbit, in order of cp.
+ */
+typedef struct {
+   uint32_t cp;
+   uint32_t next;
+} unicode_orbit_t;
+
+static const unicode_orbit_t unicode_orbits[] = {
+   { 0x00041, 0x00061 }, { 0x00042, 0x00062 }, { 0x00043, 0x00063 },
+   { 0x00044, 0x00064 }, { 0x00045, 0x00065 }, { 0x00046, 0x00066 },
+   { 0x00047, 0x00067 }, { 0x00048, 0x00068 }, { 0x00049, 0x00069 },
+   { 0x0004A, 0x0006A }, { 0x0004B, 0x0006B }, { 0x0004C, 0x0006C },
+   { 0x0004D, 0x0006D }, { 0x0004E, 0x0006E }, { 0x0004F, 0x0006F },
+   { 0x00050, 0x00070 }, { 0x00051, 0x00071 }, { 0x00052, 0x00072 },
+   { 0x00053, 0x00073 }, { 0x00054, 0x00074 }, { 0x00055, 0x00075 },
+   { 0x00056, 0x00076 }, { 0x00057, 0x00077 }, { 0x00058, 0x00078 },
+   { 0x00059, 0x00079 }, { 0x0005A, 0x0007A }, { 0x00061, 0x00041 },
+   { 0x00062, 0x00042 }, { 0x00063, 0x00043 }, { 0x00064, 0x00044 },
+   { 0x00065, 0x00045 }, { 0x00066, 0x00046 }, { 0x00067, 0x00047 },
+   { 0x00068, 0x00048 }, { 0x00069, 0x00049 }, { 0x0006A, 0x0004A },
+   { 0x0006B, 0x0212A }, { 0x0006C, 0x0004C }, { 0x0006D, 0x0004D },
+   { 0x0006E, 0x0004E }, { 0x0006F, 0x0004F }, { 0x00070, 0x00050 },
+   { 0x00071, 0x00051 }, { 0x00072, 0x00052 }, { 0x00073, 0x0017F },
+   { 0x00074, 0x00054 }, { 0x00075, 0x00055 }, { 0x00076, 0x00056 },
+   { 0x00077, 0x00057 }, { 0x00078, 0x00058 }, { 0x00079, 0x00059 },
+   { 0x0007A, 0x0005A }, { 0x000B5, 0x0039C }, { 0x000C0, 0x000E0 },
+   { 0x000C1, 0x000E1 }, { 0x000C2, 0x000E2 }, { 0x000C3, 0x000E3 },
+   { 0x000C4, 0x000E4 }, { 0x000C5, 0x000E5 }, { 0x000C6, 0x000E6 },
+   { 0x000C7, 0x000E7 }, { 0x000C8, 0x000E8 }, { 0x000C9, 0x000E9 },
+   { 0x000CA, 0x000EA }, { 0x000CB, 0x000EB }, { 0x000CC, 0x000EC },
+   { 0x000CD, 0x000ED }, { 0x000CE, 0x000EE }, { 0x000CF, 0x000EF },
+   { 0x000D0, 0x000F0 }, { 0x000D1, 0x000F1 }, { 0x000D2, 0x000F2 },
+   { 0x000D3, 0x000F3 }, { 0x000D4, 0x000F4 }, { 0x000D5, 0x000F5 },
+   { 0x000D6, 0x000F6 }, { 0x000D8, 0x000F8 }, { 0x000D9, 0x000F9 },
+   { 0x000DA, 0x000FA }, { 0x000DB, 0x000FB }, { 0x000DC, 0x000FC },
+   { 0x000DD, 0x000FD }, { 0x000DE, 0x000FE }, { 0x000DF, 0x01E9E },
+   { 0x000E0, 0x000C0 }, { 0x000E1, 0x000C1 }, { 0x000E2, 0x000C2 },
+   { 0x000E3, 0x000C3 }, { 0x000E4, 0x000C4 }, { 0x000E5, 0x0212B },
+   { 0x000E6, 0x000C6 }, { 0x000E7, 0x000C7 }, { 0x000E8, 0x000C8 },
+   { 0x000E9, 0x000C9 }, { 0x000EA, 0x000CA }, { 0x000EB, 0x000CB },
+   { 0x000EC, 0x000CC }, { 0x000ED, 0x000CD }, { 0x000EE, 0x000CE },
+   { 0x000EF, 0x000CF }, { 0x000F0, 0x000D0 }, { 0x000F1, 0x000D1 },
+   { 0x000F2, 0x000D2 }, { 0x000F3, 0x000D3 }, { 0x000F4, 0x000D4 },
+   { 0x000F5, 0x000D5 }, { 0x000F6, 0x000D6 }, { 0x000F8, 0x000D8 },
+   { 0x000F9, 0x000D9 }, { 0x000FA, 0x000DA }, { 0x000FB, 0x000DB },
+   { 0x000FC, 0x000DC }, { 0x000FD, 0x000DD }, { 0x000FE, 0x000DE },
+   { 0x000FF, 0x00178 }, { 0x00100, 0x00101 }, { 0x00101, 0x00100 },
+   { 0x00102, 0x00103 }, { 0x00103, 0x00102 }, { 0x00104, 0x00105 },
+   { 0x00105, 0x00104 }, { 0x00106, 0x00107 }, { 0x00107, 0x00106 },
+   { 0x00108, 0x00109 }, { 0x00109, 0x00108 }, { 0x0010A, 0x0010B },
+   { 0x0010B, 0x0010A }, { 0x0010C, 0x0010D }, { 0x0010D, 0x0010C },
+   { 0x0010E, 0x0010F }, { 0x0010F, 0x0010E }, { 0x00110, 0x00111 },
+   { 0x00111, 0x00110 }, { 0x00112, 0x00113 }, { 0x00113, 0x00112 },
+   { 0x00114, 0x00115 }, { 0x00115, 0x00114 }, { 0x00116, 0x00117 },
+   { 0x00117, 0x00116 }, { 0x00118, 0x00119 }, { 0x00119, 0x00118 },
+   { 0x0011A, 0x0011B }, { 0x0011B, 0x0011A }, { 0x0011C, 0x0011D },
+   { 0x0011D, 0x0011C }, { 0x0011E, 0x0011F }, { 0x0011F, 0x0011E },
+   { 0x00120, 0x00121 }, { 0x00121, 0x00120 }, { 0x00122, 0x00123 },
+   { 0x00123, 0x00122 }, { 0x00124, 0x00125 }, { 0x00125, 0x00124 },
+   { 0x00126, 0x00127 }, { 0x00127, 0x00126 }, { 0x00128, 0x00129 },
+   { 0x00129, 0x00128 }, { 0x0012A, 0x0012B }, { 0x0012B, 0x0012A },
+   { 0x0012C, 0x0012D }, { 0x0012D, 0x0012C }, { 0x0012E, 0x0012F },
+   { 0x0012F, 0x0012E }, { 0x00132, 0x00133 }, { 0x00133, 0x00132 },
+   { 0x00134, 0x00135 }, { 0x00135, 0x00134 }, { 0x00136, 0x00137 },
+   { 0x00137, 0x00136 }, { 0x00139, 0x0013A }, { 0x0013A, 0x00139 },
+   { 0x0013B, 0x0013C }, { 0x0013C, 0x0013B }, { 0x0013D, 0x0013E },
+   { 0x0013E, 0x0013D }, { 0x0013F, 0x00140 }, { 0x00140, 0x0013F },
+   { 0x00141, 0x00142 }, { 0x00142, 0x00141 }, { 0x00143, 0x00144 },
+   { 0x00144, 0x00143 }, { 0x00145, 0x00146 }, { 0x00146, 0x00145 },
+   { 0x00147, 0x00148 }, { 0x00148, 0x00147 }, { 0x0014A, 0x0014B },
+   { 0x0014B, 0x0014A }, { 0x0014C, 0x0014D }, { 0x0014D, 0x0014C },
+   { 0x0014E, 0x0014F }, { 0x0014F, 0x0014E }, { 0x00150, 0x00151 },
+   { 0x00151, 0x00150 }, { 0x00152, 0x00153 }, { 0x00153, 0x00152 },
+   { 0x00154, 0x00155 }, { 0x00155, 0x00154 }, { 0x00156, 0x00157 },
+   { 0x00157, 0x00156 }, { 0x00158, 0x00159 }, { 0x00159, 0x00158 },
+   { 0x0015A, 0x0015B }, { 0x0015B, 0x0015A }, { 0x0015C, 0x0015D },
+   { 0x0015D, 0x0015C }, { 0x0015E, 0x0015F }, { 0x0015F, 0x0015E },
+   { 0x00160, 0x00161 }, { 0x00161, 0x00160 }, { 0x00162, 0x00163 },
+   { 0x00163, 0x00162 }, { 0x00164, 0x00165 }, { 0x00165, 0x00164 },
+   { 0x00166, 0x00167 }, { 0x00167, 0x00166 }, { 0x00168, 0x00169 },
+   { 0x00169, 0x00168 }, { 0x0016A, 0x0016B }, { 0x0016B, 0x0016A },
+   { 0x0016C, 0x0016D }, { 0x0016D, 0x0016C }, { 0x0016E, 0x0016F },
+   { 0x0016F, 0x0016E }, { 0x00170, 0x00171 }, { 0x00171, 0x00170 },
+   { 0x00172, 0x00173 }, { 0x00173, 0x00172 }, { 0x00174, 0x00175 },
+   { 0x00175, 0x00174 }, { 0x00176, 0x00177 }, { 0x00177, 0x00176 },
+   { 0x00178, 0x000FF }, { 0x00179, 0x0017A }, { 0x0017A, 0x00179 },
+   { 0x0017B, 0x0017C }, { 0x0017C, 0x0017B }, { 0x0017D, 0x0017E },
+   { 0x0017E, 0x0017D }, { 0x0017F, 0x00053 }, { 0x00180, 0x00243 },
+   { 0x00181, 0x00253 }, { 0x00182, 0x00183 }, { 0x00183, 0x00182 },
+   { 0x00184, 0x00185 }, { 0x00185, 0x00184 }, { 0x00186, 0x00254 },
+   { 0x00187, 0x00188 }, { 0x00188, 0x00187 }, { 0x00189, 0x00256 },
+   { 0x0018A, 0x00257 }, { 0x0018B, 0x0018C }, { 0x0018C, 0x0018B },
+   { 0x0018E, 0x001DD }, { 0x0018F, 0x00259 }, { 0x00190, 0x0025B },
+   { 0x00191, 0x00192 }, { 0x00192, 0x00191 }, { 0x00193, 0x00260 },
+   { 0x00194, 0x00263 }, { 0x00195, 0x001F6 }, { 0x00196, 0x00269 },
+   { 0x00197, 0x00268 }, { 0x00198, 0x00199 }, { 0x00199, 0x00198 },
+   { 0x0019A, 0x0023D }, { 0x0019C, 0x0026F }, { 0x0019D, 0x00272 },
+   { 0x0019E, 0x00220 }, { 0x0019F, 0x00275 }, { 0x001A0, 0x001A1 },
+   { 0x001A1, 0x001A0 }, { 0x001A2, 0x001A3 }, { 0x001A3, 0x001A2 },
+   { 0x001A4, 0x001A5 }, { 0x001A5, 0x001A4 }, { 0x001A6, 0x00280 },
+   { 0x001A7, 0x001A8 }, { 0x001A8, 0x001A7 }, { 0x001A9, 0x00283 },
+   { 0x001AC, 0x001AD }, { 0x001AD, 0x001AC }, { 0x001AE, 0x00288 },
+   { 0x001AF, 0x001B0 }, { 0x001B0, 0x001AF }, { 0x001B1, 0x0028A },
+   { 0x001B2, 0x0028B }, { 0x001B3, 0x001B4 }, { 0x001B4, 0x001B3 },
+   { 0x001B5, 0x001B6 }, { 0x001B6, 0x001B5 }, { 0x001B7, 0x00292 },
+   { 0x001B8, 0x001B9 }, { 0x001B9, 0x001B8 }, { 0x001BC, 0x001BD },
+   { 0x001BD, 0x001BC }, { 0x001BF, 0x001F7 }, { 0x001C4, 0x001C5 },
+   { 0x001C5, 0x001C6 }, { 0x001C6, 0x001C4 }, { 0x001C7, 0x001C8 },
+   { 0x001C8, 0x001C9 }, { 0x001C9, 0x001C7 }, { 0x001CA, 0x001CB },
+   { 0x001CB, 0x001CC }, { 0x001CC, 0x001CA }, { 0x001CD, 0x001CE },
+   { 0x001CE, 0x001CD }, { 0x001CF, 0x001D0 }, { 0x001D0, 0x001CF },
+   { 0x001D1, 0x001D2 }, { 0x001D2, 0x001D1 }, { 0x001D3, 0x001D4 },
+   { 0x001D4, 0x001D3 }, { 0x001D5, 0x001D6 }, { 0x001D6, 0x001D5 },
+   { 0x001D7, 0x001D8 }, { 0x001D8, 0x001D7 }, { 0x001D9, 0x001DA },
+   { 0x001DA, 0x001D9 }, { 0x001DB, 0x001DC }, { 0x001DC, 0x001DB },
+   { 0x001DD, 0x0018E }, { 0x001DE, 0x001DF }, { 0x001DF, 0x001DE },
+   { 0x001E0, 0x001E1 }, { 0x001E1, 0x001E0 }, { 0x001E2, 0x001E3 },
+   { 0x001E3, 0x001E2 }, { 0x001E4, 0x001E5 }, { 0x001E5, 0x001E4 },
+   { 0x001E6, 0x001E7 }, { 0x001E7, 0x001E6 }, { 0x001E8, 0x001E9 },
+   { 0x001E9, 0x001E8 }, { 0x001EA, 0x001EB }, { 0x001EB, 0x001EA },
+   { 0x001EC, 0x001ED }, { 0x001ED, 0x001EC }, { 0x001EE, 0x001EF },
+   { 0x001EF, 0x001EE }, { 0x001F1, 0x001F2 }, { 0x001F2, 0x001F3 },
+   { 0x001F3, 0x001F1 }, { 0x001F4, 0x001F5 }, { 0x001F5, 0x001F4 },
+   { 0x001F6, 0x00195 }, { 0x001F7, 0x001BF }, { 0x001F8, 0x001F9 },
+   { 0x001F9, 0x001F8 }, { 0x001FA, 0x001FB }, { 0x001FB, 0x001FA },
+   { 0x001FC, 0x001FD }, { 0x001FD, 0x001FC }, { 0x001FE, 0x001FF },
+   { 0x001FF, 0x001FE }, { 0x00200, 0x00201 }, { 0x00201, 0x00200 },
+   { 0x00202, 0x00203 }, { 0x00203, 0x00202 }, { 0x00204, 0x00205 },
+   { 0x00205, 0x00204 }, { 0x00206, 0x00207 }, { 0x00207, 0x00206 },
+   { 0x00208, 0x00209 }, { 0x00209, 0x00208 }, { 0x0020A, 0x0020B },
+   { 0x0020B, 0x0020A }, { 0x0020C, 0x0020D }, { 0x0020D, 0x0020C },
+   { 0x0020E, 0x0020F }, { 0x0020F, 0x0020E }, { 0x00210, 0x00211 },
+   { 0x00211, 0x00210 }, { 0x00212, 0x00213 }, { 0x00213, 0x00212 },
+   { 0x00214, 0x00215 }, { 0x00215, 0x00214 }, { 0x00216, 0x00217 },
+   { 0x00217, 0x00216 }, { 0x00218, 0x00219 }, { 0x00219, 0x00218 },
+   { 0x0021A, 0x0021B }, { 0x0021B, 0x0021A }, { 0x0021C, 0x0021D },
+   { 0x0021D, 0x0021C }, { 0x0021E, 0x0021F }, { 0x0021F, 0x0021E },
+   { 0x00220, 0x0019E }, { 0x00222, 0x00223 }, { 0x00223, 0x00222 },
+   { 0x00224, 0x00225 }, { 0x00225, 0x00224 }, { 0x00226, 0x00227 },
+   { 0x00227, 0x00226 }, { 0x00228, 0x00229 }, { 0x00229, 0x00228 },
+   { 0x0022A, 0x0022B }, { 0x0022B, 0x0022A }, { 0x0022C, 0x0022D },
+   { 0x0022D, 0x0022C }, { 0x0022E, 0x0022F }, { 0x0022F, 0x0022E },
+   { 0x00230, 0x00231 }, { 0x00231, 0x00230 }, { 0x00232, 0x00233 },
+   { 0x00233, 0x00232 }, { 0x0023A, 0x02C65 }, { 0x0023B, 0x0023C },
+   { 0x0023C, 0x0023B }, { 0x0023D, 0x0019A }, { 0x0023E, 0x02C66 },
+   { 0x0023F, 0x02C7E }, { 0x00240, 0x02C7F }, { 0x00241, 0x00242 },
+   { 0x00242, 0x00241 }, { 0x00243, 0x00180 }, { 0x00244, 0x00289 },
+   { 0x00245, 0x0028C }, { 0x00246, 0x00247 }, { 0x00247, 0x00246 },
+   { 0x00248, 0x00249 }, { 0x00249, 0x00248 }, { 0x0024A, 0x0024B },
+   { 0x0024B, 0x0024A }, { 0x0024C, 0x0024D }, { 0x0024D, 0x0024C },
+   { 0x0024E, 0x0024F }, { 0x0024F, 0x0024E }, { 0x00250, 0x02C6F },
+   { 0x00251, 0x02C6D }, { 0x00252, 0x02C70 }, { 0x00253, 0x00181 },
+   { 0x00254, 0x00186 }, { 0x00256, 0x00189 }, { 0x00257, 0x0018A },
+   { 0x00259, 0x0018F }, { 0x0025B, 0x00190 }, { 0x0025C, 0x0A7AB },
+   { 0x00260, 0x00193 }, { 0x00261, 0x0A7AC }, { 0x00263, 0x00194 },
+   { 0x00265, 0x0A78D }, { 0x00266, 0x0A7AA }, { 0x00268, 0x00197 },
+   { 0x00269, 0x00196 }, { 0x0026A, 0x0A7AE }, { 0x0026B, 0x02C62 },
+   { 0x0026C, 0x0A7AD }, { 0x0026F, 0x0019C }, { 0x00271, 0x02C6E },
+   { 0x00272, 0x0019D }, { 0x00275, 0x0019F }, { 0x0027D, 0x02C64 },
+   { 0x00280, 0x001A6 }, { 0x00282, 0x0A7C5 }, { 0x00283, 0x001A9 },
+   { 0x00287, 0x0A7B1 }, { 0x00288, 0x001AE }, { 0x00289, 0x00244 },
+   { 0x0028A, 0x001B1 }, { 0x0028B, 0x001B2 }, { 0x0028C, 0x00245 },
+   { 0x00292, 0x001B7 }, { 0x0029D, 0x0A7B2 }, { 0x0029E, 0x0A7B0 },
+   { 0x00345, 0x00399 }, { 0x00370, 0x00371 }, { 0x00371, 0x00370 },
+   { 0x00372, 0x00373 }, { 0x00373, 0x00372 }, { 0x00376, 0x00377 },
+   { 0x00377, 0x00376 }, { 0x0037B, 0x003FD }, { 0x0037C, 0x003FE },
+   { 0x0037D, 0x003FF }, { 0x0037F, 0x003F3 }, { 0x00386, 0x003AC },
+   { 0x00388, 0x003AD }, { 0x00389, 0x003AE }, { 0x0038A, 0x003AF },
+   { 0x0038C, 0x003CC }, { 0x0038E, 0x003CD }, { 0x0038F, 0x003CE },
+   { 0x00391, 0x003B1 }, { 0x00392, 0x003B2 }, { 0x00393, 0x003B3 },
+   { 0x00394, 0x003B4 }, { 0x00395, 0x003B5 }, { 0x00396, 0x003B6 },
+   { 0x00397, 0x003B7 }, { 0x00398, 0x003B8 }, { 0x00399, 0x003B9 },
+   { 0x0039A, 0x003BA }, { 0x0039B, 0x003BB }, { 0x0039C, 0x003BC },
+   { 0x0039D, 0x003BD }, { 0x0039E, 0x003BE }, { 0x0039F, 0x003BF },
+   { 0x003A0, 0x003C0 }, { 0x003A1, 0x003C1 }, { 0x003A3, 0x003C2 },
+   { 0x003A4, 0x003C4 }, { 0x003A5, 0x003C5 }, { 0x003A6, 0x003C6 },
+   { 0x003A7, 0x003C7 }, { 0x003A8, 0x003C8 }, { 0x003A9, 0x003C9 },
+   { 0x003AA, 0x003CA }, { 0x003AB, 0x003CB }, { 0x003AC, 0x00386 },
+   { 0x003AD, 0x00388 }, { 0x003AE, 0x00389 }, { 0x003AF, 0x0038A },
+   { 0x003B1, 0x00391 }, { 0x003B2, 0x003D0 }, { 0x003B3, 0x00393 },
+   { 0x003B4, 0x00394 }, { 0x003B5, 0x003F5 }, { 0x003B6, 0x00396 },
+   { 0x003B7, 0x00397 }, { 0x003B8, 0x003D1 }, { 0x003B9, 0x01FBE },
+   { 0x003BA, 0x003F0 }, { 0x003BB, 0x0039B }, { 0x003BC, 0x000B5 },
+   { 0x003BD, 0x0039D }, { 0x003BE, 0x0039E }, { 0x003BF, 0x0039F },
+   { 0x003C0, 0x003D6 }, { 0x003C1, 0x003F1 }, { 0x003C2, 0x003C3 },
+   { 0x003C3, 0x003A3 }, { 0x003C4, 0x003A4 }, { 0x003C5, 0x003A5 },
+   { 0x003C6, 0x003D5 }, { 0x003C7, 0x003A7 }, { 0x003C8, 0x003A8 },
+   { 0x003C9, 0x02126 }, { 0x003CA, 0x003AA }, { 0x003CB, 0x003AB },
+   { 0x003CC, 0x0038C }, { 0x003CD, 0x0038E }, { 0x003CE, 0x0038F },
+   { 0x003CF, 0x003D7 }, { 0x003D0, 0x00392 }, { 0x003D1, 0x003F4 },
+   { 0x003D5, 0x003A6 }, { 0x003D6, 0x003A0 }, { 0x003D7, 0x003CF },
+   { 0x003D8, 0x003D9 }, { 0x003D9, 0x003D8 }, { 0x003DA, 0x003DB },
+   { 0x003DB, 0x003DA }, { 0x003DC, 0x003DD }, { 0x003DD, 0x003DC },
+   { 0x003DE, 0x003DF }, { 0x003DF, 0x003DE }, { 0x003E0, 0x003E1 },
+   { 0x003E1, 0x003E0 }, { 0x003E2, 0x003E3 }, { 0x003E3, 0x003E2 },
+   { 0x003E4, 0x003E5 }, { 0x003E5, 0x003E4 }, { 0x003E6, 0x003E7 },
+   { 0x003E7, 0x003E6 }, { 0x003E8, 0x003E9 }, { 0x003E9, 0x003E8 },
+   { 0x003EA, 0x003EB }, { 0x003EB, 0x003EA }, { 0x003EC, 0x003ED },
+   { 0x003ED, 0x003EC }, { 0x003EE, 0x003EF }, { 0x003EF, 0x003EE },
+   { 0x003F0, 0x0039A }, { 0x003F1, 0x003A1 }, { 0x003F2, 0x003F9 },
+   { 0x003F3, 0x0037F }, { 0x003F4, 0x00398 }, { 0x003F5, 0x00395 },
+   { 0x003F7, 0x003F8 }, { 0x003F8, 0x003F7 }, { 0x003F9, 0x003F2 },
+   { 0x003FA, 0x003FB }, { 0x003FB, 0x003FA }, { 0x003FD, 0x0037B },
+   { 0x003FE, 0x0037C }, { 0x003FF, 0x0037D }, { 0x00400, 0x00450 },
+   { 0x00401, 0x00451 }, { 0x00402, 0x00452 }, { 0x00403, 0x00453 },
+   { 0x00404, 0x00454 }, { 0x00405, 0x00455 }, { 0x00406, 0x00456 },
+   { 0x00407, 0x00457 }, { 0x00408, 0x00458 }, { 0x00409, 0x00459 },
+   { 0x0040A, 0x0045A }, { 0x0040B, 0x0045B }, { 0x0040C, 0x0045C },
+   { 0x0040D, 0x0045D }, { 0x0040E, 0x0045E }, { 0x0040F, 0x0045F },
+   { 0x00410, 0x00430 }, { 0x00411, 0x00431 }, { 0x00412, 0x00432 },
+   { 0x00413, 0x00433 }, { 0x00414, 0x00434 }, { 0x00415, 0x00435 },
+   { 0x00416, 0x00436 }, { 0x00417, 0x00437 }, { 0x00418, 0x00438 },
+   { 0x00419, 0x00439 }, { 0x0041A, 0x0043A }, { 0x0041B, 0x0043B },
+   { 0x0041C, 0x0043C }, { 0x0041D, 0x0043D }, { 0x0041E, 0x0043E },
+   { 0x0041F, 0x0043F }, { 0x00420, 0x00440 }, { 0x00421, 0x00441 },
+   { 0x00422, 0x00442 }, { 0x00423, 0x00443 }, { 0x00424, 0x00444 },
+   { 0x00425, 0x00445 }, { 0x00426, 0x00446 }, { 0x00427, 0x00447 },
+   { 0x00428, 0x00448 }, { 0x00429, 0x00449 }, { 0x0042A, 0x0044A },
+   { 0x0042B, 0x0044B }, { 0x0042C, 0x0044C }, { 0x0042D, 0x0044D },
+   { 0x0042E, 0x0044E }, { 0x0042F, 0x0044F }, { 0x00430, 0x00410 },
+   { 0x00431, 0x00411 }, { 0x00432, 0x01C80 }, { 0x00433, 0x00413 },
+   { 0x00434, 0x01C81 }, { 0x00435, 0x00415 }, { 0x00436, 0x00416 },
+   { 0x00437, 0x00417 }, { 0x00438, 0x00418 }, { 0x00439, 0x00419 },
+   { 0x0043A, 0x0041A }, { 0x0043B, 0x0041B }, { 0x0043C, 0x0041C },
+   { 0x0043D, 0x0041D }, { 0x0043E, 0x01C82 }, { 0x0043F, 0x0041F },
+   { 0x00440, 0x00420 }, { 0x00441, 0x01C83 }, { 0x00442, 0x01C84 },
+   { 0x00443, 0x00423 }, { 0x00444, 0x00424 }, { 0x00445, 0x00425 },
+   { 0x00446, 0x00426 }, { 0x00447, 0x00427 }, { 0x00448, 0x00428 },
+   { 0x00449, 0x00429 }, { 0x0044A, 0x01C86 }, { 0x0044B, 0x0042B },
+   { 0x0044C, 0x0042C }, { 0x0044D, 0x0042D }, { 0x0044E, 0x0042E },
+   { 0x0044F, 0x0042F }, { 0x00450, 0x00400 }, { 0x00451, 0x00401 },
+   { 0x00452, 0x00402 }, { 0x00453, 0x00403 }, { 0x00454, 0x00404 },
+   { 0x00455, 0x00405 }, { 0x00456, 0x00406 }, { 0x00457, 0x00407 },
+   { 0x00458, 0x00408 }, { 0x00459, 0x00409 }, { 0x0045A, 0x0040A },
+   { 0x0045B, 0x0040B }, { 0x0045C, 0x0040C }, { 0x0045D, 0x0040D },
+   { 0x0045E, 0x0040E }, { 0x0045F, 0x0040F }, { 0x00460, 0x00461 },
+   { 0x00461, 0x00460 }, { 0x00462, 0x00463 }, { 0x00463, 0x01C87 },
+   { 0x00464, 0x00465 }, { 0x00465, 0x00464 }, { 0x00466, 0x00467 },
+   { 0x00467, 0x00466 }, { 0x00468, 0x00469 }, { 0x00469, 0x00468 },
+   { 0x0046A, 0x0046B }, { 0x0046B, 0x0046A }, { 0x0046C, 0x0046D },
+   { 0x0046D, 0x0046C }, { 0x0046E, 0x0046F }, { 0x0046F, 0x0046E },
+   { 0x00470, 0x00471 }, { 0x00471, 0x00470 }, { 0x00472, 0x00473 },
+   { 0x00473, 0x00472 }, { 0x00474, 0x00475 }, { 0x00475, 0x00474 },
+   { 0x00476, 0x00477 }, { 0x00477, 0x00476 }, { 0x00478, 0x00479 },
+   { 0x00479, 0x00478 }, { 0x0047A, 0x0047B }, { 0x0047B, 0x0047A },
+   { 0x0047C, 0x0047D }, { 0x0047D, 0x0047C }, { 0x0047E, 0x0047F },
+   { 0x0047F, 0x0047E }, { 0x00480, 0x00481 }, { 0x00481, 0x00480 },
+   { 0x0048A, 0x0048B }, { 0x0048B, 0x0048A }, { 0x0048C, 0x0048D },
+   { 0x0048D, 0x0048C }, { 0x0048E, 0x0048F }, { 0x0048F, 0x0048E },
+   { 0x00490, 0x00491 }, { 0x00491, 0x00490 }, { 0x00492, 0x00493 },
+   { 0x00493, 0x00492 }, { 0x00494, 0x00495 }, { 0x00495, 0x00494 },
+   { 0x00496, 0x00497 }, { 0x00497, 0x00496 }, { 0x00498, 0x00499 },
+   { 0x00499, 0x00498 }, { 0x0049A, 0x0049B }, { 0x0049B, 0x0049A },
+   { 0x0049C, 0x0049D }, { 0x0049D, 0x0049C }, { 0x0049E, 0x0049F },
+   { 0x0049F, 0x0049E }, { 0x004A0, 0x004A1 }, { 0x004A1, 0x004A0 },
+   { 0x004A2, 0x004A3 }, { 0x004A3, 0x004A2 }, { 0x004A4, 0x004A5 },
+   { 0x004A5, 0x004A4 }, { 0x004A6, 0x004A7 }, { 0x004A7, 0x004A6 },
+   { 0x004A8, 0x004A9 }, { 0x004A9, 0x004A8 }, { 0x004AA, 0x004AB },
+   { 0x004AB, 0x004AA }, { 0x004AC, 0x004AD }, { 0x004AD, 0x004AC },
+   { 0x004AE, 0x004AF }, { 0x004AF, 0x004AE }, { 0x004B0, 0x004B1 },
+   { 0x004B1, 0x004B0 }, { 0x004B2, 0x004B3 }, { 0x004B3, 0x004B2 },
+   { 0x004B4, 0x004B5 }, { 0x004B5, 0x004B4 }, { 0x004B6, 0x004B7 },
+   { 0x004B7, 0x004B6 }, { 0x004B8, 0x004B9 }, { 0x004B9, 0x004B8 },
+   { 0x004BA, 0x004BB }, { 0x004BB, 0x004BA }, { 0x004BC, 0x004BD },
+   { 0x004BD, 0x004BC }, { 0x004BE, 0x004BF }, { 0x004BF, 0x004BE },
+   { 0x004C0, 0x004CF }, { 0x004C1, 0x004C2 }, { 0x004C2, 0x004C1 },
+   { 0x004C3, 0x004C4 }, { 0x004C4, 0x004C3 }, { 0x004C5, 0x004C6 },
+   { 0x004C6, 0x004C5 }, { 0x004C7, 0x004C8 }, { 0x004C8, 0x004C7 },
+   { 0x004C9, 0x004CA }, { 0x004CA, 0x004C9 }, { 0x004CB, 0x004CC },
+   { 0x004CC, 0x004CB }, { 0x004CD, 0x004CE }, { 0x004CE, 0x004CD },
+   { 0x004CF, 0x004C0 }, { 0x004D0, 0x004D1 }, { 0x004D1, 0x004D0 },
+   { 0x004D2, 0x004D3 }, { 0x004D3, 0x004D2 }, { 0x004D4, 0x004D5 },
+   { 0x004D5, 0x004D4 }, { 0x004D6, 0x004D7 }, { 0x004D7, 0x004D6 },
+   { 0x004D8, 0x004D9 }, { 0x004D9, 0x004D8 }, { 0x004DA, 0x004DB },
+   { 0x004DB, 0x004DA }, { 0x004DC, 0x004DD }, { 0x004DD, 0x004DC },
+   { 0x004DE, 0x004DF }, { 0x004DF, 0x004DE }, { 0x004E0, 0x004E1 },
+   { 0x004E1, 0x004E0 }, { 0x004E2, 0x004E3 }, { 0x004E3, 0x004E2 },
+   { 0x004E4, 0x004E5 }, { 0x004E5, 0x004E4 }, { 0x004E6, 0x004E7 },
+   { 0x004E7, 0x004E6 }, { 0x004E8, 0x004E9 }, { 0x004E9, 0x004E8 },
+   { 0x004EA, 0x004EB }, { 0x004EB, 0x004EA }, { 0x004EC, 0x004ED },
+   { 0x004ED, 0x004EC }, { 0x004EE, 0x004EF }, { 0x004EF, 0x004EE },
+   { 0x004F0, 0x004F1 }, { 0x004F1, 0x004F0 }, { 0x004F2, 0x004F3 },
+   { 0x004F3, 0x004F2 }, { 0x004F4, 0x004F5 }, { 0x004F5, 0x004F4 },
+   { 0x004F6, 0x004F7 }, { 0x004F7, 0x004F6 }, { 0x004F8, 0x004F9 },
+   { 0x004F9, 0x004F8 }, { 0x004FA, 0x004FB }, { 0x004FB, 0x004FA },
+   { 0x004FC, 0x004FD }, { 0x004FD, 0x004FC }, { 0x004FE, 0x004FF },
+   { 0x004FF, 0x004FE }, { 0x00500, 0x00501 }, { 0x00501, 0x00500 },
+   { 0x00502, 0x00503 }, { 0x00503, 0x00502 }, { 0x00504, 0x00505 },
+   { 0x00505, 0x00504 }, { 0x00506, 0x00507 }, { 0x00507, 0x00506 },
+   { 0x00508, 0x00509 }, { 0x00509, 0x00508 }, { 0x0050A, 0x0050B },
+   { 0x0050B, 0x0050A }, { 0x0050C, 0x0050D }, { 0x0050D, 0x0050C },
+   { 0x0050E, 0x0050F }, { 0x0050F, 0x0050E }, { 0x00510, 0x00511 },
+   { 0x00511, 0x00510 }, { 0x00512, 0x00513 }, { 0x00513, 0x00512 },
+   { 0x00514, 0x00515 }, { 0x00515, 0x00514 }, { 0x00516, 0x00517 },
+   { 0x00517, 0x00516 }, { 0x00518, 0x00519 }, { 0x00519, 0x00518 },
+   { 0x0051A, 0x0051B }, { 0x0051B, 0x0051A }, { 0x0051C, 0x0051D },
+   { 0x0051D, 0x0051C }, { 0x0051E, 0x0051F }, { 0x0051F, 0x0051E },
+   { 0x00520, 0x00521 }, { 0x00521, 0x00520 }, { 0x00522, 0x00523 },
+   { 0x00523, 0x00522 }, { 0x00524, 0x00525 }, { 0x00525, 0x00524 },
+   { 0x00526, 0x00527 }, { 0x00527, 0x00526 }, { 0x00528, 0x00529 },
+   { 0x00529, 0x00528 }, { 0x0052A, 0x0052B }, { 0x0052B, 0x0052A },
+   { 0x0052C, 0x0052D }, { 0x0052D, 0x0052C }, { 0x0052E, 0x0052F },
+   { 0x0052F, 0x0052E }, { 0x00531, 0x00561 }, { 0x00532, 0x00562 },
+   { 0x00533, 0x00563 }, { 0x00534, 0x00564 }, { 0x00535, 0x00565 },
+   { 0x00536, 0x00566 }, { 0x00537, 0x00567 }, { 0x00538, 0x00568 },
+   { 0x00539, 0x00569 }, { 0x0053A, 0x0056A }, { 0x0053B, 0x0056B },
+   { 0x0053C, 0x0056C }, { 0x0053D, 0x0056D }, { 0x0053E, 0x0056E },
+   { 0x0053F, 0x0056F }, { 0x00540, 0x00570 }, { 0x00541, 0x00571 },
+   { 0x00542, 0x00572 }, { 0x00543, 0x00573 }, { 0x00544, 0x00574 },
+   { 0x00545, 0x00575 }, { 0x00546, 0x00576 }, { 0x00547, 0x00577 },
+   { 0x00548, 0x00578 }, { 0x00549, 0x00579 }, { 0x0054A, 0x0057A },
+   { 0x0054B, 0x0057B }, { 0x0054C, 0x0057C }, { 0x0054D, 0x0057D },
+   { 0x0054E, 0x0057E }, { 0x0054F, 0x0057F }, { 0x00550, 0x00580 },
+   { 0x00551, 0x00581 }, { 0x00552, 0x00582 }, { 0x00553, 0x00583 },
+   { 0x00554, 0x00584 }, { 0x00555, 0x00585 }, { 0x00556, 0x00586 },
+   { 0x00561, 0x00531 }, { 0x00562, 0x00532 }, { 0x00563, 0x00533 },
+   { 0x00564, 0x00534 }, { 0x00565, 0x00535 }, { 0x00566, 0x00536 },
+   { 0x00567, 0x00537 }, { 0x00568, 0x00538 }, { 0x00569, 0x00539 },
+   { 0x0056A, 0x0053A }, { 0x0056B, 0x0053B }, { 0x0056C, 0x0053C },
+   { 0x0056D, 0x0053D }, { 0x0056E, 0x0053E }, { 0x0056F, 0x0053F },
+   { 0x00570, 0x00540 }, { 0x00571, 0x00541 }, { 0x00572, 0x00542 },
+   { 0x00573, 0x00543 }, { 0x00574, 0x00544 }, { 0x00575, 0x00545 },
+   { 0x00576, 0x00546 }, { 0x00577, 0x00547 }, { 0x00578, 0x00548 },
+   { 0x00579, 0x00549 }, { 0x0057A, 0x0054A }, { 0x0057B, 0x0054B },
+   { 0x0057C, 0x0054C }, { 0x0057D, 0x0054D }, { 0x0057E, 0x0054E },
+   { 0x0057F, 0x0054F }, { 0x00580, 0x00550 }, { 0x00581, 0x00551 },
+   { 0x00582, 0x00552 }, { 0x00583, 0x00553 }, { 0x00584, 0x00554 },
+   { 0x00585, 0x00555 }, { 0x00586, 0x00556 }, { 0x010A0, 0x02D00 },
+   { 0x010A1, 0x02D01 }, { 0x010A2, 0x02D02 }, { 0x010A3, 0x02D03 },
+   { 0x010A4, 0x02D04 }, { 0x010A5, 0x02D05 }, { 0x010A6, 0x02D06 },
+   { 0x010A7, 0x02D07 }, { 0x010A8, 0x02D08 }, { 0x010A9, 0x02D09 },
+   { 0x010AA, 0x02D0A }, { 0x010AB, 0x02D0B }, { 0x010AC, 0x02D0C },
+   { 0x010AD, 0x02D0D }, { 0x010AE, 0x02D0E }, { 0x010AF, 0x02D0F },
+   { 0x010B0, 0x02D10 }, { 0x010B1, 0x02D11 }, { 0x010B2, 0x02D12 },
+   { 0x010B3, 0x02D13 }, { 0x010B4, 0x02D14 }, { 0x010B5, 0x02D15 },
+   { 0x010B6, 0x02D16 }, { 0x010B7, 0x02D17 }, { 0x010B8, 0x02D18 },
+   { 0x010B9, 0x02D19 }, { 0x010BA, 0x02D1A }, { 0x010BB, 0x02D1B },
+   { 0x010BC, 0x02D1C }, { 0x010BD, 0x02D1D }, { 0x010BE, 0x02D1E },
+   { 0x010BF, 0x02D1F }, { 0x010C0, 0x02D20 }, { 0x010C1, 0x02D21 },
+   { 0x010C2, 0x02D22 }, { 0x010C3, 0x02D23 }, { 0x010C4, 0x02D24 },
+   { 0x010C5, 0x02D25 }, { 0x010C7, 0x02D27 }, { 0x010CD, 0x02D2D },
+   { 0x010D0, 0x01C90 }, { 0x010D1, 0x01C91 }, { 0x010D2, 0x01C92 },
+   { 0x010D3, 0x01C93 }, { 0x010D4, 0x01C94 }, { 0x010D5, 0x01C95 },
+   { 0x010D6, 0x01C96 }, { 0x010D7, 0x01C97 }, { 0x010D8, 0x01C98 },
+   { 0x010D9, 0x01C99 }, { 0x010DA, 0x01C9A }, { 0x010DB, 0x01C9B },
+   { 0x010DC, 0x01C9C }, { 0x010DD, 0x01C9D }, { 0x010DE, 0x01C9E },
+   { 0x010DF, 0x01C9F }, { 0x010E0, 0x01CA0 }, { 0x010E1, 0x01CA1 },
+   { 0x010E2, 0x01CA2 }, { 0x010E3, 0x01CA3 }, { 0x010E4, 0x01CA4 },
+   { 0x010E5, 0x01CA5 }, { 0x010E6, 0x01CA6 }, { 0x010E7, 0x01CA7 },
+   { 0x010E8, 0x01CA8 }, { 0x010E9, 0x01CA9 }, { 0x010EA, 0x01CAA },
+   { 0x010EB, 0x01CAB }, { 0x010EC, 0x01CAC }, { 0x010ED, 0x01CAD },
+   { 0x010EE, 0x01CAE }, { 0x010EF, 0x01CAF }, { 0x010F0, 0x01CB0 },
+   { 0x010F1, 0x01CB1 }, { 0x010F2, 0x01CB2 }, { 0x010F3, 0x01CB3 },
+   { 0x010F4, 0x01CB4 }, { 0x010F5, 0x01CB5 }, { 0x010F6, 0x01CB6 },
+   { 0x010F7, 0x01CB7 }, { 0x010F8, 0x01CB8 }, { 0x010F9, 0x01CB9 },
+   { 0x010FA, 0x01CBA }, { 0x010FD, 0x01CBD }, { 0x010FE, 0x01CBE },
+   { 0x010FF, 0x01CBF }, { 0x013A0, 0x0AB70 }, { 0x013A1, 0x0AB71 },
+   { 0x013A2, 0x0AB72 }, { 0x013A3, 0x0AB73 }, { 0x013A4, 0x0AB74 },
+   { 0x013A5, 0x0AB75 }, { 0x013A6, 0x0AB76 }, { 0x013A7, 0x0AB77 },
+   { 0x013A8, 0x0AB78 }, { 0x013A9, 0x0AB79 }, { 0x013AA, 0x0AB7A },
+   { 0x013AB, 0x0AB7B }, { 0x013AC, 0x0AB7C }, { 0x013AD, 0x0AB7D },
+   { 0x013AE, 0x0AB7E }, { 0x013AF, 0x0AB7F }, { 0x013B0, 0x0AB80 },
+   { 0x013B1, 0x0AB81 }, { 0x013B2, 0x0AB82 }, { 0x013B3, 0x0AB83 },
+   { 0x013B4, 0x0AB84 }, { 0x013B5, 0x0AB85 }, { 0x013B6, 0x0AB86 },
+   { 0x013B7, 0x0AB87 }, { 0x013B8, 0x0AB88 }, { 0x013B9, 0x0AB89 },
+   { 0x013BA, 0x0AB8A }, { 0x013BB, 0x0AB8B }, { 0x013BC, 0x0AB8C },
+   { 0x013BD, 0x0AB8D }, { 0x013BE, 0x0AB8E }, { 0x013BF, 0x0AB8F },
+   { 0x013C0, 0x0AB90 }, { 0x013C1, 0x0AB91 }, { 0x013C2, 0x0AB92 },
+   { 0x013C3, 0x0AB93 }, { 0x013C4, 0x0AB94 }, { 0x013C5, 0x0AB95 },
+   { 0x013C6, 0x0AB96 }, { 0x013C7, 0x0AB97 }, { 0x013C8, 0x0AB98 },
+   { 0x013C9, 0x0AB99 }, { 0x013CA, 0x0AB9A }, { 0x013CB, 0x0AB9B },
+   { 0x013CC, 0x0AB9C }, { 0x013CD, 0x0AB9D }, { 0x013CE, 0x0AB9E },
+   { 0x013CF, 0x0AB9F }, { 0x013D0, 0x0ABA0 }, { 0x013D1, 0x0ABA1 },
+   { 0x013D2, 0x0ABA2 }, { 0x013D3, 0x0ABA3 }, { 0x013D4, 0x0ABA4 },
+   { 0x013D5, 0x0ABA5 }, { 0x013D6, 0x0ABA6 }, { 0x013D7, 0x0ABA7 },
+   { 0x013D8, 0x0ABA8 }, { 0x013D9, 0x0ABA9 }, { 0x013DA, 0x0ABAA },
+   { 0x013DB, 0x0ABAB }, { 0x013DC, 0x0ABAC }, { 0x013DD, 0x0ABAD },
+   { 0x013DE, 0x0ABAE }, { 0x013DF, 0x0ABAF }, { 0x013E0, 0x0ABB0 },
+   { 0x013E1, 0x0ABB1 }, { 0x013E2, 0x0ABB2 }, { 0x013E3, 0x0ABB3 },
+   { 0x013E4, 0x0ABB4 }, { 0x013E5, 0x0ABB5 }, { 0x013E6, 0x0ABB6 },
+   { 0x013E7, 0x0ABB7 }, { 0x013E8, 0x0ABB8 }, { 0x013E9, 0x0ABB9 },
+   { 0x013EA, 0x0ABBA }, { 0x013EB, 0x0ABBB }, { 0x013EC, 0x0ABBC },
+   { 0x013ED, 0x0ABBD }, { 0x013EE, 0x0ABBE }, { 0x013EF, 0x0ABBF },
+   { 0x013F0, 0x013F8 }, { 0x013F1, 0x013F9 }, { 0x013F2, 0x013FA },
+   { 0x013F3, 0x013FB }, { 0x013F4, 0x013FC }, { 0x013F5, 0x013FD },
+   { 0x013F8, 0x013F0 }, { 0x013F9, 0x013F1 }, { 0x013FA, 0x013F2 },
+   { 0x013FB, 0x013F3 }, { 0x013FC, 0x013F4 }, { 0x013FD, 0x013F5 },
+   { 0x01C80, 0x00412 }, { 0x01C81, 0x00414 }, { 0x01C82, 0x0041E },
+   { 0x01C83, 0x00421 }, { 0x01C84, 0x01C85 }, { 0x01C85, 0x00422 },
+   { 0x01C86, 0x0042A }, { 0x01C87, 0x00462 }, { 0x01C88, 0x0A64A },
+   { 0x01C90, 0x010D0 }, { 0x01C91, 0x010D1 }, { 0x01C92, 0x010D2 },
+   { 0x01C93, 0x010D3 }, { 0x01C94, 0x010D4 }, { 0x01C95, 0x010D5 },
+   { 0x01C96, 0x010D6 }, { 0x01C97, 0x010D7 }, { 0x01C98, 0x010D8 },
+   { 0x01C99, 0x010D9 }, { 0x01C9A, 0x010DA }, { 0x01C9B, 0x010DB },
+   { 0x01C9C, 0x010DC }, { 0x01C9D, 0x010DD }, { 0x01C9E, 0x010DE },
+   { 0x01C9F, 0x010DF }, { 0x01CA0, 0x010E0 }, { 0x01CA1, 0x010E1 },
+   { 0x01CA2, 0x010E2 }, { 0x01CA3, 0x010E3 }, { 0x01CA4, 0x010E4 },
+   { 0x01CA5, 0x010E5 }, { 0x01CA6, 0x010E6 }, { 0x01CA7, 0x010E7 },
+   { 0x01CA8, 0x010E8 }, { 0x01CA9, 0x010E9 }, { 0x01CAA, 0x010EA },
+   { 0x01CAB, 0x010EB }, { 0x01CAC, 0x010EC }, { 0x01CAD, 0x010ED },
+   { 0x01CAE, 0x010EE }, { 0x01CAF, 0x010EF }, { 0x01CB0, 0x010F0 },
+   { 0x01CB1, 0x010F1 }, { 0x01CB2, 0x010F2 }, { 0x01CB3, 0x010F3 },
+   { 0x01CB4, 0x010F4 }, { 0x01CB5, 0x010F5 }, { 0x01CB6, 0x010F6 },
+   { 0x01CB7, 0x010F7 }, { 0x01CB8, 0x010F8 }, { 0x01CB9, 0x010F9 },
+   { 0x01CBA, 0x010FA }, { 0x01CBD, 0x010FD }, { 0x01CBE, 0x010FE },
+   { 0x01CBF, 0x010FF }, { 0x01D79, 0x0A77D }, { 0x01D7D, 0x02C63 },
+   { 0x01D8E, 0x0A7C6 }, { 0x01E00, 0x01E01 }, { 0x01E01, 0x01E00 },
+   { 0x01E02, 0x01E03 }, { 0x01E03, 0x01E02 }, { 0x01E04, 0x01E05 },
+   { 0x01E05, 0x01E04 }, { 0x01E06, 0x01E07 }, { 0x01E07, 0x01E06 },
+   { 0x01E08, 0x01E09 }, { 0x01E09, 0x01E08 }, { 0x01E0A, 0x01E0B },
+   { 0x01E0B, 0x01E0A }, { 0x01E0C, 0x01E0D }, { 0x01E0D, 0x01E0C },
+   { 0x01E0E, 0x01E0F }, { 0x01E0F, 0x01E0E }, { 0x01E10, 0x01E11 },
+   { 0x01E11, 0x01E10 }, { 0x01E12, 0x01E13 }, { 0x01E13, 0x01E12 },
+   { 0x01E14, 0x01E15 }, { 0x01E15, 0x01E14 }, { 0x01E16, 0x01E17 },
+   { 0x01E17, 0x01E16 }, { 0x01E18, 0x01E19 }, { 0x01E19, 0x01E18 },
+   { 0x01E1A, 0x01E1B }, { 0x01E1B, 0x01E1A }, { 0x01E1C, 0x01E1D },
+   { 0x01E1D, 0x01E1C }, { 0x01E1E, 0x01E1F }, { 0x01E1F, 0x01E1E },
+   { 0x01E20, 0x01E21 }, { 0x01E21, 0x01E20 }, { 0x01E22, 0x01E23 },
+   { 0x01E23, 0x01E22 }, { 0x01E24, 0x01E25 }, { 0x01E25, 0x01E24 },
+   { 0x01E26, 0x01E27 }, { 0x01E27, 0x01E26 }, { 0x01E28, 0x01E29 },
+   { 0x01E29, 0x01E28 }, { 0x01E2A, 0x01E2B }, { 0x01E2B, 0x01E2A },
+   { 0x01E2C, 0x01E2D }, { 0x01E2D, 0x01E2C }, { 0x01E2E, 0x01E2F },
+   { 0x01E2F, 0x01E2E }, { 0x01E30, 0x01E31 }, { 0x01E31, 0x01E30 },
+   { 0x01E32, 0x01E33 }, { 0x01E33, 0x01E32 }, { 0x01E34, 0x01E35 },
+   { 0x01E35, 0x01E34 }, { 0x01E36, 0x01E37 }, { 0x01E37, 0x01E36 },
+   { 0x01E38, 0x01E39 }, { 0x01E39, 0x01E38 }, { 0x01E3A, 0x01E3B },
+   { 0x01E3B, 0x01E3A }, { 0x01E3C, 0x01E3D }, { 0x01E3D, 0x01E3C },
+   { 0x01E3E, 0x01E3F }, { 0x01E3F, 0x01E3E }, { 0x01E40, 0x01E41 },
+   { 0x01E41, 0x01E40 }, { 0x01E42, 0x01E43 }, { 0x01E43, 0x01E42 },
+   { 0x01E44, 0x01E45 }, { 0x01E45, 0x01E44 }, { 0x01E46, 0x01E47 },
+   { 0x01E47, 0x01E46 }, { 0x01E48, 0x01E49 }, { 0x01E49, 0x01E48 },
+   { 0x01E4A, 0x01E4B }, { 0x01E4B, 0x01E4A }, { 0x01E4C, 0x01E4D },
+   { 0x01E4D, 0x01E4C }, { 0x01E4E, 0x01E4F }, { 0x01E4F, 0x01E4E },
+   { 0x01E50, 0x01E51 }, { 0x01E51, 0x01E50 }, { 0x01E52, 0x01E53 },
+   { 0x01E53, 0x01E52 }, { 0x01E54, 0x01E55 }, { 0x01E55, 0x01E54 },
+   { 0x01E56, 0x01E57 }, { 0x01E57, 0x01E56 }, { 0x01E58, 0x01E59 },
+   { 0x01E59, 0x01E58 }, { 0x01E5A, 0x01E5B }, { 0x01E5B, 0x01E5A },
+   { 0x01E5C, 0x01E5D }, { 0x01E5D, 0x01E5C }, { 0x01E5E, 0x01E5F },
+   { 0x01E5F, 0x01E5E }, { 0x01E60, 0x01E61 }, { 0x01E61, 0x01E9B },
+   { 0x01E62, 0x01E63 }, { 0x01E63, 0x01E62 }, { 0x01E64, 0x01E65 },
+   { 0x01E65, 0x01E64 }, { 0x01E66, 0x01E67 }, { 0x01E67, 0x01E66 },
+   { 0x01E68, 0x01E69 }, { 0x01E69, 0x01E68 }, { 0x01E6A, 0x01E6B },
+   { 0x01E6B, 0x01E6A }, { 0x01E6C, 0x01E6D }, { 0x01E6D, 0x01E6C },
+   { 0x01E6E, 0x01E6F }, { 0x01E6F, 0x01E6E }, { 0x01E70, 0x01E71 },
+   { 0x01E71, 0x01E70 }, { 0x01E72, 0x01E73 }, { 0x01E73, 0x01E72 },
+   { 0x01E74, 0x01E75 }, { 0x01E75, 0x01E74 }, { 0x01E76, 0x01E77 },
+   { 0x01E77, 0x01E76 }, { 0x01E78, 0x01E79 }, { 0x01E79, 0x01E78 },
+   { 0x01E7A, 0x01E7B }, { 0x01E7B, 0x01E7A }, { 0x01E7C, 0x01E7D },
+   { 0x01E7D, 0x01E7C }, { 0x01E7E, 0x01E7F }, { 0x01E7F, 0x01E7E },
+   { 0x01E80, 0x01E81 }, { 0x01E81, 0x01E80 }, { 0x01E82, 0x01E83 },
+   { 0x01E83, 0x01E82 }, { 0x01E84, 0x01E85 }, { 0x01E85, 0x01E84 },
+   { 0x01E86, 0x01E87 }, { 0x01E87, 0x01E86 }, { 0x01E88, 0x01E89 },
+   { 0x01E89, 0x01E88 }, { 0x01E8A, 0x01E8B }, { 0x01E8B, 0x01E8A },
+   { 0x01E8C, 0x01E8D }, { 0x01E8D, 0x01E8C }, { 0x01E8E, 0x01E8F },
+   { 0x01E8F, 0x01E8E }, { 0x01E90, 0x01E91 }, { 0x01E91, 0x01E90 },
+   { 0x01E92, 0x01E93 }, { 0x01E93, 0x01E92 }, { 0x01E94, 0x01E95 },
+   { 0x01E95, 0x01E94 }, { 0x01E9B, 0x01E60 }, { 0x01E9E, 0x000DF },
+   { 0x01EA0, 0x01EA1 }, { 0x01EA1, 0x01EA0 }, { 0x01EA2, 0x01EA3 },
+   { 0x01EA3, 0x01EA2 }, { 0x01EA4, 0x01EA5 }, { 0x01EA5, 0x01EA4 },
+   { 0x01EA6, 0x01EA7 }, { 0x01EA7, 0x01EA6 }, { 0x01EA8, 0x01EA9 },
+   { 0x01EA9, 0x01EA8 }, { 0x01EAA, 0x01EAB }, { 0x01EAB, 0x01EAA },
+   { 0x01EAC, 0x01EAD }, { 0x01EAD, 0x01EAC }, { 0x01EAE, 0x01EAF },
+   { 0x01EAF, 0x01EAE }, { 0x01EB0, 0x01EB1 }, { 0x01EB1, 0x01EB0 },
+   { 0x01EB2, 0x01EB3 }, { 0x01EB3, 0x01EB2 }, { 0x01EB4, 0x01EB5 },
+   { 0x01EB5, 0x01EB4 }, { 0x01EB6, 0x01EB7 }, { 0x01EB7, 0x01EB6 },
+   { 0x01EB8, 0x01EB9 }, { 0x01EB9, 0x01EB8 }, { 0x01EBA, 0x01EBB },
+   { 0x01EBB, 0x01EBA }, { 0x01EBC, 0x01EBD }, { 0x01EBD, 0x01EBC },
+   { 0x01EBE, 0x01EBF }, { 0x01EBF, 0x01EBE }, { 0x01EC0, 0x01EC1 },
+   { 0x01EC1, 0x01EC0 }, { 0x01EC2, 0x01EC3 }, { 0x01EC3, 0x01EC2 },
+   { 0x01EC4, 0x01EC5 }, { 0x01EC5, 0x01EC4 }, { 0x01EC6, 0x01EC7 },
+   { 0x01EC7, 0x01EC6 }, { 0x01EC8, 0x01EC9 }, { 0x01EC9, 0x01EC8 },
+   { 0x01ECA, 0x01ECB }, { 0x01ECB, 0x01ECA }, { 0x01ECC, 0x01ECD },
+   { 0x01ECD, 0x01ECC }, { 0x01ECE, 0x01ECF }, { 0x01ECF, 0x01ECE },
+   { 0x01ED0, 0x01ED1 }, { 0x01ED1, 0x01ED0 }, { 0x01ED2, 0x01ED3 },
+   { 0x01ED3, 0x01ED2 }, { 0x01ED4, 0x01ED5 }, { 0x01ED5, 0x01ED4 },
+   { 0x01ED6, 0x01ED7 }, { 0x01ED7, 0x01ED6 }, { 0x01ED8, 0x01ED9 },
+   { 0x01ED9, 0x01ED8 }, { 0x01EDA, 0x01EDB }, { 0x01EDB, 0x01EDA },
+   { 0x01EDC, 0x01EDD }, { 0x01EDD, 0x01EDC }, { 0x01EDE, 0x01EDF },
+   { 0x01EDF, 0x01EDE }, { 0x01EE0, 0x01EE1 }, { 0x01EE1, 0x01EE0 },
+   { 0x01EE2, 0x01EE3 }, { 0x01EE3, 0x01EE2 }, { 0x01EE4, 0x01EE5 },
+   { 0x01EE5, 0x01EE4 }, { 0x01EE6, 0x01EE7 }, { 0x01EE7, 0x01EE6 },
+   { 0x01EE8, 0x01EE9 }, { 0x01EE9, 0x01EE8 }, { 0x01EEA, 0x01EEB },
+   { 0x01EEB, 0x01EEA }, { 0x01EEC, 0x01EED }, { 0x01EED, 0x01EEC },
+   { 0x01EEE, 0x01EEF }, { 0x01EEF, 0x01EEE }, { 0x01EF0, 0x01EF1 },
+   { 0x01EF1, 0x01EF0 }, { 0x01EF2, 0x01EF3 }, { 0x01EF3, 0x01EF2 },
+   { 0x01EF4, 0x01EF5 }, { 0x01EF5, 0x01EF4 }, { 0x01EF6, 0x01EF7 },
+   { 0x01EF7, 0x01EF6 }, { 0x01EF8, 0x01EF9 }, { 0x01EF9, 0x01EF8 },
+   { 0x01EFA, 0x01EFB }, { 0x01EFB, 0x01EFA }, { 0x01EFC, 0x01EFD },
+   { 0x01EFD, 0x01EFC }, { 0x01EFE, 0x01EFF }, { 0x01EFF, 0x01EFE },
+   { 0x01F00, 0x01F08 }, { 0x01F01, 0x01F09 }, { 0x01F02, 0x01F0A },
+   { 0x01F03, 0x01F0B }, { 0x01F04, 0x01F0C }, { 0x01F05, 0x01F0D },
+   { 0x01F06, 0x01F0E }, { 0x01F07, 0x01F0F }, { 0x01F08, 0x01F00 },
+   { 0x01F09, 0x01F01 }, { 0x01F0A, 0x01F02 }, { 0x01F0B, 0x01F03 },
+   { 0x01F0C, 0x01F04 }, { 0x01F0D, 0x01F05 }, { 0x01F0E, 0x01F06 },
+   { 0x01F0F, 0x01F07 }, { 0x01F10, 0x01F18 }, { 0x01F11, 0x01F19 },
+   { 0x01F12, 0x01F1A }, { 0x01F13, 0x01F1B }, { 0x01F14, 0x01F1C },
+   { 0x01F15, 0x01F1D }, { 0x01F18, 0x01F10 }, { 0x01F19, 0x01F11 },
+   { 0x01F1A, 0x01F12 }, { 0x01F1B, 0x01F13 }, { 0x01F1C, 0x01F14 },
+   { 0x01F1D, 0x01F15 }, { 0x01F20, 0x01F28 }, { 0x01F21, 0x01F29 },
+   { 0x01F22, 0x01F2A }, { 0x01F23, 0x01F2B }, { 0x01F24, 0x01F2C },
+   { 0x01F25, 0x01F2D }, { 0x01F26, 0x01F2E }, { 0x01F27, 0x01F2F },
+   { 0x01F28, 0x01F20 }, { 0x01F29, 0x01F21 }, { 0x01F2A, 0x01F22 },
+   { 0x01F2B, 0x01F23 }, { 0x01F2C, 0x01F24 }, { 0x01F2D, 0x01F25 },
+   { 0x01F2E, 0x01F26 }, { 0x01F2F, 0x01F27 }, { 0x01F30, 0x01F38 },
+   { 0x01F31, 0x01F39 }, { 0x01F32, 0x01F3A }, { 0x01F33, 0x01F3B },
+   { 0x01F34, 0x01F3C }, { 0x01F35, 0x01F3D }, { 0x01F36, 0x01F3E },
+   { 0x01F37, 0x01F3F }, { 0x01F38, 0x01F30 }, { 0x01F39, 0x01F31 },
+   { 0x01F3A, 0x01F32 }, { 0x01F3B, 0x01F33 }, { 0x01F3C, 0x01F34 },
+   { 0x01F3D, 0x01F35 }, { 0x01F3E, 0x01F36 }, { 0x01F3F, 0x01F37 },
+   { 0x01F40, 0x01F48 }, { 0x01F41, 0x01F49 }, { 0x01F42, 0x01F4A },
+   { 0x01F43, 0x01F4B }, { 0x01F44, 0x01F4C }, { 0x01F45, 0x01F4D },
+   { 0x01F48, 0x01F40 }, { 0x01F49, 0x01F41 }, { 0x01F4A, 0x01F42 },
+   { 0x01F4B, 0x01F43 }, { 0x01F4C, 0x01F44 }, { 0x01F4D, 0x01F45 },
+   { 0x01F51, 0x01F59 }, { 0x01F53, 0x01F5B }, { 0x01F55, 0x01F5D },
+   { 0x01F57, 0x01F5F }, { 0x01F59, 0x01F51 }, { 0x01F5B, 0x01F53 },
+   { 0x01F5D, 0x01F55 }, { 0x01F5F, 0x01F57 }, { 0x01F60, 0x01F68 },
+   { 0x01F61, 0x01F69 }, { 0x01F62, 0x01F6A }, { 0x01F63, 0x01F6B },
+   { 0x01F64, 0x01F6C }, { 0x01F65, 0x01F6D }, { 0x01F66, 0x01F6E },
+   { 0x01F67, 0x01F6F }, { 0x01F68, 0x01F60 }, { 0x01F69, 0x01F61 },
+   { 0x01F6A, 0x01F62 }, { 0x01F6B, 0x01F63 }, { 0x01F6C, 0x01F64 },
+   { 0x01F6D, 0x01F65 }, { 0x01F6E, 0x01F66 }, { 0x01F6F, 0x01F67 },
+   { 0x01F70, 0x01FBA }, { 0x01F71, 0x01FBB }, { 0x01F72, 0x01FC8 },
+   { 0x01F73, 0x01FC9 }, { 0x01F74, 0x01FCA }, { 0x01F75, 0x01FCB },
+   { 0x01F76, 0x01FDA }, { 0x01F77, 0x01FDB }, { 0x01F78, 0x01FF8 },
+   { 0x01F79, 0x01FF9 }, { 0x01F7A, 0x01FEA }, { 0x01F7B, 0x01FEB },
+   { 0x01F7C, 0x01FFA }, { 0x01F7D, 0x01FFB }, { 0x01F80, 0x01F88 },
+   { 0x01F81, 0x01F89 }, { 0x01F82, 0x01F8A }, { 0x01F83, 0x01F8B },
+   { 0x01F84, 0x01F8C }, { 0x01F85, 0x01F8D }, { 0x01F86, 0x01F8E },
+   { 0x01F87, 0x01F8F }, { 0x01F88, 0x01F80 }, { 0x01F89, 0x01F81 },
+   { 0x01F8A, 0x01F82 }, { 0x01F8B, 0x01F83 }, { 0x01F8C, 0x01F84 },
+   { 0x01F8D, 0x01F85 }, { 0x01F8E, 0x01F86 }, { 0x01F8F, 0x01F87 },
+   { 0x01F90, 0x01F98 }, { 0x01F91, 0x01F99 }, { 0x01F92, 0x01F9A },
+   { 0x01F93, 0x01F9B }, { 0x01F94, 0x01F9C }, { 0x01F95, 0x01F9D },
+   { 0x01F96, 0x01F9E }, { 0x01F97, 0x01F9F }, { 0x01F98, 0x01F90 },
+   { 0x01F99, 0x01F91 }, { 0x01F9A, 0x01F92 }, { 0x01F9B, 0x01F93 },
+   { 0x01F9C, 0x01F94 }, { 0x01F9D, 0x01F95 }, { 0x01F9E, 0x01F96 },
+   { 0x01F9F, 0x01F97 }, { 0x01FA0, 0x01FA8 }, { 0x01FA1, 0x01FA9 },
+   { 0x01FA2, 0x01FAA }, { 0x01FA3, 0x01FAB }, { 0x01FA4, 0x01FAC },
+   { 0x01FA5, 0x01FAD }, { 0x01FA6, 0x01FAE }, { 0x01FA7, 0x01FAF },
+   { 0x01FA8, 0x01FA0 }, { 0x01FA9, 0x01FA1 }, { 0x01FAA, 0x01FA2 },
+   { 0x01FAB, 0x01FA3 }, { 0x01FAC, 0x01FA4 }, { 0x01FAD, 0x01FA5 },
+   { 0x01FAE, 0x01FA6 }, { 0x01FAF, 0x01FA7 }, { 0x01FB0, 0x01FB8 },
+   { 0x01FB1, 0x01FB9 }, { 0x01FB3, 0x01FBC }, { 0x01FB8, 0x01FB0 },
+   { 0x01FB9, 0x01FB1 }, { 0x01FBA, 0x01F70 }, { 0x01FBB, 0x01F71 },
+   { 0x01FBC, 0x01FB3 }, { 0x01FBE, 0x00345 }, { 0x01FC3, 0x01FCC },
+   { 0x01FC8, 0x01F72 }, { 0x01FC9, 0x01F73 }, { 0x01FCA, 0x01F74 },
+   { 0x01FCB, 0x01F75 }, { 0x01FCC, 0x01FC3 }, { 0x01FD0, 0x01FD8 },
+   { 0x01FD1, 0x01FD9 }, { 0x01FD8, 0x01FD0 }, { 0x01FD9, 0x01FD1 },
+   { 0x01FDA, 0x01F76 }, { 0x01FDB, 0x01F77 }, { 0x01FE0, 0x01FE8 },
+   { 0x01FE1, 0x01FE9 }, { 0x01FE5, 0x01FEC }, { 0x01FE8, 0x01FE0 },
+   { 0x01FE9, 0x01FE1 }, { 0x01FEA, 0x01F7A }, { 0x01FEB, 0x01F7B },
+   { 0x01FEC, 0x01FE5 }, { 0x01FF3, 0x01FFC }, { 0x01FF8, 0x01F78 },
+   { 0x01FF9, 0x01F79 }, { 0x01FFA, 0x01F7C }, { 0x01FFB, 0x01F7D },
+   { 0x01FFC, 0x01FF3 }, { 0x02126, 0x003A9 }, { 0x0212A, 0x0004B },
+   { 0x0212B, 0x000C5 }, { 0x02132, 0x0214E }, { 0x0214E, 0x02132 },
+   { 0x02160, 0x02170 }, { 0x02161, 0x02171 }, { 0x02162, 0x02172 },
+   { 0x02163, 0x02173 }, { 0x02164, 0x02174 }, { 0x02165, 0x02175 },
+   { 0x02166, 0x02176 }, { 0x02167, 0x02177 }, { 0x02168, 0x02178 },
+   { 0x02169, 0x02179 }, { 0x0216A, 0x0217A }, { 0x0216B, 0x0217B },
+   { 0x0216C, 0x0217C }, { 0x0216D, 0x0217D }, { 0x0216E, 0x0217E },
+   { 0x0216F, 0x0217F }, { 0x02170, 0x02160 }, { 0x02171, 0x02161 },
+   { 0x02172, 0x02162 }, { 0x02173, 0x02163 }, { 0x02174, 0x02164 },
+   { 0x02175, 0x02165 }, { 0x02176, 0x02166 }, { 0x02177, 0x02167 },
+   { 0x02178, 0x02168 }, { 0x02179, 0x02169 }, { 0x0217A, 0x0216A },
+   { 0x0217B, 0x0216B }, { 0x0217C, 0x0216C }, { 0x0217D, 0x0216D },
+   { 0x0217E, 0x0216E }, { 0x0217F, 0x0216F }, { 0x02183, 0x02184 },
+   { 0x02184, 0x02183 }, { 0x024B6, 0x024D0 }, { 0x024B7, 0x024D1 },
+   { 0x024B8, 0x024D2 }, { 0x024B9, 0x024D3 }, { 0x024BA, 0x024D4 },
+   { 0x024BB, 0x024D5 }, { 0x024BC, 0x024D6 }, { 0x024BD, 0x024D7 },
+   { 0x024BE, 0x024D8 }, { 0x024BF, 0x024D9 }, { 0x024C0, 0x024DA },
+   { 0x024C1, 0x024DB }, { 0x024C2, 0x024DC }, { 0x024C3, 0x024DD },
+   { 0x024C4, 0x024DE }, { 0x024C5, 0x024DF }, { 0x024C6, 0x024E0 },
+   { 0x024C7, 0x024E1 }, { 0x024C8, 0x024E2 }, { 0x024C9, 0x024E3 },
+   { 0x024CA, 0x024E4 }, { 0x024CB, 0x024E5 }, { 0x024CC, 0x024E6 },
+   { 0x024CD, 0x024E7 }, { 0x024CE, 0x024E8 }, { 0x024CF, 0x024E9 },
+   { 0x024D0, 0x024B6 }, { 0x024D1, 0x024B7 }, { 0x024D2, 0x024B8 },
+   { 0x024D3, 0x024B9 }, { 0x024D4, 0x024BA }, { 0x024D5, 0x024BB },
+   { 0x024D6, 0x024BC }, { 0x024D7, 0x024BD }, { 0x024D8, 0x024BE },
+   { 0x024D9, 0x024BF }, { 0x024DA, 0x024C0 }, { 0x024DB, 0x024C1 },
+   { 0x024DC, 0x024C2 }, { 0x024DD, 0x024C3 }, { 0x024DE, 0x024C4 },
+   { 0x024DF, 0x024C5 }, { 0x024E0, 0x024C6 }, { 0x024E1, 0x024C7 },
+   { 0x024E2, 0x024C8 }, { 0x024E3, 0x024C9 }, { 0x024E4, 0x024CA },
+   { 0x024E5, 0x024CB }, { 0x024E6, 0x024CC }, { 0x024E7, 0x024CD },
+   { 0x024E8, 0x024CE }, { 0x024E9, 0x024CF }, { 0x02C00, 0x02C30 },
+   { 0x02C01, 0x02C31 }, { 0x02C02, 0x02C32 }, { 0x02C03, 0x02C33 },
+   { 0x02C04, 0x02C34 }, { 0x02C05, 0x02C35 }, { 0x02C06, 0x02C36 },
+   { 0x02C07, 0x02C37 }, { 0x02C08, 0x02C38 }, { 0x02C09, 0x02C39 },
+   { 0x02C0A, 0x02C3A }, { 0x02C0B, 0x02C3B }, { 0x02C0C, 0x02C3C },
+   { 0x02C0D, 0x02C3D }, { 0x02C0E, 0x02C3E }, { 0x02C0F, 0x02C3F },
+   { 0x02C10, 0x02C40 }, { 0x02C11, 0x02C41 }, { 0x02C12, 0x02C42 },
+   { 0x02C13, 0x02C43 }, { 0x02C14, 0x02C44 }, { 0x02C15, 0x02C45 },
+   { 0x02C16, 0x02C46 }, { 0x02C17, 0x02C47 }, { 0x02C18, 0x02C48 },
+   { 0x02C19, 0x02C49 }, { 0x02C1A, 0x02C4A }, { 0x02C1B, 0x02C4B },
+   { 0x02C1C, 0x02C4C }, { 0x02C1D, 0x02C4D }, { 0x02C1E, 0x02C4E },
+   { 0x02C1F, 0x02C4F }, { 0x02C20, 0x02C50 }, { 0x02C21, 0x02C51 },
+   { 0x02C22, 0x02C52 }, { 0x02C23, 0x02C53 }, { 0x02C24, 0x02C54 },
+   { 0x02C25, 0x02C55 }, { 0x02C26, 0x02C56 }, { 0x02C27, 0x02C57 },
+   { 0x02C28, 0x02C58 }, { 0x02C29, 0x02C59 }, { 0x02C2A, 0x02C5A },
+   { 0x02C2B, 0x02C5B }, { 0x02C2C, 0x02C5C }, { 0x02C2D, 0x02C5D },
+   { 0x02C2E, 0x02C5E }, { 0x02C2F, 0x02C5F }, { 0x02C30, 0x02C00 },
+   { 0x02C31, 0x02C01 }, { 0x02C32, 0x02C02 }, { 0x02C33, 0x02C03 },
+   { 0x02C34, 0x02C04 }, { 0x02C35, 0x02C05 }, { 0x02C36, 0x02C06 },
+   { 0x02C37, 0x02C07 }, { 0x02C38, 0x02C08 }, { 0x02C39, 0x02C09 },
+   { 0x02C3A, 0x02C0A }, { 0x02C3B, 0x02C0B }, { 0x02C3C, 0x02C0C },
+   { 0x02C3D, 0x02C0D }, { 0x02C3E, 0x02C0E }, { 0x02C3F, 0x02C0F },
+   { 0x02C40, 0x02C10 }, { 0x02C41, 0x02C11 }, { 0x02C42, 0x02C12 },
+   { 0x02C43, 0x02C13 }, { 0x02C44, 0x02C14 }, { 0x02C45, 0x02C15 },
+   { 0x02C46, 0x02C16 }, { 0x02C47, 0x02C17 }, { 0x02C48, 0x02C18 },
+   { 0x02C49, 0x02C19 }, { 0x02C4A, 0x02C1A }, { 0x02C4B, 0x02C1B },
+   { 0x02C4C, 0x02C1C }, { 0x02C4D, 0x02C1D }, { 0x02C4E, 0x02C1E },
+   { 0x02C4F, 0x02C1F }, { 0x02C50, 0x02C20 }, { 0x02C51, 0x02C21 },
+   { 0x02C52, 0x02C22 }, { 0x02C53, 0x02C23 }, { 0x02C54, 0x02C24 },
+   { 0x02C55, 0x02C25 }, { 0x02C56, 0x02C26 }, { 0x02C57, 0x02C27 },
+   { 0x02C58, 0x02C28 }, { 0x02C59, 0x02C29 }, { 0x02C5A, 0x02C2A },
+   { 0x02C5B, 0x02C2B }, { 0x02C5C, 0x02C2C }, { 0x02C5D, 0x02C2D },
+   { 0x02C5E, 0x02C2E }, { 0x02C5F, 0x02C2F }, { 0x02C60, 0x02C61 },
+   { 0x02C61, 0x02C60 }, { 0x02C62, 0x0026B }, { 0x02C63, 0x01D7D },
+   { 0x02C64, 0x0027D }, { 0x02C65, 0x0023A }, { 0x02C66, 0x0023E },
+   { 0x02C67, 0x02C68 }, { 0x02C68, 0x02C67 }, { 0x02C69, 0x02C6A },
+   { 0x02C6A, 0x02C69 }, { 0x02C6B, 0x02C6C }, { 0x02C6C, 0x02C6B },
+   { 0x02C6D, 0x00251 }, { 0x02C6E, 0x00271 }, { 0x02C6F, 0x00250 },
+   { 0x02C70, 0x00252 }, { 0x02C72, 0x02C73 }, { 0x02C73, 0x02C72 },
+   { 0x02C75, 0x02C76 }, { 0x02C76, 0x02C75 }, { 0x02C7E, 0x0023F },
+   { 0x02C7F, 0x00240 }, { 0x02C80, 0x02C81 }, { 0x02C81, 0x02C80 },
+   { 0x02C82, 0x02C83 }, { 0x02C83, 0x02C82 }, { 0x02C84, 0x02C85 },
+   { 0x02C85, 0x02C84 }, { 0x02C86, 0x02C87 }, { 0x02C87, 0x02C86 },
+   { 0x02C88, 0x02C89 }, { 0x02C89, 0x02C88 }, { 0x02C8A, 0x02C8B },
+   { 0x02C8B, 0x02C8A }, { 0x02C8C, 0x02C8D }, { 0x02C8D, 0x02C8C },
+   { 0x02C8E, 0x02C8F }, { 0x02C8F, 0x02C8E }, { 0x02C90, 0x02C91 },
+   { 0x02C91, 0x02C90 }, { 0x02C92, 0x02C93 }, { 0x02C93, 0x02C92 },
+   { 0x02C94, 0x02C95 }, { 0x02C95, 0x02C94 }, { 0x02C96, 0x02C97 },
+   { 0x02C97, 0x02C96 }, { 0x02C98, 0x02C99 }, { 0x02C99, 0x02C98 },
+   { 0x02C9A, 0x02C9B }, { 0x02C9B, 0x02C9A }, { 0x02C9C, 0x02C9D },
+   { 0x02C9D, 0x02C9C }, { 0x02C9E, 0x02C9F }, { 0x02C9F, 0x02C9E },
+   { 0x02CA0, 0x02CA1 }, { 0x02CA1, 0x02CA0 }, { 0x02CA2, 0x02CA3 },
+   { 0x02CA3, 0x02CA2 }, { 0x02CA4, 0x02CA5 }, { 0x02CA5, 0x02CA4 },
+   { 0x02CA6, 0x02CA7 }, { 0x02CA7, 0x02CA6 }, { 0x02CA8, 0x02CA9 },
+   { 0x02CA9, 0x02CA8 }, { 0x02CAA, 0x02CAB }, { 0x02CAB, 0x02CAA },
+   { 0x02CAC, 0x02CAD }, { 0x02CAD, 0x02CAC }, { 0x02CAE, 0x02CAF },
+   { 0x02CAF, 0x02CAE }, { 0x02CB0, 0x02CB1 }, { 0x02CB1, 0x02CB0 },
+   { 0x02CB2, 0x02CB3 }, { 0x02CB3, 0x02CB2 }, { 0x02CB4, 0x02CB5 },
+   { 0x02CB5, 0x02CB4 }, { 0x02CB6, 0x02CB7 }, { 0x02CB7, 0x02CB6 },
+   { 0x02CB8, 0x02CB9 }, { 0x02CB9, 0x02CB8 }, { 0x02CBA, 0x02CBB },
+   { 0x02CBB, 0x02CBA }, { 0x02CBC, 0x02CBD }, { 0x02CBD, 0x02CBC },
+   { 0x02CBE, 0x02CBF }, { 0x02CBF, 0x02CBE }, { 0x02CC0, 0x02CC1 },
+   { 0x02CC1, 0x02CC0 }, { 0x02CC2, 0x02CC3 }, { 0x02CC3, 0x02CC2 },
+   { 0x02CC4, 0x02CC5 }, { 0x02CC5, 0x02CC4 }, { 0x02CC6, 0x02CC7 },
+   { 0x02CC7, 0x02CC6 }, { 0x02CC8, 0x02CC9 }, { 0x02CC9, 0x02CC8 },
+   { 0x02CCA, 0x02CCB }, { 0x02CCB, 0x02CCA }, { 0x02CCC, 0x02CCD },
+   { 0x02CCD, 0x02CCC }, { 0x02CCE, 0x02CCF }, { 0x02CCF, 0x02CCE },
+   { 0x02CD0, 0x02CD1 }, { 0x02CD1, 0x02CD0 }, { 0x02CD2, 0x02CD3 },
+   { 0x02CD3, 0x02CD2 }, { 0x02CD4, 0x02CD5 }, { 0x02CD5, 0x02CD4 },
+   { 0x02CD6, 0x02CD7 }, { 0x02CD7, 0x02CD6 }, { 0x02CD8, 0x02CD9 },
+   { 0x02CD9, 0x02CD8 }, { 0x02CDA, 0x02CDB }, { 0x02CDB, 0x02CDA },
+   { 0x02CDC, 0x02CDD }, { 0x02CDD, 0x02CDC }, { 0x02CDE, 0x02CDF },
+   { 0x02CDF, 0x02CDE }, { 0x02CE0, 0x02CE1 }, { 0x02CE1, 0x02CE0 },
+   { 0x02CE2, 0x02CE3 }, { 0x02CE3, 0x02CE2 }, { 0x02CEB, 0x02CEC },
+   { 0x02CEC, 0x02CEB }, { 0x02CED, 0x02CEE }, { 0x02CEE, 0x02CED },
+   { 0x02CF2, 0x02CF3 }, { 0x02CF3, 0x02CF2 }, { 0x02D00, 0x010A0 },
+   { 0x02D01, 0x010A1 }, { 0x02D02, 0x010A2 }, { 0x02D03, 0x010A3 },
+   { 0x02D04, 0x010A4 }, { 0x02D05, 0x010A5 }, { 0x02D06, 0x010A6 },
+   { 0x02D07, 0x010A7 }, { 0x02D08, 0x010A8 }, { 0x02D09, 0x010A9 },
+   { 0x02D0A, 0x010AA }, { 0x02D0B, 0x010AB }, { 0x02D0C, 0x010AC },
+   { 0x02D0D, 0x010AD }, { 0x02D0E, 0x010AE }, { 0x02D0F, 0x010AF },
+   { 0x02D10, 0x010B0 }, { 0x02D11, 0x010B1 }, { 0x02D12, 0x010B2 },
+   { 0x02D13, 0x010B3 }, { 0x02D14, 0x010B4 }, { 0x02D15, 0x010B5 },
+   { 0x02D16, 0x010B6 }, { 0x02D17, 0x010B7 }, { 0x02D18, 0x010B8 },
+   { 0x02D19, 0x010B9 }, { 0x02D1A, 0x010BA }, { 0x02D1B, 0x010BB },
+   { 0x02D1C, 0x010BC }, { 0x02D1D, 0x010BD }, { 0x02D1E, 0x010BE },
+   { 0x02D1F, 0x010BF }, { 0x02D20, 0x010C0 }, { 0x02D21, 0x010C1 },
+   { 0x02D22, 0x010C2 }, { 0x02D23, 0x010C3 }, { 0x02D24, 0x010C4 },
+   { 0x02D25, 0x010C5 }, { 0x02D27, 0x010C7 }, { 0x02D2D, 0x010CD },
+   { 0x0A640, 0x0A641 }, { 0x0A641, 0x0A640 }, { 0x0A642, 0x0A643 },
+   { 0x0A643, 0x0A642 }, { 0x0A644, 0x0A645 }, { 0x0A645, 0x0A644 },
+   { 0x0A646, 0x0A647 }, { 0x0A647, 0x0A646 }, { 0x0A648, 0x0A649 },
+   { 0x0A649, 0x0A648 }, { 0x0A64A, 0x0A64B }, { 0x0A64B, 0x01C88 },
+   { 0x0A64C, 0x0A64D }, { 0x0A64D, 0x0A64C }, { 0x0A64E, 0x0A64F },
+   { 0x0A64F, 0x0A64E }, { 0x0A650, 0x0A651 }, { 0x0A651, 0x0A650 },
+   { 0x0A652, 0x0A653 }, { 0x0A653, 0x0A652 }, { 0x0A654, 0x0A655 },
+   { 0x0A655, 0x0A654 }, { 0x0A656, 0x0A657 }, { 0x0A657, 0x0A656 },
+   { 0x0A658, 0x0A659 }, { 0x0A659, 0x0A658 }, { 0x0A65A, 0x0A65B },
+   { 0x0A65B, 0x0A65A }, { 0x0A65C, 0x0A65D }, { 0x0A65D, 0x0A65C },
+   { 0x0A65E, 0x0A65F }, { 0x0A65F, 0x0A65E }, { 0x0A660, 0x0A661 },
+   { 0x0A661, 0x0A660 }, { 0x0A662, 0x0A663 }, { 0x0A663, 0x0A662 },
+   { 0x0A664, 0x0A665 }, { 0x0A665, 0x0A664 }, { 0x0A666, 0x0A667 },
+   { 0x0A667, 0x0A666 }, { 0x0A668, 0x0A669 }, { 0x0A669, 0x0A668 },
+   { 0x0A66A, 0x0A66B }, { 0x0A66B, 0x0A66A }, { 0x0A66C, 0x0A66D },
+   { 0x0A66D, 0x0A66C }, { 0x0A680, 0x0A681 }, { 0x0A681, 0x0A680 },
+   { 0x0A682, 0x0A683 }, { 0x0A683, 0x0A682 }, { 0x0A684, 0x0A685 },
+   { 0x0A685, 0x0A684 }, { 0x0A686, 0x0A687 }, { 0x0A687, 0x0A686 },
+   { 0x0A688, 0x0A689 }, { 0x0A689, 0x0A688 }, { 0x0A68A, 0x0A68B },
+   { 0x0A68B, 0x0A68A }, { 0x0A68C, 0x0A68D }, { 0x0A68D, 0x0A68C },
+   { 0x0A68E, 0x0A68F }, { 0x0A68F, 0x0A68E }, { 0x0A690, 0x0A691 },
+   { 0x0A691, 0x0A690 }, { 0x0A692, 0x0A693 }, { 0x0A693, 0x0A692 },
+   { 0x0A694, 0x0A695 }, { 0x0A695, 0x0A694 }, { 0x0A696, 0x0A697 },
+   { 0x0A697, 0x0A696 }, { 0x0A698, 0x0A699 }, { 0x0A699, 0x0A698 },
+   { 0x0A69A, 0x0A69B }, { 0x0A69B, 0x0A69A }, { 0x0A722, 0x0A723 },
+   { 0x0A723, 0x0A722 }, { 0x0A724, 0x0A725 }, { 0x0A725, 0x0A724 },
+   { 0x0A726, 0x0A727 }, { 0x0A727, 0x0A726 }, { 0x0A728, 0x0A729 },
+   { 0x0A729, 0x0A728 }, { 0x0A72A, 0x0A72B }, { 0x0A72B, 0x0A72A },
+   { 0x0A72C, 0x0A72D }, { 0x0A72D, 0x0A72C }, { 0x0A72E, 0x0A72F },
+   { 0x0A72F, 0x0A72E }, { 0x0A732, 0x0A733 }, { 0x0A733, 0x0A732 },
+   { 0x0A734, 0x0A735 }, { 0x0A735, 0x0A734 }, { 0x0A736, 0x0A737 },
+   { 0x0A737, 0x0A736 }, { 0x0A738, 0x0A739 }, { 0x0A739, 0x0A738 },
+   { 0x0A73A, 0x0A73B }, { 0x0A73B, 0x0A73A }, { 0x0A73C, 0x0A73D },
+   { 0x0A73D, 0x0A73C }, { 0x0A73E, 0x0A73F }, { 0x0A73F, 0x0A73E },
+   { 0x0A740, 0x0A741 }, { 0x0A741, 0x0A740 }, { 0x0A742, 0x0A743 },
+   { 0x0A743, 0x0A742 }, { 0x0A744, 0x0A745 }, { 0x0A745, 0x0A744 },
+   { 0x0A746, 0x0A747 }, { 0x0A747, 0x0A746 }, { 0x0A748, 0x0A749 },
+   { 0x0A749, 0x0A748 }, { 0x0A74A, 0x0A74B }, { 0x0A74B, 0x0A74A },
+   { 0x0A74C, 0x0A74D }, { 0x0A74D, 0x0A74C }, { 0x0A74E, 0x0A74F },
+   { 0x0A74F, 0x0A74E }, { 0x0A750, 0x0A751 }, { 0x0A751, 0x0A750 },
+   { 0x0A752, 0x0A753 }, { 0x0A753, 0x0A752 }, { 0x0A754, 0x0A755 },
+   { 0x0A755, 0x0A754 }, { 0x0A756, 0x0A757 }, { 0x0A757, 0x0A756 },
+   { 0x0A758, 0x0A759 }, { 0x0A759, 0x0A758 }, { 0x0A75A, 0x0A75B },
+   { 0x0A75B, 0x0A75A }, { 0x0A75C, 0x0A75D }, { 0x0A75D, 0x0A75C },
+   { 0x0A75E, 0x0A75F }, { 0x0A75F, 0x0A75E }, { 0x0A760, 0x0A761 },
+   { 0x0A761, 0x0A760 }, { 0x0A762, 0x0A763 }, { 0x0A763, 0x0A762 },
+   { 0x0A764, 0x0A765 }, { 0x0A765, 0x0A764 }, { 0x0A766, 0x0A767 },
+   { 0x0A767, 0x0A766 }, { 0x0A768, 0x0A769 }, { 0x0A769, 0x0A768 },
+   { 0x0A76A, 0x0A76B }, { 0x0A76B, 0x0A76A }, { 0x0A76C, 0x0A76D },
+   { 0x0A76D, 0x0A76C }, { 0x0A76E, 0x0A76F }, { 0x0A76F, 0x0A76E },
+   { 0x0A779, 0x0A77A }, { 0x0A77A, 0x0A779 }, { 0x0A77B, 0x0A77C },
+   { 0x0A77C, 0x0A77B }, { 0x0A77D, 0x01D79 }, { 0x0A77E, 0x0A77F },
+   { 0x0A77F, 0x0A77E }, { 0x0A780, 0x0A781 }, { 0x0A781, 0x0A780 },
+   { 0x0A782, 0x0A783 }, { 0x0A783, 0x0A782 }, { 0x0A784, 0x0A785 },
+   { 0x0A785, 0x0A784 }, { 0x0A786, 0x0A787 }, { 0x0A787, 0x0A786 },
+   { 0x0A78B, 0x0A78C }, { 0x0A78C, 0x0A78B }, { 0x0A78D, 0x00265 },
+   { 0x0A790, 0x0A791 }, { 0x0A791, 0x0A790 }, { 0x0A792, 0x0A793 },
+   { 0x0A793, 0x0A792 }, { 0x0A794, 0x0A7C4 }, { 0x0A796, 0x0A797 },
+   { 0x0A797, 0x0A796 }, { 0x0A798, 0x0A799 }, { 0x0A799, 0x0A798 },
+   { 0x0A79A, 0x0A79B }, { 0x0A79B, 0x0A79A }, { 0x0A79C, 0x0A79D },
+   { 0x0A79D, 0x0A79C }, { 0x0A79E, 0x0A79F }, { 0x0A79F, 0x0A79E },
+   { 0x0A7A0, 0x0A7A1 }, { 0x0A7A1, 0x0A7A0 }, { 0x0A7A2, 0x0A7A3 },
+   { 0x0A7A3, 0x0A7A2 }, { 0x0A7A4, 0x0A7A5 }, { 0x0A7A5, 0x0A7A4 },
+   { 0x0A7A6, 0x0A7A7 }, { 0x0A7A7, 0x0A7A6 }, { 0x0A7A8, 0x0A7A9 },
+   { 0x0A7A9, 0x0A7A8 }, { 0x0A7AA, 0x00266 }, { 0x0A7AB, 0x0025C },
+   { 0x0A7AC, 0x00261 }, { 0x0A7AD, 0x0026C }, { 0x0A7AE, 0x0026A },
+   { 0x0A7B0, 0x0029E }, { 0x0A7B1, 0x00287 }, { 0x0A7B2, 0x0029D },
+   { 0x0A7B3, 0x0AB53 }, { 0x0A7B4, 0x0A7B5 }, { 0x0A7B5, 0x0A7B4 },
+   { 0x0A7B6, 0x0A7B7 }, { 0x0A7B7, 0x0A7B6 }, { 0x0A7B8, 0x0A7B9 },
+   { 0x0A7B9, 0x0A7B8 }, { 0x0A7BA, 0x0A7BB }, { 0x0A7BB, 0x0A7BA },
+   { 0x0A7BC, 0x0A7BD }, { 0x0A7BD, 0x0A7BC }, { 0x0A7BE, 0x0A7BF },
+   { 0x0A7BF, 0x0A7BE }, { 0x0A7C0, 0x0A7C1 }, { 0x0A7C1, 0x0A7C0 },
+   { 0x0A7C2, 0x0A7C3 }, { 0x0A7C3, 0x0A7C2 }, { 0x0A7C4, 0x0A794 },
+   { 0x0A7C5, 0x00282 }, { 0x0A7C6, 0x01D8E }, { 0x0A7C7, 0x0A7C8 },
+   { 0x0A7C8, 0x0A7C7 }, { 0x0A7C9, 0x0A7CA }, { 0x0A7CA, 0x0A7C9 },
+   { 0x0A7D0, 0x0A7D1 }, { 0x0A7D1, 0x0A7D0 }, { 0x0A7D6, 0x0A7D7 },
+   { 0x0A7D7, 0x0A7D6 }, { 0x0A7D8, 0x0A7D9 }, { 0x0A7D9, 0x0A7D8 },
+   { 0x0A7F5, 0x0A7F6 }, { 0x0A7F6, 0x0A7F5 }, { 0x0AB53, 0x0A7B3 },
+   { 0x0AB70, 0x013A0 }, { 0x0AB71, 0x013A1 }, { 0x0AB72, 0x013A2 },
+   { 0x0AB73, 0x013A3 }, { 0x0AB74, 0x013A4 }, { 0x0AB75, 0x013A5 },
+   { 0x0AB76, 0x013A6 }, { 0x0AB77, 0x013A7 }, { 0x0AB78, 0x013A8 },
+   { 0x0AB79, 0x013A9 }, { 0x0AB7A, 0x013AA }, { 0x0AB7B, 0x013AB },
+   { 0x0AB7C, 0x013AC }, { 0x0AB7D, 0x013AD }, { 0x0AB7E, 0x013AE },
+   { 0x0AB7F, 0x013AF }, { 0x0AB80, 0x013B0 }, { 0x0AB81, 0x013B1 },
+   { 0x0AB82, 0x013B2 }, { 0x0AB83, 0x013B3 }, { 0x0AB84, 0x013B4 },
+   { 0x0AB85, 0x013B5 }, { 0x0AB86, 0x013B6 }, { 0x0AB87, 0x013B7 },
+   { 0x0AB88, 0x013B8 }, { 0x0AB89, 0x013B9 }, { 0x0AB8A, 0x013BA },
+   { 0x0AB8B, 0x013BB }, { 0x0AB8C, 0x013BC }, { 0x0AB8D, 0x013BD },
+   { 0x0AB8E, 0x013BE }, { 0x0AB8F, 0x013BF }, { 0x0AB90, 0x013C0 },
+   { 0x0AB91, 0x013C1 }, { 0x0AB92, 0x013C2 }, { 0x0AB93, 0x013C3 },
+   { 0x0AB94, 0x013C4 }, { 0x0AB95, 0x013C5 }, { 0x0AB96, 0x013C6 },
+   { 0x0AB97, 0x013C7 }, { 0x0AB98, 0x013C8 }, { 0x0AB99, 0x013C9 },
+   { 0x0AB9A, 0x013CA }, { 0x0AB9B, 0x013CB }, { 0x0AB9C, 0x013CC },
+   { 0x0AB9D, 0x013CD }, { 0x0AB9E, 0x013CE }, { 0x0AB9F, 0x013CF },
+   { 0x0ABA0, 0x013D0 }, { 0x0ABA1, 0x013D1 }, { 0x0ABA2, 0x013D2 },
+   { 0x0ABA3, 0x013D3 }, { 0x0ABA4, 0x013D4 }, { 0x0ABA5, 0x013D5 },
+   { 0x0ABA6, 0x013D6 }, { 0x0ABA7, 0x013D7 }, { 0x0ABA8, 0x013D8 },
+   { 0x0ABA9, 0x013D9 }, { 0x0ABAA, 0x013DA }, { 0x0ABAB, 0x013DB },
+   { 0x0ABAC, 0x013DC }, { 0x0ABAD, 0x013DD }, { 0x0ABAE, 0x013DE },
+   { 0x0ABAF, 0x013DF }, { 0x0ABB0, 0x013E0 }, { 0x0ABB1, 0x013E1 },
+   { 0x0ABB2, 0x013E2 }, { 0x0ABB3, 0x013E3 }, { 0x0ABB4, 0x013E4 },
+   { 0x0ABB5, 0x013E5 }, { 0x0ABB6, 0x013E6 }, { 0x0ABB7, 0x013E7 },
+   { 0x0ABB8, 0x013E8 }, { 0x0ABB9, 0x013E9 }, { 0x0ABBA, 0x013EA },
+   { 0x0ABBB, 0x013EB }, { 0x0ABBC, 0x013EC }, { 0x0ABBD, 0x013ED },
+   { 0x0ABBE, 0x013EE }, { 0x0ABBF, 0x013EF }, { 0x0FF21, 0x0FF41 },
+   { 0x0FF22, 0x0FF42 }, { 0x0FF23, 0x0FF43 }, { 0x0FF24, 0x0FF44 },
+   { 0x0FF25, 0x0FF45 }, { 0x0FF26, 0x0FF46 }, { 0x0FF27, 0x0FF47 },
+   { 0x0FF28, 0x0FF48 }, { 0x0FF29, 0x0FF49 }, { 0x0FF2A, 0x0FF4A },
+   { 0x0FF2B, 0x0FF4B }, { 0x0FF2C, 0x0FF4C }, { 0x0FF2D, 0x0FF4D },
+   { 0x0FF2E, 0x0FF4E }, { 0x0FF2F, 0x0FF4F }, { 0x0FF30, 0x0FF50 },
+   { 0x0FF31, 0x0FF51 }, { 0x0FF32, 0x0FF52 }, { 0x0FF33, 0x0FF53 },
+   { 0x0FF34, 0x0FF54 }, { 0x0FF35, 0x0FF55 }, { 0x0FF36, 0x0FF56 },
+   { 0x0FF37, 0x0FF57 }, { 0x0FF38, 0x0FF58 }, { 0x0FF39, 0x0FF59 },
+   { 0x0FF3A, 0x0FF5A }, { 0x0FF41, 0x0FF21 }, { 0x0FF42, 0x0FF22 },
+   { 0x0FF43, 0x0FF23 }, { 0x0FF44, 0x0FF24 }, { 0x0FF45, 0x0FF25 },
+   { 0x0FF46, 0x0FF26 }, { 0x0FF47, 0x0FF27 }, { 0x0FF48, 0x0FF28 },
+   { 0x0FF49, 0x0FF29 }, { 0x0FF4A, 0x0FF2A }, { 0x0FF4B, 0x0FF2B },
+   { 0x0FF4C, 0x0FF2C }, { 0x0FF4D, 0x0FF2D }, { 0x0FF4E, 0x0FF2E },
+   { 0x0FF4F, 0x0FF2F }, { 0x0FF50, 0x0FF30 }, { 0x0FF51, 0x0FF31 },
+   { 0x0FF52, 0x0FF32 }, { 0x0FF53, 0x0FF33 }, { 0x0FF54, 0x0FF34 },
+   { 0x0FF55, 0x0FF35 }, { 0x0FF56, 0x0FF36 }, { 0x0FF57, 0x0FF37 },
+   { 0x0FF58, 0x0FF38 }, { 0x0FF59, 0x0FF39 }, { 0x0FF5A, 0x0FF3A },
+   { 0x10400, 0x10428 }, { 0x10401, 0x10429 }, { 0x10402, 0x1042A },
+   { 0x10403, 0x1042B }, { 0x10404, 0x1042C }, { 0x10405, 0x1042D },
+   { 0x10406, 0x1042E }, { 0x10407, 0x1042F }, { 0x10408, 0x10430 },
+   { 0x10409, 0x10431 }, { 0x1040A, 0x10432 }, { 0x1040B, 0x10433 },
+   { 0x1040C, 0x10434 }, { 0x1040D, 0x10435 }, { 0x1040E, 0x10436 },
+   { 0x1040F, 0x10437 }, { 0x10410, 0x10438 }, { 0x10411, 0x10439 },
+   { 0x10412, 0x1043A }, { 0x10413, 0x1043B }, { 0x10414, 0x1043C },
+   { 0x10415, 0x1043D }, { 0x10416, 0x1043E }, { 0x10417, 0x1043F },
+   { 0x10418, 0x10440 }, { 0x10419, 0x10441 }, { 0x1041A, 0x10442 },
+   { 0x1041B, 0x10443 }, { 0x1041C, 0x10444 }, { 0x1041D, 0x10445 },
+   { 0x1041E, 0x10446 }, { 0x1041F, 0x10447 }, { 0x10420, 0x10448 },
+   { 0x10421, 0x10449 }, { 0x10422, 0x1044A }, { 0x10423, 0x1044B },
+   { 0x10424, 0x1044C }, { 0x10425, 0x1044D }, { 0x10426, 0x1044E },
+   { 0x10427, 0x1044F }, { 0x10428, 0x10400 }, { 0x10429, 0x10401 },
+   { 0x1042A, 0x10402 }, { 0x1042B, 0x10403 }, { 0x1042C, 0x10404 },
+   { 0x1042D, 0x10405 }, { 0x1042E, 0x10406 }, { 0x1042F, 0x10407 },
+   { 0x10430, 0x10408 }, { 0x10431, 0x10409 }, { 0x10432, 0x1040A },
+   { 0x10433, 0x1040B }, { 0x10434, 0x1040C }, { 0x10435, 0x1040D },
+   { 0x10436, 0x1040E }, { 0x10437, 0x1040F }, { 0x10438, 0x10410 },
+   { 0x10439, 0x10411 }, { 0x1043A, 0x10412 }, { 0x1043B, 0x10413 },
+   { 0x1043C, 0x10414 }, { 0x1043D, 0x10415 }, { 0x1043E, 0x10416 },
+   { 0x1043F, 0x10417 }, { 0x10440, 0x10418 }, { 0x10441, 0x10419 },
+   { 0x10442, 0x1041A }, { 0x10443, 0x1041B }, { 0x10444, 0x1041C },
+   { 0x10445, 0x1041D }, { 0x10446, 0x1041E }, { 0x10447, 0x1041F },
+   { 0x10448, 0x10420 }, { 0x10449, 0x10421 }, { 0x1044A, 0x10422 },
+   { 0x1044B, 0x10423 }, { 0x1044C, 0x10424 }, { 0x1044D, 0x10425 },
+   { 0x1044E, 0x10426 }, { 0x1044F, 0x10427 }, { 0x104B0, 0x104D8 },
+   { 0x104B1, 0x104D9 }, { 0x104B2, 0x104DA }, { 0x104B3, 0x104DB },
+   { 0x104B4, 0x104DC }, { 0x104B5, 0x104DD }, { 0x104B6, 0x104DE },
+   { 0x104B7, 0x104DF }, { 0x104B8, 0x104E0 }, { 0x104B9, 0x104E1 },
+   { 0x104BA, 0x104E2 }, { 0x104BB, 0x104E3 }, { 0x104BC, 0x104E4 },
+   { 0x104BD, 0x104E5 }, { 0x104BE, 0x104E6 }, { 0x104BF, 0x104E7 },
+   { 0x104C0, 0x104E8 }, { 0x104C1, 0x104E9 }, { 0x104C2, 0x104EA },
+   { 0x104C3, 0x104EB }, { 0x104C4, 0x104EC }, { 0x104C5, 0x104ED },
+   { 0x104C6, 0x104EE }, { 0x104C7, 0x104EF }, { 0x104C8, 0x104F0 },
+   { 0x104C9, 0x104F1 }, { 0x104CA, 0x104F2 }, { 0x104CB, 0x104F3 },
+   { 0x104CC, 0x104F4 }, { 0x104CD, 0x104F5 }, { 0x104CE, 0x104F6 },
+   { 0x104CF, 0x104F7 }, { 0x104D0, 0x104F8 }, { 0x104D1, 0x104F9 },
+   { 0x104D2, 0x104FA }, { 0x104D3, 0x104FB }, { 0x104D8, 0x104B0 },
+   { 0x104D9, 0x104B1 }, { 0x104DA, 0x104B2 }, { 0x104DB, 0x104B3 },
+   { 0x104DC, 0x104B4 }, { 0x104DD, 0x104B5 }, { 0x104DE, 0x104B6 },
+   { 0x104DF, 0x104B7 }, { 0x104E0, 0x104B8 }, { 0x104E1, 0x104B9 },
+   { 0x104E2, 0x104BA }, { 0x104E3, 0x104BB }, { 0x104E4, 0x104BC },
+   { 0x104E5, 0x104BD }, { 0x104E6, 0x104BE }, { 0x104E7, 0x104BF },
+   { 0x104E8, 0x104C0 }, { 0x104E9, 0x104C1 }, { 0x104EA, 0x104C2 },
+   { 0x104EB, 0x104C3 }, { 0x104EC, 0x104C4 }, { 0x104ED, 0x104C5 },
+   { 0x104EE, 0x104C6 }, { 0x104EF, 0x104C7 }, { 0x104F0, 0x104C8 },
+   { 0x104F1, 0x104C9 }, { 0x104F2, 0x104CA }, { 0x104F3, 0x104CB },
+   { 0x104F4, 0x104CC }, { 0x104F5, 0x104CD }, { 0x104F6, 0x104CE },
+   { 0x104F7, 0x104CF }, { 0x104F8, 0x104D0 }, { 0x104F9, 0x104D1 },
+   { 0x104FA, 0x104D2 }, { 0x104FB, 0x104D3 }, { 0x10570, 0x10597 },
+   { 0x10571, 0x10598 }, { 0x10572, 0x10599 }, { 0x10573, 0x1059A },
+   { 0x10574, 0x1059B }, { 0x10575, 0x1059C }, { 0x10576, 0x1059D },
+   { 0x10577, 0x1059E }, { 0x10578, 0x1059F }, { 0x10579, 0x105A0 },
+   { 0x1057A, 0x105A1 }, { 0x1057C, 0x105A3 }, { 0x1057D, 0x105A4 },
+   { 0x1057E, 0x105A5 }, { 0x1057F, 0x105A6 }, { 0x10580, 0x105A7 },
+   { 0x10581, 0x105A8 }, { 0x10582, 0x105A9 }, { 0x10583, 0x105AA },
+   { 0x10584, 0x105AB }, { 0x10585, 0x105AC }, { 0x10586, 0x105AD },
+   { 0x10587, 0x105AE }, { 0x10588, 0x105AF }, { 0x10589, 0x105B0 },
+   { 0x1058A, 0x105B1 }, { 0x1058C, 0x105B3 }, { 0x1058D, 0x105B4 },
+   { 0x1058E, 0x105B5 }, { 0x1058F, 0x105B6 }, { 0x10590, 0x105B7 },
+   { 0x10591, 0x105B8 }, { 0x10592, 0x105B9 }, { 0x10594, 0x105BB },
+   { 0x10595, 0x105BC }, { 0x10597, 0x10570 }, { 0x10598, 0x10571 },
+   { 0x10599, 0x10572 }, { 0x1059A, 0x10573 }, { 0x1059B, 0x10574 },
+   { 0x1059C, 0x10575 }, { 0x1059D, 0x10576 }, { 0x1059E, 0x10577 },
+   { 0x1059F, 0x10578 }, { 0x105A0, 0x10579 }, { 0x105A1, 0x1057A },
+   { 0x105A3, 0x1057C }, { 0x105A4, 0x1057D }, { 0x105A5, 0x1057E },
+   { 0x105A6, 0x1057F }, { 0x105A7, 0x10580 }, { 0x105A8, 0x10581 },
+   { 0x105A9, 0x10582 }, { 0x105AA, 0x10583 }, { 0x105AB, 0x10584 },
+   { 0x105AC, 0x10585 }, { 0x105AD, 0x10586 }, { 0x105AE, 0x10587 },
+   { 0x105AF, 0x10588 }, { 0x105B0, 0x10589 }, { 0x105B1, 0x1058A },
+   { 0x105B3, 0x1058C }, { 0x105B4, 0x1058D }, { 0x105B5, 0x1058E },
+   { 0x105B6, 0x1058F }, { 0x105B7, 0x10590 }, { 0x105B8, 0x10591 },
+   { 0x105B9, 0x10592 }, { 0x105BB, 0x10594 }, { 0x105BC, 0x10595 },
+   { 0x10C80, 0x10CC0 }, { 0x10C81, 0x10CC1 }, { 0x10C82, 0x10CC2 },
+   { 0x10C83, 0x10CC3 }, { 0x10C84, 0x10CC4 }, { 0x10C85, 0x10CC5 },
+   { 0x10C86, 0x10CC6 }, { 0x10C87, 0x10CC7 }, { 0x10C88, 0x10CC8 },
+   { 0x10C89, 0x10CC9 }, { 0x10C8A, 0x10CCA }, { 0x10C8B, 0x10CCB },
+   { 0x10C8C, 0x10CCC }, { 0x10C8D, 0x10CCD }, { 0x10C8E, 0x10CCE },
+   { 0x10C8F, 0x10CCF }, { 0x10C90, 0x10CD0 }, { 0x10C91, 0x10CD1 },
+   { 0x10C92, 0x10CD2 }, { 0x10C93, 0x10CD3 }, { 0x10C94, 0x10CD4 },
+   { 0x10C95, 0x10CD5 }, { 0x10C96, 0x10CD6 }, { 0x10C97, 0x10CD7 },
+   { 0x10C98, 0x10CD8 }, { 0x10C99, 0x10CD9 }, { 0x10C9A, 0x10CDA },
+   { 0x10C9B, 0x10CDB }, { 0x10C9C, 0x10CDC }, { 0x10C9D, 0x10CDD },
+   { 0x10C9E, 0x10CDE }, { 0x10C9F, 0x10CDF }, { 0x10CA0, 0x10CE0 },
+   { 0x10CA1, 0x10CE1 }, { 0x10CA2, 0x10CE2 }, { 0x10CA3, 0x10CE3 },
+   { 0x10CA4, 0x10CE4 }, { 0x10CA5, 0x10CE5 }, { 0x10CA6, 0x10CE6 },
+   { 0x10CA7, 0x10CE7 }, { 0x10CA8, 0x10CE8 }, { 0x10CA9, 0x10CE9 },
+   { 0x10CAA, 0x10CEA }, { 0x10CAB, 0x10CEB }, { 0x10CAC, 0x10CEC },
+   { 0x10CAD, 0x10CED }, { 0x10CAE, 0x10CEE }, { 0x10CAF, 0x10CEF },
+   { 0x10CB0, 0x10CF0 }, { 0x10CB1, 0x10CF1 }, { 0x10CB2, 0x10CF2 },
+   { 0x10CC0, 0x10C80 }, { 0x10CC1, 0x10C81 }, { 0x10CC2, 0x10C82 },
+   { 0x10CC3, 0x10C83 }, { 0x10CC4, 0x10C84 }, { 0x10CC5, 0x10C85 },
+   { 0x10CC6, 0x10C86 }, { 0x10CC7, 0x10C87 }, { 0x10CC8, 0x10C88 },
+   { 0x10CC9, 0x10C89 }, { 0x10CCA, 0x10C8A }, { 0x10CCB, 0x10C8B },
+   { 0x10CCC, 0x10C8C }, { 0x10CCD, 0x10C8D }, { 0x10CCE, 0x10C8E },
+   { 0x10CCF, 0x10C8F }, { 0x10CD0, 0x10C90 }, { 0x10CD1, 0x10C91 },
+   { 0x10CD2, 0x10C92 }, { 0x10CD3, 0x10C93 }, { 0x10CD4, 0x10C94 },
+   { 0x10CD5, 0x10C95 }, { 0x10CD6, 0x10C96 }, { 0x10CD7, 0x10C97 },
+   { 0x10CD8, 0x10C98 }, { 0x10CD9, 0x10C99 }, { 0x10CDA, 0x10C9A },
+   { 0x10CDB, 0x10C9B }, { 0x10CDC, 0x10C9C }, { 0x10CDD, 0x10C9D },
+   { 0x10CDE, 0x10C9E }, { 0x10CDF, 0x10C9F }, { 0x10CE0, 0x10CA0 },
+   { 0x10CE1, 0x10CA1 }, { 0x10CE2, 0x10CA2 }, { 0x10CE3, 0x10CA3 },
+   { 0x10CE4, 0x10CA4 }, { 0x10CE5, 0x10CA5 }, { 0x10CE6, 0x10CA6 },
+   { 0x10CE7, 0x10CA7 }, { 0x10CE8, 0x10CA8 }, { 0x10CE9, 0x10CA9 },
+   { 0x10CEA, 0x10CAA }, { 0x10CEB, 0x10CAB }, { 0x10CEC, 0x10CAC },
+   { 0x10CED, 0x10CAD }, { 0x10CEE, 0x10CAE }, { 0x10CEF, 0x10CAF },
+   { 0x10CF0, 0x10CB0 }, { 0x10CF1, 0x10CB1 }, { 0x10CF2, 0x10CB2 },
+   { 0x118A0, 0x118C0 }, { 0x118A1, 0x118C1 }, { 0x118A2, 0x118C2 },
+   { 0x118A3, 0x118C3 }, { 0x118A4, 0x118C4 }, { 0x118A5, 0x118C5 },
+   { 0x118A6, 0x118C6 }, { 0x118A7, 0x118C7 }, { 0x118A8, 0x118C8 },
+   { 0x118A9, 0x118C9 }, { 0x118AA, 0x118CA }, { 0x118AB, 0x118CB },
+   { 0x118AC, 0x118CC }, { 0x118AD, 0x118CD }, { 0x118AE, 0x118CE },
+   { 0x118AF, 0x118CF }, { 0x118B0, 0x118D0 }, { 0x118B1, 0x118D1 },
+   { 0x118B2, 0x118D2 }, { 0x118B3, 0x118D3 }, { 0x118B4, 0x118D4 },
+   { 0x118B5, 0x118D5 }, { 0x118B6, 0x118D6 }, { 0x118B7, 0x118D7 },
+   { 0x118B8, 0x118D8 }, { 0x118B9, 0x118D9 }, { 0x118BA, 0x118DA },
+   { 0x118BB, 0x118DB }, { 0x118BC, 0x118DC }, { 0x118BD, 0x118DD },
+   { 0x118BE, 0x118DE }, { 0x118BF, 0x118DF }, { 0x118C0, 0x118A0 },
+   { 0x118C1, 0x118A1 }, { 0x118C2, 0x118A2 }, { 0x118C3, 0x118A3 },
+   { 0x118C4, 0x118A4 }, { 0x118C5, 0x118A5 }, { 0x118C6, 0x118A6 },
+   { 0x118C7, 0x118A7 }, { 0x118C8, 0x118A8 }, { 0x118C9, 0x118A9 },
+   { 0x118CA, 0x118AA }, { 0x118CB, 0x118AB }, { 0x118CC, 0x118AC },
+   { 0x118CD, 0x118AD }, { 0x118CE, 0x118AE }, { 0x118CF, 0x118AF },
+   { 0x118D0, 0x118B0 }, { 0x118D1, 0x118B1 }, { 0x118D2, 0x118B2 },
+   { 0x118D3, 0x118B3 }, { 0x118D4, 0x118B4 }, { 0x118D5, 0x118B5 },
+   { 0x118D6, 0x118B6 }, { 0x118D7, 0x118B7 }, { 0x118D8, 0x118B8 },
+   { 0x118D9, 0x118B9 }, { 0x118DA, 0x118BA }, { 0x118DB, 0x118BB },
+   { 0x118DC, 0x118BC }, { 0x118DD, 0x118BD }, { 0x118DE, 0x118BE },
+   { 0x118DF, 0x118BF }, { 0x16E40, 0x16E60 }, { 0x16E41, 0x16E61 },
+   { 0x16E42, 0x16E62 }, { 0x16E43, 0x16E63 }, { 0x16E44, 0x16E64 },
+   { 0x16E45, 0x16E65 }, { 0x16E46, 0x16E66 }, { 0x16E47, 0x16E67 },
+   { 0x16E48, 0x16E68 }, { 0x16E49, 0x16E69 }, { 0x16E4A, 0x16E6A },
+   { 0x16E4B, 0x16E6B }, { 0x16E4C, 0x16E6C }, { 0x16E4D, 0x16E6D },
+   { 0x16E4E, 0x16E6E }, { 0x16E4F, 0x16E6F }, { 0x16E50, 0x16E70 },
+   { 0x16E51, 0x16E71 }, { 0x16E52, 0x16E72 }, { 0x16E53, 0x16E73 },
+   { 0x16E54, 0x16E74 }, { 0x16E55, 0x16E75 }, { 0x16E56, 0x16E76 },
+   { 0x16E57, 0x16E77 }, { 0x16E58, 0x16E78 }, { 0x16E59, 0x16E79 },
+   { 0x16E5A, 0x16E7A }, { 0x16E5B, 0x16E7B }, { 0x16E5C, 0x16E7C },
+   { 0x16E5D, 0x16E7D }, { 0x16E5E, 0x16E7E }, { 0x16E5F, 0x16E7F },
+   { 0x16E60, 0x16E40 }, { 0x16E61, 0x16E41 }, { 0x16E62, 0x16E42 },
+   { 0x16E63, 0x16E43 }, { 0x16E64, 0x16E44 }, { 0x16E65, 0x16E45 },
+   { 0x16E66, 0x16E46 }, { 0x16E67, 0x16E47 }, { 0x16E68, 0x16E48 },
+   { 0x16E69, 0x16E49 }, { 0x16E6A, 0x16E4A }, { 0x16E6B, 0x16E4B },
+   { 0x16E6C, 0x16E4C }, { 0x16E6D, 0x16E4D }, { 0x16E6E, 0x16E4E },
+   { 0x16E6F, 0x16E4F }, { 0x16E70, 0x16E50 }, { 0x16E71, 0x16E51 },
+   { 0x16E72, 0x16E52 }, { 0x16E73, 0x16E53 }, { 0x16E74, 0x16E54 },
+   { 0x16E75, 0x16E55 }, { 0x16E76, 0x16E56 }, { 0x16E77, 0x16E57 },
+   { 0x16E78, 0x16E58 }, { 0x16E79, 0x16E59 }, { 0x16E7A, 0x16E5A },
+   { 0x16E7B, 0x16E5B }, { 0x16E7C, 0x16E5C }, { 0x16E7D, 0x16E5D },
+   { 0x16E7E, 0x16E5E }, { 0x16E7F, 0x16E5F }, { 0x1E900, 0x1E922 },
+   { 0x1E901, 0x1E923 }, { 0x1E902, 0x1E924 }, { 0x1E903, 0x1E925 },
+   { 0x1E904, 0x1E926 }, { 0x1E905, 0x1E927 }, { 0x1E906, 0x1E928 },
+   { 0x1E907, 0x1E929 }, { 0x1E908, 0x1E92A }, { 0x1E909, 0x1E92B },
+   { 0x1E90A, 0x1E92C }, { 0x1E90B, 0x1E92D }, { 0x1E90C, 0x1E92E },
+   { 0x1E90D, 0x1E92F }, { 0x1E90E, 0x1E930 }, { 0x1E90F, 0x1E931 },
+   { 0x1E910, 0x1E932 }, { 0x1E911, 0x1E933 }, { 0x1E912, 0x1E934 },
+   { 0x1E913, 0x1E935 }, { 0x1E914, 0x1E936 }, { 0x1E915, 0x1E937 },
+   { 0x1E916, 0x1E938 }, { 0x1E917, 0x1E939 }, { 0x1E918, 0x1E93A },
+   { 0x1E919, 0x1E93B }, { 0x1E91A, 0x1E93C }, { 0x1E91B, 0x1E93D },
+   { 0x1E91C, 0x1E93E }, { 0x1E91D, 0x1E93F }, { 0x1E91E, 0x1E940 },
+   { 0x1E91F, 0x1E941 }, { 0x1E920, 0x1E942 }, { 0x1E921, 0x1E943 },
+   { 0x1E922, 0x1E900 }, { 0x1E923, 0x1E901 }, { 0x1E924, 0x1E902 },
+   { 0x1E925, 0x1E903 }, { 0x1E926, 0x1E904 }, { 0x1E927, 0x1E905 },
+   { 0x1E928, 0x1E906 }, { 0x1E929, 0x1E907 }, { 0x1E92A, 0x1E908 },
+   { 0x1E92B, 0x1E909 }, { 0x1E92C, 0x1E90A }, { 0x1E92D, 0x1E90B },
+   { 0x1E92E, 0x1E90C }, { 0x1E92F, 0x1E90D }, { 0x1E930, 0x1E90E },
+   { 0x1E931, 0x1E90F }, { 0x1E932, 0x1E910 }, { 0x1E933, 0x1E911 },
+   { 0x1E934, 0x1E912 }, { 0x1E935, 0x1E913 }, { 0x1E936, 0x1E914 },
+   { 0x1E937, 0x1E915 }, { 0x1E938, 0x1E916 }, { 0x1E939, 0x1E917 },
+   { 0x1E93A, 0x1E918 }, { 0x1E93B, 0x1E919 }, { 0x1E93C, 0x1E91A },
+   { 0x1E93D, 0x1E91B }, { 0x1E93E, 0x1E91C }, { 0x1E93F, 0x1E91D },
+   { 0x1E940, 0x1E91E }, { 0x1E941, 0x1E91F }, { 0x1E942, 0x1E920 },
+   { 0x1E943, 0x1E921 },
+};
+
+static const uint8_t unicode_stage1[] = {
+   0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+   16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+   32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 34, 42, 43, 44, 45, 46,
+   47, 48, 49, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 52, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   53, 54, 54, 54, 55, 56, 57, 58, 59, 60, 61, 62, 17, 17, 17, 17,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+   17, 17, 17, 17, 17, 17, 17, 63, 64, 64, 64, 64, 64, 64, 64, 64,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 51, 66, 67, 68, 69, 70, 71,
+   72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+   88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103,
+   104, 104, 104, 105, 106, 107, 99, 99, 99, 99, 99, 99, 99, 99, 99, 108,
+   109, 109, 109, 109, 110, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 111, 111, 112, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 113, 113, 114, 115, 99, 99, 116, 117,
+   118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+   118, 118, 118, 118, 118, 118, 118, 119, 118, 118, 118, 120, 121, 122, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 123,
+   124, 125, 126, 99, 99, 99, 99, 99, 99, 99, 99, 99, 127, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 128,
+   129, 130, 131, 132, 133, 134, 135, 136, 137, 137, 138, 99, 99, 99, 99, 139,
+   140, 141, 142, 99, 99, 99, 99, 143, 144, 145, 99, 99, 146, 147, 148, 99,
+   149, 150, 151, 152, 153, 153, 154, 155, 156, 153, 157, 158, 99, 99, 99, 99,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 159, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 160, 161, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 162, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 163, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 51, 51, 164, 99, 99, 99, 99, 99,
+   51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+   51, 51, 51, 165, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   166, 167, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 168,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 168,
+};
+
+static const uint16_t unicode_stage2[] = {
+   0, 1, 0, 0, 2, 3, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
+   12, 0, 0, 0, 13, 14, 15, 16, 7, 7, 17, 18, 10, 10, 19, 10,
+   20, 20, 20, 20, 20, 20, 20, 21, 21, 22, 20, 20, 20, 20, 20, 23,
+   24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 21, 34, 20, 20, 35, 20,
+   20, 20, 20, 20, 20, 20, 36, 37, 38, 20, 10, 10, 10, 10, 10, 10,
+   10, 10, 39, 10, 10, 10, 40, 41, 42, 43, 44, 45, 46, 47, 45, 45,
+   48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 50,
+   51, 52, 53, 54, 55, 56, 57, 57, 57, 58, 59, 60, 61, 62, 63, 64,
+   65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 67, 67, 67, 67,
+   68, 69, 67, 67, 67, 67, 67, 67, 70, 71, 67, 67, 67, 67, 67, 67,
+   67, 67, 67, 67, 67, 67, 72, 73, 73, 73, 74, 75, 76, 76, 76, 76,
+   76, 77, 78, 79, 79, 79, 79, 80, 81, 82, 83, 83, 83, 84, 85, 82,
+   86, 87, 88, 89, 90, 90, 90, 90, 91, 92, 93, 88, 94, 95, 96, 90,
+   90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 97, 98, 99, 100, 94, 101,
+   102, 103, 104, 105, 105, 105, 106, 106, 106, 107, 90, 90, 90, 90, 90, 90,
+   108, 108, 108, 108, 109, 110, 111, 82, 112, 113, 114, 114, 114, 115, 116, 117,
+   118, 118, 119, 120, 121, 122, 123, 124, 125, 125, 125, 126, 105, 127, 90, 90,
+   90, 128, 129, 88, 90, 90, 90, 90, 90, 130, 88, 88, 131, 88, 88, 88,
+   132, 133, 133, 133, 133, 133, 133, 134, 135, 136, 137, 133, 138, 139, 140, 133,
+   141, 142, 143, 144, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+   156, 157, 158, 159, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 82,
+   170, 171, 172, 173, 173, 174, 175, 176, 177, 178, 179, 82, 180, 181, 182, 183,
+   184, 185, 186, 187, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 82,
+   198, 199, 200, 201, 202, 199, 203, 204, 205, 206, 207, 82, 208, 209, 210, 211,
+   212, 213, 214, 215, 215, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+   225, 226, 227, 228, 228, 227, 229, 230, 231, 232, 233, 234, 235, 236, 237, 82,
+   238, 239, 240, 241, 241, 241, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250,
+   251, 252, 253, 254, 252, 252, 255, 256, 253, 257, 258, 259, 260, 261, 262, 82,
+   263, 264, 264, 264, 264, 264, 265, 266, 267, 268, 269, 270, 82, 82, 82, 82,
+   271, 272, 273, 273, 274, 273, 275, 276, 277, 278, 279, 280, 82, 82, 82, 82,
+   281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 289, 289, 289, 291, 292, 293,
+   294, 295, 296, 292, 296, 296, 296, 297, 298, 299, 300, 301, 82, 82, 82, 82,
+   302, 302, 302, 302, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 302,
+   313, 314, 306, 315, 316, 316, 316, 316, 317, 318, 319, 319, 319, 319, 319, 320,
+   321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321,
+   321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321,
+   322, 322, 322, 322, 322, 322, 322, 322, 322, 323, 324, 323, 322, 322, 322, 322,
+   322, 323, 322, 322, 322, 322, 323, 324, 323, 322, 324, 322, 322, 322, 322, 322,
+   322, 322, 323, 322, 322, 322, 322, 322, 322, 322, 322, 325, 326, 327, 328, 329,
+   322, 322, 330, 331, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 333, 334,
+   335, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336,
+   336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336,
+   336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336,
+   336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336,
+   336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 336, 337, 336, 336,
+   338, 339, 339, 340, 341, 341, 341, 341, 341, 341, 341, 341, 341, 342, 343, 344,
+   345, 345, 346, 347, 348, 348, 349, 82, 350, 350, 351, 82, 352, 353, 354, 82,
+   355, 355, 355, 355, 355, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365,
+   366, 367, 368, 369, 370, 370, 370, 370, 371, 370, 370, 370, 370, 370, 370, 372,
+   373, 370, 370, 370, 370, 374, 336, 336, 336, 336, 336, 336, 336, 336, 375, 82,
+   376, 376, 376, 377, 378, 379, 380, 381, 382, 383, 384, 384, 384, 385, 386, 82,
+   387, 387, 387, 387, 387, 388, 387, 387, 387, 389, 390, 391, 392, 392, 392, 392,
+   393, 393, 394, 395, 396, 396, 396, 396, 396, 396, 397, 398, 399, 400, 401, 402,
+   403, 404, 403, 404, 405, 406, 48, 407, 48, 408, 82, 82, 82, 82, 82, 82,
+   409, 410, 410, 410, 410, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420,
+   421, 422, 422, 422, 423, 424, 425, 426, 427, 427, 427, 427, 428, 429, 430, 431,
+   432, 432, 432, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 441, 441, 442,
+   66, 443, 316, 316, 316, 316, 316, 444, 445, 82, 446, 48, 447, 448, 449, 450,
+   10, 10, 10, 10, 451, 452, 40, 40, 40, 40, 40, 453, 454, 455, 10, 456,
+   10, 10, 10, 457, 40, 40, 40, 458, 48, 48, 48, 48, 48, 48, 48, 48,
+   20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+   20, 20, 459, 460, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+   57, 54, 461, 462, 57, 54, 57, 54, 461, 462, 57, 463, 57, 54, 57, 461,
+   57, 464, 57, 464, 57, 464, 465, 466, 467, 468, 469, 470, 57, 471, 472, 473,
+   474, 475, 476, 477, 478, 479, 478, 480, 481, 478, 482, 483, 484, 485, 486, 487,
+   488, 489, 40, 490, 491, 491, 491, 491, 492, 82, 48, 493, 494, 48, 495, 82,
+   496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 488, 488, 506, 506, 506, 506,
+   507, 508, 509, 510, 511, 512, 513, 513, 513, 514, 515, 513, 513, 513, 516, 517,
+   517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+   517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+   513, 518, 513, 513, 519, 520, 513, 513, 513, 513, 513, 513, 513, 513, 513, 521,
+   513, 513, 513, 522, 517, 517, 523, 513, 513, 513, 513, 516, 519, 513, 513, 513,
+   513, 513, 513, 513, 524, 82, 82, 82, 513, 525, 82, 82, 488, 488, 488, 488,
+   488, 488, 488, 526, 513, 513, 513, 513, 513, 513, 513, 513, 513, 527, 488, 488,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   513, 513, 513, 513, 513, 513, 528, 513, 529, 513, 513, 513, 513, 513, 513, 517,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 528, 513, 513,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 530, 531, 488,
+   488, 488, 526, 513, 513, 513, 513, 513, 532, 517, 517, 517, 533, 530, 517, 517,
+   534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534,
+   534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534,
+   517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517, 517,
+   535, 536, 536, 537, 517, 517, 517, 517, 517, 517, 517, 538, 517, 517, 517, 539,
+   513, 513, 513, 513, 513, 513, 517, 517, 540, 509, 513, 513, 513, 513, 541, 513,
+   513, 513, 542, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   543, 543, 543, 543, 543, 543, 544, 544, 544, 544, 544, 544, 545, 546, 547, 548,
+   62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 549, 550, 551, 552,
+   319, 319, 319, 319, 553, 554, 555, 555, 555, 555, 555, 555, 555, 556, 557, 558,
+   322, 322, 324, 82, 324, 324, 324, 324, 324, 324, 324, 324, 559, 559, 559, 559,
+   560, 561, 562, 563, 564, 565, 478, 566, 567, 478, 568, 569, 82, 82, 82, 82,
+   570, 570, 570, 571, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 572, 82,
+   570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 570,
+   570, 570, 570, 570, 570, 570, 570, 570, 570, 570, 573, 82, 82, 82, 513, 574,
+   575, 530, 576, 577, 578, 579, 580, 581, 582, 583, 583, 583, 583, 583, 583, 583,
+   583, 583, 584, 585, 586, 587, 587, 587, 587, 587, 587, 587, 587, 587, 587, 588,
+   589, 590, 590, 590, 590, 590, 591, 321, 321, 321, 321, 321, 321, 321, 321, 321,
+   321, 592, 593, 513, 590, 590, 590, 590, 513, 513, 513, 513, 574, 82, 587, 587,
+   594, 594, 594, 595, 488, 596, 513, 513, 513, 488, 597, 488, 594, 594, 594, 598,
+   488, 596, 513, 513, 513, 513, 597, 488, 513, 513, 599, 599, 599, 599, 599, 600,
+   599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 599, 513, 513, 513, 513, 513,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 601, 601, 601, 601, 601, 513, 513, 513, 513, 513, 513, 513, 513,
+   602, 602, 603, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+   602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+   602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+   602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+   602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+   602, 604, 605, 605, 605, 605, 605, 605, 606, 82, 607, 607, 607, 607, 607, 608,
+   609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609,
+   609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609,
+   609, 610, 609, 609, 611, 612, 82, 82, 67, 67, 67, 67, 67, 613, 614, 615,
+   67, 67, 67, 616, 617, 617, 617, 617, 617, 617, 617, 617, 618, 619, 620, 82,
+   45, 45, 621, 43, 622, 20, 22, 20, 20, 20, 20, 20, 20, 20, 623, 624,
+   20, 625, 626, 20, 20, 627, 628, 20, 629, 630, 631, 632, 82, 82, 633, 634,
+   635, 636, 637, 637, 638, 639, 640, 641, 642, 642, 642, 642, 642, 642, 643, 82,
+   644, 645, 645, 645, 645, 645, 646, 647, 648, 649, 650, 651, 652, 652, 653, 654,
+   655, 656, 657, 657, 658, 659, 660, 660, 661, 662, 663, 664, 321, 321, 321, 665,
+   666, 667, 667, 667, 667, 667, 668, 669, 670, 671, 672, 673, 674, 302, 306, 675,
+   676, 676, 676, 676, 676, 677, 678, 82, 679, 680, 681, 682, 302, 302, 683, 684,
+   685, 685, 685, 685, 685, 685, 686, 687, 688, 82, 82, 689, 690, 691, 692, 82,
+   693, 693, 693, 82, 324, 324, 10, 10, 10, 10, 10, 694, 695, 696, 697, 697,
+   697, 697, 697, 697, 697, 697, 697, 697, 690, 690, 690, 690, 698, 699, 700, 701,
+   321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321,
+   321, 321, 321, 321, 702, 82, 321, 321, 592, 703, 321, 321, 321, 321, 321, 702,
+   704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704,
+   704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704, 704,
+   705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705,
+   705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 706, 601, 601,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 707, 82, 82, 82, 82,
+   708, 82, 709, 710, 83, 711, 712, 713, 714, 83, 90, 90, 90, 90, 90, 90,
+   90, 90, 90, 90, 90, 90, 715, 716, 717, 82, 718, 90, 90, 90, 90, 90,
+   90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+   90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+   90, 90, 90, 90, 90, 90, 90, 719, 720, 720, 90, 90, 90, 90, 90, 90,
+   90, 90, 721, 90, 90, 90, 90, 90, 90, 722, 82, 82, 82, 82, 90, 723,
+   48, 48, 724, 725, 48, 726, 727, 536, 728, 729, 730, 731, 732, 733, 734, 90,
+   90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 735,
+   736, 3, 4, 5, 6, 7, 7, 8, 9, 10, 10, 737, 738, 587, 739, 587,
+   587, 587, 587, 740, 321, 321, 321, 592, 741, 741, 741, 742, 743, 744, 82, 745,
+   746, 747, 746, 746, 748, 746, 746, 749, 746, 750, 746, 750, 82, 82, 82, 82,
+   746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 746, 751,
+   752, 488, 488, 488, 488, 488, 753, 513, 754, 754, 754, 754, 754, 754, 755, 756,
+   757, 758, 513, 759, 760, 82, 82, 82, 82, 82, 513, 513, 513, 513, 513, 761,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   762, 762, 762, 763, 764, 764, 764, 764, 764, 764, 765, 82, 766, 488, 488, 767,
+   768, 768, 768, 768, 769, 770, 771, 771, 772, 773, 774, 774, 774, 774, 775, 776,
+   777, 777, 777, 778, 779, 779, 779, 779, 780, 779, 781, 82, 82, 82, 82, 82,
+   782, 782, 782, 782, 782, 783, 783, 783, 783, 783, 784, 784, 784, 784, 784, 784,
+   785, 785, 785, 786, 787, 788, 789, 789, 789, 789, 790, 791, 791, 791, 791, 792,
+   793, 793, 793, 793, 793, 82, 794, 794, 794, 794, 794, 794, 795, 796, 797, 798,
+   797, 798, 799, 800, 801, 800, 801, 802, 82, 82, 82, 82, 82, 82, 82, 82,
+   803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803,
+   803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803, 803,
+   803, 803, 803, 803, 803, 803, 804, 82, 803, 803, 805, 82, 803, 82, 82, 82,
+   806, 40, 40, 40, 40, 40, 807, 808, 82, 82, 82, 82, 82, 82, 82, 82,
+   809, 810, 811, 811, 811, 811, 812, 813, 814, 814, 815, 816, 817, 817, 818, 819,
+   820, 820, 820, 821, 822, 823, 82, 82, 82, 82, 82, 82, 824, 824, 825, 826,
+   827, 827, 828, 829, 830, 830, 830, 831, 82, 82, 82, 82, 82, 82, 82, 82,
+   832, 832, 832, 832, 833, 833, 833, 834, 835, 835, 836, 835, 835, 835, 835, 835,
+   837, 838, 839, 840, 841, 841, 842, 843, 844, 845, 846, 847, 848, 848, 848, 849,
+   850, 850, 850, 851, 82, 82, 82, 82, 852, 853, 852, 852, 854, 855, 856, 82,
+   857, 857, 857, 857, 857, 857, 858, 859, 860, 860, 861, 862, 863, 863, 864, 865,
+   866, 866, 867, 868, 82, 869, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   870, 870, 870, 870, 870, 870, 870, 870, 870, 871, 82, 82, 82, 82, 82, 82,
+   872, 872, 872, 872, 872, 872, 873, 82, 874, 874, 874, 874, 874, 874, 875, 876,
+   877, 877, 877, 877, 878, 82, 879, 880, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 881, 881, 881, 882,
+   883, 883, 883, 883, 883, 884, 885, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   886, 886, 886, 887, 888, 82, 889, 889, 890, 891, 892, 893, 82, 82, 894, 894,
+   895, 896, 82, 82, 82, 82, 897, 897, 898, 899, 82, 82, 900, 900, 901, 82,
+   902, 903, 903, 903, 903, 903, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912,
+   913, 914, 914, 914, 914, 914, 915, 916, 917, 918, 919, 919, 919, 920, 921, 922,
+   923, 924, 924, 924, 925, 926, 927, 928, 929, 82, 930, 930, 930, 930, 931, 82,
+   932, 933, 933, 933, 933, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 82,
+   943, 943, 944, 943, 943, 945, 946, 947, 82, 82, 82, 82, 82, 82, 82, 82,
+   948, 949, 950, 951, 950, 952, 953, 953, 953, 953, 953, 954, 955, 956, 957, 958,
+   959, 960, 961, 962, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 971, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   972, 972, 972, 972, 972, 972, 973, 974, 975, 976, 977, 978, 979, 82, 82, 82,
+   980, 980, 980, 980, 980, 980, 981, 982, 983, 82, 984, 985, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   986, 986, 986, 986, 986, 987, 988, 989, 990, 991, 991, 992, 82, 82, 82, 82,
+   993, 993, 993, 993, 993, 993, 994, 995, 996, 82, 997, 998, 999, 1000, 82, 82,
+   1001, 1001, 1001, 1001, 1001, 1002, 1003, 1004, 1005, 1006, 82, 82, 82, 82, 82, 82,
+   1007, 1007, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1014, 1014, 1014, 1014, 1014, 1015, 1016, 1017, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 1018, 1018, 1018, 1018, 1019, 1019, 1019, 1019, 1020, 1021, 1022, 1023,
+   1024, 1025, 1026, 1027, 1027, 1027, 1028, 1029, 1030, 82, 1031, 1032, 82, 82, 82, 82,
+   82, 82, 82, 82, 1033, 1034, 1033, 1033, 1033, 1033, 1035, 1036, 1037, 82, 82, 82,
+   1038, 1039, 1040, 1040, 1040, 1040, 1041, 1042, 1043, 82, 1044, 1045, 1046, 1046, 1046, 1046,
+   1046, 1047, 1048, 1049, 1050, 82, 336, 336, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1052,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1053, 1054, 1053, 1053, 1053, 1055, 1056, 1057, 1058, 82, 1059, 1060, 1061, 1062, 1063, 1064,
+   1064, 1064, 1065, 1066, 1066, 1067, 1068, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1069, 1070, 1071, 1071, 1071, 1071, 1072, 1073, 1074, 82, 1075, 1076, 1077, 1078, 1079, 1079,
+   1079, 1080, 1081, 1082, 1083, 1084, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 1085, 1085, 1086, 1087,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 1088, 82, 1089, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+   1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+   1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+   1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+   1096, 1096, 1096, 1097, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1099, 1100, 82,
+   1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+   1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1101, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1103, 82,
+   1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+   1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+   1104, 1104, 1104, 1104, 1104, 1105, 1106, 1107, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+   1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+   1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1109, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617,
+   617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617, 617,
+   617, 617, 617, 617, 617, 617, 617, 1110, 1111, 1111, 1111, 1112, 1113, 1114, 1115, 1115,
+   1115, 1115, 1115, 1115, 1115, 1115, 1115, 1116, 1117, 1118, 1119, 1119, 1119, 1120, 1121, 82,
+   1122, 1122, 1122, 1122, 1122, 1122, 1123, 1124, 1125, 82, 1126, 1127, 1128, 1122, 1122, 1129,
+   1122, 1122, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 1130, 1130, 1130, 1130, 1131, 1131, 1131, 1131,
+   1132, 1132, 1133, 1134, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1136, 1137, 1138, 1138, 1138, 1138, 1138,
+   1138, 1139, 1140, 1141, 82, 82, 82, 82, 82, 82, 82, 82, 1142, 82, 1143, 82,
+   1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+   1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+   1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144,
+   1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 82,
+   1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+   1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+   1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+   1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1146, 82, 82, 82, 82, 82,
+   1144, 1147, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 1148, 1149,
+   1150, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+   583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+   583, 583, 583, 583, 1151, 82, 82, 82, 82, 82, 1152, 82, 1153, 82, 1154, 1154,
+   1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+   1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+   1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1155,
+   1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1157, 1156, 1158,
+   1156, 1159, 1156, 1160, 1161, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   48, 48, 48, 48, 48, 1162, 48, 48, 408, 82, 513, 513, 513, 513, 513, 513,
+   513, 513, 513, 513, 513, 513, 513, 513, 574, 82, 82, 82, 82, 82, 82, 82,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 1163, 82,
+   513, 513, 513, 513, 524, 1164, 513, 513, 513, 513, 513, 513, 1165, 1166, 1167, 1168,
+   1169, 1170, 513, 513, 513, 1171, 513, 513, 513, 513, 513, 513, 513, 525, 82, 82,
+   757, 757, 757, 757, 757, 757, 757, 757, 1172, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 488, 488, 767, 82,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 524, 82, 488, 488, 488, 1173,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1174, 1174, 1174, 1175, 1176, 1176, 1177, 1174, 1174, 1178, 1179, 1176, 1176, 1174, 1174, 1174,
+   1175, 1176, 1176, 1180, 1181, 1182, 1178, 1183, 1184, 1176, 1174, 1174, 1174, 1175, 1176, 1176,
+   1185, 1186, 1187, 1188, 1176, 1176, 1176, 1189, 1190, 1191, 1192, 1176, 1176, 1177, 1174, 1174,
+   1178, 1176, 1176, 1176, 1174, 1174, 1174, 1175, 1176, 1176, 1177, 1174, 1174, 1178, 1176, 1176,
+   1176, 1174, 1174, 1174, 1175, 1176, 1176, 1177, 1174, 1174, 1178, 1176, 1176, 1176, 1174, 1174,
+   1174, 1175, 1176, 1176, 1193, 1174, 1174, 1174, 1194, 1176, 1176, 1195, 1196, 1174, 1174, 1197,
+   1176, 1176, 1198, 1177, 1174, 1174, 1199, 1176, 1176, 1200, 1201, 1174, 1174, 1202, 1176, 1176,
+   1176, 1203, 1174, 1174, 1174, 1194, 1176, 1176, 1195, 1204, 4, 4, 4, 4, 4, 4,
+   1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205,
+   1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205,
+   1206, 1206, 1206, 1206, 1206, 1206, 1207, 1208, 1206, 1206, 1206, 1206, 1206, 1209, 1210, 1205,
+   1211, 1212, 82, 1213, 1214, 1206, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   10, 1215, 10, 708, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1216, 1217, 1217, 1218, 1219, 1220, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1221, 1221, 1221, 1221, 1221, 1222, 1223, 1224, 1225, 1226, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 1227, 1227, 1227, 1228, 82, 82, 1229, 1229, 1229, 1229, 1229, 1230, 1231, 1232,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 324, 1233, 322, 324,
+   1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234,
+   1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1235, 1236, 1237, 82, 82, 82, 82, 82,
+   1238, 1238, 1238, 1238, 1239, 1240, 1240, 1240, 1241, 1242, 1243, 1244, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 1245, 488,
+   488, 488, 488, 488, 488, 1246, 1247, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1245, 488, 488, 488, 488, 1248, 488, 1249, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1250, 90, 90, 90, 1251, 1252, 1253, 1254, 1255, 1256, 1251, 1257, 1251, 1253, 1253, 1258,
+   90, 1259, 90, 1260, 1261, 1259, 90, 1260, 82, 82, 82, 82, 82, 82, 1262, 82,
+   513, 513, 513, 513, 513, 574, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   513, 513, 574, 82, 513, 524, 1164, 513, 1164, 513, 1164, 513, 513, 513, 1163, 82,
+   488, 1263, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   513, 513, 513, 513, 513, 1163, 82, 82, 82, 82, 82, 82, 1264, 513, 513, 513,
+   1265, 82, 513, 513, 513, 513, 513, 574, 513, 1266, 1267, 82, 1163, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 1268,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 1269, 513, 759, 513, 759,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 574, 82,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 1266, 513, 574, 1266, 82,
+   513, 574, 513, 513, 513, 513, 513, 513, 513, 82, 513, 1267, 513, 513, 513, 513,
+   513, 82, 513, 513, 513, 1163, 1267, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 574, 82, 513, 1163, 759, 759,
+   524, 82, 513, 513, 513, 759, 513, 525, 1163, 82, 513, 1267, 513, 82, 524, 82,
+   513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513, 513,
+   513, 513, 1270, 513, 513, 513, 513, 513, 513, 525, 82, 82, 82, 82, 4, 1271,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 82, 82, 82, 82,
+   601, 601, 601, 601, 601, 601, 601, 1272, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 706, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 601, 707, 82, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 1272, 82, 82, 82,
+   601, 601, 601, 706, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   601, 601, 601, 601, 601, 601, 601, 601, 601, 1273, 82, 82, 82, 82, 82, 82,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   1274, 82, 82, 82, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485, 485,
+   82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+   48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 82, 82,
+   705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705,
+   705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 1275,
+};
+
+static const uint16_t unicode_stage3[] = {
+   1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 1, 1,
+   3, 4, 4, 4, 5, 4, 4, 4, 6, 7, 4, 8, 4, 9, 4, 4,
+   10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 8, 8, 8, 4,
+   4, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+   11, 11, 11, 6, 4, 7, 12, 13, 12, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 6, 8, 7, 8, 1,
+   1, 1, 1, 1, 1, 2, 1, 1, 3, 4, 5, 5, 5, 5, 15, 4,
+   12, 15, 16, 17, 8, 18, 15, 12, 15, 8, 19, 19, 12, 20, 4, 4,
+   12, 19, 16, 21, 19, 19, 19, 4, 11, 11, 11, 11, 11, 11, 11, 8,
+   11, 11, 11, 11, 11, 11, 11, 14, 14, 14, 14, 14, 14, 14, 14, 8,
+   11, 14, 11, 14, 11, 14, 11, 14, 14, 11, 14, 11, 14, 11, 14, 11,
+   14, 14, 11, 14, 11, 14, 11, 14, 11, 11, 14, 11, 14, 11, 14, 14,
+   14, 11, 11, 14, 11, 14, 11, 11, 14, 11, 11, 11, 14, 14, 11, 11,
+   11, 11, 14, 11, 11, 14, 11, 11, 11, 14, 14, 14, 11, 11, 14, 11,
+   11, 14, 11, 14, 11, 14, 11, 11, 14, 11, 14, 14, 11, 14, 11, 11,
+   14, 11, 11, 11, 14, 11, 14, 11, 11, 14, 14, 16, 11, 14, 14, 14,
+   16, 16, 16, 16, 11, 22, 14, 11, 22, 14, 11, 22, 14, 11, 14, 11,
+   14, 11, 14, 11, 14, 14, 11, 14, 14, 11, 22, 14, 11, 14, 11, 11,
+   11, 14, 11, 14, 14, 14, 14, 14, 14, 14, 11, 11, 14, 11, 11, 14,
+   14, 11, 14, 11, 11, 11, 11, 14, 14, 14, 14, 14, 16, 14, 14, 14,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24,
+   24, 24, 12, 12, 12, 12, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+   24, 24, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   23, 23, 23, 23, 23, 12, 12, 12, 12, 12, 25, 25, 24, 12, 24, 12,
+   26, 26, 26, 26, 26, 26, 26, 26, 27, 28, 27, 28, 24, 29, 27, 28,
+   0, 0, 30, 28, 28, 28, 4, 27, 0, 0, 0, 0, 29, 12, 27, 4,
+   27, 27, 27, 0, 27, 0, 27, 27, 28, 27, 27, 27, 27, 27, 27, 27,
+   27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 0, 27, 27, 27, 27, 27,
+   27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 27, 28, 28, 27, 27, 27, 28, 28, 28,
+   27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 31, 32, 31, 32, 31, 32,
+   31, 32, 31, 32, 31, 32, 31, 32, 28, 28, 28, 28, 27, 28, 33, 27,
+   28, 27, 27, 28, 28, 27, 27, 27, 34, 34, 34, 34, 34, 34, 34, 34,
+   35, 35, 35, 35, 35, 35, 35, 35, 34, 35, 34, 35, 34, 35, 34, 35,
+   34, 35, 36, 37, 37, 26, 26, 37, 38, 38, 34, 35, 34, 35, 34, 35,
+   34, 34, 35, 34, 35, 34, 35, 34, 35, 34, 35, 34, 35, 34, 35, 35,
+   0, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+   39, 39, 39, 39, 39, 39, 39, 0, 0, 40, 41, 41, 41, 41, 41, 41,
+   42, 42, 42, 42, 42, 42, 42, 42, 42, 41, 43, 0, 0, 44, 44, 45,
+   0, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+   46, 46, 46, 46, 46, 46, 47, 46, 48, 46, 46, 48, 46, 46, 48, 46,
+   0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+   49, 49, 49, 0, 0, 0, 0, 49, 49, 49, 49, 48, 48, 0, 0, 0,
+   50, 50, 50, 50, 50, 18, 51, 51, 51, 52, 52, 53, 4, 52, 54, 54,
+   55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 4, 50, 52, 52, 4,
+   56, 56, 56, 56, 56, 56, 56, 56, 24, 56, 56, 56, 56, 56, 56, 56,
+   56, 56, 56, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 55, 55,
+   57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 52, 52, 52, 52, 56, 56,
+   26, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 52, 56, 55, 55,
+   55, 55, 55, 55, 55, 18, 54, 55, 55, 55, 55, 55, 55, 58, 58, 55,
+   55, 54, 55, 55, 55, 55, 56, 56, 57, 57, 56, 56, 56, 54, 54, 56,
+   59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 0, 60,
+   61, 62, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+   62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 0, 0, 61, 61, 61,
+   63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 64, 64,
+   64, 64, 64, 64, 64, 64, 64, 64, 64, 63, 0, 0, 0, 0, 0, 0,
+   65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66,
+   66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 67, 67, 67, 67, 67,
+   67, 67, 67, 67, 68, 68, 69, 70, 70, 70, 68, 0, 0, 67, 71, 71,
+   72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 73, 73,
+   73, 73, 74, 73, 73, 73, 73, 73, 73, 73, 73, 73, 74, 73, 73, 73,
+   74, 73, 73, 73, 73, 73, 0, 0, 75, 75, 75, 75, 75, 75, 75, 75,
+   75, 75, 75, 75, 75, 75, 75, 0, 76, 76, 76, 76, 76, 76, 76, 76,
+   76, 77, 77, 77, 0, 0, 78, 0, 61, 61, 61, 0, 0, 0, 0, 0,
+   79, 56, 56, 56, 56, 56, 56, 0, 50, 50, 0, 0, 0, 0, 0, 0,
+   56, 58, 55, 55, 55, 55, 55, 55, 55, 55, 18, 55, 55, 55, 55, 55,
+   80, 80, 80, 81, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+   82, 82, 80, 81, 80, 82, 81, 81, 81, 80, 80, 80, 80, 80, 80, 80,
+   80, 81, 81, 81, 81, 80, 81, 81, 82, 26, 26, 26, 26, 80, 80, 80,
+   82, 82, 80, 80, 4, 4, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+   84, 85, 82, 82, 82, 82, 82, 82, 86, 87, 88, 88, 0, 86, 86, 86,
+   86, 86, 86, 86, 86, 0, 0, 86, 86, 0, 0, 86, 86, 86, 86, 86,
+   86, 86, 86, 86, 86, 86, 86, 86, 86, 0, 86, 86, 86, 86, 86, 86,
+   86, 0, 86, 0, 0, 0, 86, 86, 86, 86, 0, 0, 87, 86, 88, 88,
+   88, 87, 87, 87, 87, 0, 0, 88, 88, 0, 0, 88, 88, 87, 86, 0,
+   0, 0, 0, 0, 0, 0, 0, 88, 0, 0, 0, 0, 86, 86, 0, 86,
+   86, 86, 87, 87, 0, 0, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+   86, 86, 90, 90, 91, 91, 91, 91, 91, 91, 92, 90, 86, 93, 87, 0,
+   0, 94, 94, 95, 0, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 96,
+   96, 0, 0, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+   96, 0, 96, 96, 96, 96, 96, 96, 96, 0, 96, 96, 0, 96, 96, 0,
+   96, 96, 0, 0, 94, 0, 95, 95, 95, 94, 94, 0, 0, 0, 0, 94,
+   94, 0, 0, 94, 94, 94, 0, 0, 0, 94, 0, 0, 0, 0, 0, 0,
+   0, 96, 96, 96, 96, 0, 96, 0, 0, 0, 0, 0, 0, 0, 97, 97,
+   97, 97, 97, 97, 97, 97, 97, 97, 94, 94, 96, 96, 96, 94, 98, 0,
+   0, 99, 99, 100, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 0, 101,
+   101, 101, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+   101, 0, 101, 101, 101, 101, 101, 101, 101, 0, 101, 101, 0, 101, 101, 101,
+   101, 101, 0, 0, 99, 101, 100, 100, 100, 99, 99, 99, 99, 99, 0, 99,
+   99, 100, 0, 100, 100, 99, 0, 0, 101, 0, 0, 0, 0, 0, 0, 0,
+   101, 101, 99, 99, 0, 0, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+   103, 104, 0, 0, 0, 0, 0, 0, 0, 101, 99, 99, 99, 99, 99, 99,
+   0, 105, 106, 106, 0, 107, 107, 107, 107, 107, 107, 107, 107, 0, 0, 107,
+   107, 0, 0, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+   107, 0, 107, 107, 107, 107, 107, 107, 107, 0, 107, 107, 0, 107, 107, 107,
+   107, 107, 0, 0, 105, 107, 106, 105, 106, 105, 105, 105, 105, 0, 0, 106,
+   106, 0, 0, 106, 106, 105, 0, 0, 0, 0, 0, 0, 0, 105, 105, 106,
+   0, 0, 0, 0, 107, 107, 0, 107, 107, 107, 105, 105, 0, 0, 108, 108,
+   108, 108, 108, 108, 108, 108, 108, 108, 109, 107, 110, 110, 110, 110, 110, 110,
+   0, 0, 111, 112, 0, 112, 112, 112, 112, 112, 112, 0, 0, 0, 112, 112,
+   112, 0, 112, 112, 112, 112, 0, 0, 0, 112, 112, 0, 112, 0, 112, 112,
+   0, 0, 0, 112, 112, 0, 0, 0, 112, 112, 112, 112, 112, 112, 112, 112,
+   112, 112, 0, 0, 0, 0, 113, 113, 111, 113, 113, 0, 0, 0, 113, 113,
+   113, 0, 113, 113, 113, 111, 0, 0, 112, 0, 0, 0, 0, 0, 0, 113,
+   0, 0, 0, 0, 0, 0, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+   115, 115, 115, 116, 116, 116, 116, 116, 116, 117, 116, 0, 0, 0, 0, 0,
+   118, 119, 119, 119, 118, 120, 120, 120, 120, 120, 120, 120, 120, 0, 120, 120,
+   120, 0, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+   120, 120, 0, 0, 118, 120, 118, 118, 118, 119, 119, 119, 119, 0, 118, 118,
+   118, 0, 118, 118, 118, 118, 0, 0, 0, 0, 0, 0, 0, 118, 118, 0,
+   120, 120, 120, 0, 0, 120, 0, 0, 120, 120, 118, 118, 0, 0, 121, 121,
+   121, 121, 121, 121, 121, 121, 121, 121, 0, 0, 0, 0, 0, 0, 0, 122,
+   123, 123, 123, 123, 123, 123, 123, 124, 125, 126, 127, 127, 128, 125, 125, 125,
+   125, 125, 125, 125, 125, 0, 125, 125, 125, 0, 125, 125, 125, 125, 125, 125,
+   125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 0, 125, 125, 125,
+   125, 125, 0, 0, 126, 125, 127, 126, 127, 127, 127, 127, 127, 0, 126, 127,
+   127, 0, 127, 127, 126, 126, 0, 0, 0, 0, 0, 0, 0, 127, 127, 0,
+   0, 0, 0, 0, 0, 125, 125, 0, 125, 125, 126, 126, 0, 0, 129, 129,
+   129, 129, 129, 129, 129, 129, 129, 129, 0, 125, 125, 0, 0, 0, 0, 0,
+   130, 130, 131, 131, 132, 132, 132, 132, 132, 132, 132, 132, 132, 0, 132, 132,
+   132, 0, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+   132, 132, 132, 130, 130, 132, 131, 131, 131, 130, 130, 130, 130, 0, 131, 131,
+   131, 0, 131, 131, 131, 130, 132, 133, 0, 0, 0, 0, 132, 132, 132, 131,
+   134, 134, 134, 134, 134, 134, 134, 132, 132, 132, 130, 130, 0, 0, 135, 135,
+   135, 135, 135, 135, 135, 135, 135, 135, 134, 134, 134, 134, 134, 134, 134, 134,
+   134, 133, 132, 132, 132, 132, 132, 132, 0, 136, 137, 137, 0, 138, 138, 138,
+   138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 0,
+   0, 0, 138, 138, 138, 138, 138, 138, 138, 138, 0, 138, 138, 138, 138, 138,
+   138, 138, 138, 138, 0, 138, 0, 0, 0, 0, 136, 0, 0, 0, 0, 137,
+   137, 137, 136, 136, 136, 0, 136, 0, 137, 137, 137, 137, 137, 137, 137, 137,
+   0, 0, 0, 0, 0, 0, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+   0, 0, 137, 137, 140, 0, 0, 0, 0, 141, 141, 141, 141, 141, 141, 141,
+   141, 141, 141, 141, 141, 141, 141, 141, 141, 142, 141, 141, 142, 142, 142, 142,
+   142, 142, 142, 0, 0, 0, 0, 5, 141, 141, 141, 141, 141, 141, 143, 142,
+   142, 142, 142, 142, 142, 142, 142, 144, 145, 145, 145, 145, 145, 145, 145, 145,
+   145, 145, 144, 144, 0, 0, 0, 0, 0, 146, 146, 0, 146, 0, 146, 146,
+   146, 146, 146, 0, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+   146, 146, 146, 146, 0, 146, 0, 146, 146, 147, 146, 146, 147, 147, 147, 147,
+   147, 147, 147, 147, 147, 146, 0, 0, 146, 146, 146, 146, 146, 0, 148, 0,
+   147, 147, 147, 147, 147, 147, 0, 0, 149, 149, 149, 149, 149, 149, 149, 149,
+   149, 149, 0, 0, 146, 146, 146, 146, 150, 151, 151, 151, 152, 152, 152, 152,
+   152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 151, 152, 151, 151, 151,
+   153, 153, 151, 151, 151, 151, 151, 151, 154, 154, 154, 154, 154, 154, 154, 154,
+   154, 154, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 151, 153, 151, 153,
+   151, 153, 156, 157, 156, 157, 158, 158, 150, 150, 150, 150, 150, 150, 150, 150,
+   0, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 0, 0, 0,
+   0, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 158,
+   153, 153, 153, 153, 153, 152, 153, 153, 150, 150, 150, 150, 150, 153, 153, 153,
+   153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 0, 151, 151,
+   151, 151, 151, 151, 151, 151, 153, 151, 151, 151, 151, 151, 151, 0, 151, 151,
+   152, 152, 152, 152, 152, 15, 15, 15, 15, 152, 152, 0, 0, 0, 0, 0,
+   159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 160, 160, 161, 161, 161,
+   161, 160, 161, 161, 161, 161, 161, 161, 160, 161, 161, 160, 160, 161, 161, 159,
+   162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 163, 163, 163, 163, 163, 163,
+   159, 159, 159, 159, 159, 159, 160, 160, 161, 161, 159, 159, 159, 159, 161, 161,
+   161, 159, 160, 160, 160, 159, 159, 160, 160, 160, 160, 160, 160, 160, 159, 159,
+   159, 161, 161, 161, 161, 159, 159, 159, 159, 159, 161, 160, 160, 161, 161, 160,
+   160, 160, 160, 160, 160, 161, 159, 160, 162, 162, 160, 160, 160, 161, 164, 164,
+   165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 0, 165,
+   0, 0, 0, 0, 0, 165, 0, 0, 166, 166, 166, 166, 166, 166, 166, 166,
+   166, 166, 166, 4, 167, 166, 166, 166, 168, 168, 168, 168, 168, 168, 168, 168,
+   169, 169, 169, 169, 169, 169, 169, 169, 169, 0, 169, 169, 169, 169, 0, 0,
+   169, 169, 169, 169, 169, 169, 169, 0, 169, 169, 169, 0, 0, 170, 170, 170,
+   171, 171, 171, 171, 171, 171, 171, 171, 171, 172, 172, 172, 172, 172, 172, 172,
+   172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 0, 0, 0,
+   173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 0, 0, 0, 0, 0, 0,
+   174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 0, 0,
+   175, 175, 175, 175, 175, 175, 0, 0, 176, 177, 177, 177, 177, 177, 177, 177,
+   177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 178, 179, 177,
+   180, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181,
+   181, 181, 181, 182, 183, 0, 0, 0, 184, 184, 184, 184, 184, 184, 184, 184,
+   184, 184, 184, 4, 4, 4, 185, 185, 185, 184, 184, 184, 184, 184, 184, 184,
+   184, 0, 0, 0, 0, 0, 0, 0, 186, 186, 186, 186, 186, 186, 186, 186,
+   186, 186, 187, 187, 187, 188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 186,
+   189, 189, 189, 189, 189, 189, 189, 189, 189, 189, 190, 190, 191, 4, 4, 0,
+   192, 192, 192, 192, 192, 192, 192, 192, 192, 192, 193, 193, 0, 0, 0, 0,
+   194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 194, 0, 194, 194,
+   194, 0, 195, 195, 0, 0, 0, 0, 196, 196, 196, 196, 196, 196, 196, 196,
+   196, 196, 196, 196, 197, 197, 198, 197, 197, 197, 197, 197, 197, 197, 198, 198,
+   198, 198, 198, 198, 198, 198, 197, 198, 198, 197, 197, 197, 197, 197, 197, 197,
+   197, 197, 197, 197, 199, 199, 199, 200, 199, 199, 199, 201, 196, 197, 0, 0,
+   202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 0, 0, 0, 0, 0, 0,
+   203, 203, 203, 203, 203, 203, 203, 203, 203, 203, 0, 0, 0, 0, 0, 0,
+   204, 204, 4, 4, 204, 4, 205, 204, 204, 204, 204, 206, 206, 206, 207, 206,
+   208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 0, 0, 0, 0, 0, 0,
+   209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 210, 209, 209, 209, 209,
+   209, 0, 0, 0, 0, 0, 0, 0, 209, 209, 209, 209, 209, 206, 206, 209,
+   209, 206, 209, 0, 0, 0, 0, 0, 177, 177, 177, 177, 177, 177, 0, 0,
+   211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 0,
+   212, 212, 212, 213, 213, 213, 213, 212, 212, 213, 213, 213, 0, 0, 0, 0,
+   213, 213, 212, 213, 213, 213, 213, 213, 213, 212, 212, 212, 0, 0, 0, 0,
+   214, 0, 0, 0, 215, 215, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+   217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 0, 0,
+   217, 217, 217, 217, 217, 0, 0, 0, 218, 218, 218, 218, 218, 218, 218, 218,
+   218, 218, 218, 218, 0, 0, 0, 0, 218, 218, 0, 0, 0, 0, 0, 0,
+   219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 220, 0, 0, 0, 221, 221,
+   222, 222, 222, 222, 222, 222, 222, 222, 223, 223, 223, 223, 223, 223, 223, 223,
+   223, 223, 223, 223, 223, 223, 223, 224, 224, 225, 225, 224, 0, 0, 226, 226,
+   227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 228, 229, 228,
+   229, 229, 229, 229, 229, 229, 229, 0, 229, 228, 229, 228, 228, 229, 229, 229,
+   229, 229, 229, 229, 229, 228, 228, 228, 228, 228, 228, 229, 229, 229, 229, 229,
+   229, 229, 229, 229, 229, 0, 0, 229, 230, 230, 230, 230, 230, 230, 230, 230,
+   230, 230, 0, 0, 0, 0, 0, 0, 231, 231, 231, 231, 231, 231, 231, 232,
+   231, 231, 231, 231, 231, 231, 0, 0, 26, 26, 26, 26, 26, 26, 233, 26,
+   26, 26, 26, 26, 26, 26, 26, 0, 234, 234, 234, 234, 235, 236, 236, 236,
+   236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 234, 235, 234, 234,
+   234, 234, 234, 235, 234, 235, 235, 235, 235, 235, 234, 235, 235, 236, 236, 236,
+   236, 236, 236, 236, 236, 0, 0, 0, 237, 237, 237, 237, 237, 237, 237, 237,
+   237, 237, 238, 238, 238, 238, 238, 238, 238, 239, 239, 239, 239, 239, 239, 239,
+   239, 239, 239, 234, 234, 234, 234, 234, 234, 234, 234, 234, 239, 239, 239, 239,
+   239, 239, 239, 239, 239, 238, 238, 0, 240, 240, 241, 242, 242, 242, 242, 242,
+   242, 242, 242, 242, 242, 242, 242, 242, 242, 241, 240, 240, 240, 240, 241, 241,
+   240, 240, 241, 240, 240, 240, 242, 242, 243, 243, 243, 243, 243, 243, 243, 243,
+   243, 243, 242, 242, 242, 242, 242, 242, 244, 244, 244, 244, 244, 244, 244, 244,
+   244, 244, 244, 244, 244, 244, 245, 246, 245, 245, 246, 246, 246, 245, 246, 245,
+   245, 245, 246, 246, 0, 0, 0, 0, 0, 0, 0, 0, 247, 247, 247, 247,
+   248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 249, 249, 249, 249,
+   249, 249, 249, 249, 250, 250, 250, 250, 250, 250, 250, 250, 249, 249, 250, 250,
+   0, 0, 0, 251, 251, 251, 251, 251, 252, 252, 252, 252, 252, 252, 252, 252,
+   252, 252, 0, 0, 0, 248, 248, 248, 253, 253, 253, 253, 253, 253, 253, 253,
+   253, 253, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+   255, 255, 255, 255, 255, 255, 256, 256, 35, 0, 0, 0, 0, 0, 0, 0,
+   165, 165, 165, 0, 0, 165, 165, 165, 257, 257, 257, 257, 257, 257, 257, 257,
+   26, 26, 26, 4, 26, 26, 26, 26, 26, 258, 26, 26, 26, 26, 26, 26,
+   26, 259, 259, 259, 259, 26, 259, 259, 259, 259, 259, 259, 26, 259, 259, 258,
+   26, 26, 259, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 28, 28,
+   28, 28, 28, 35, 23, 23, 23, 23, 23, 23, 23, 23, 23, 30, 30, 30,
+   30, 30, 23, 23, 23, 23, 30, 30, 30, 30, 30, 14, 14, 14, 14, 14,
+   260, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 23, 23, 23, 23, 23,
+   23, 23, 23, 23, 23, 23, 23, 30, 11, 14, 11, 14, 11, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 11, 14, 28, 28, 28, 28, 28, 28, 0, 0,
+   27, 27, 27, 27, 27, 27, 0, 0, 0, 27, 0, 27, 0, 27, 0, 27,
+   261, 261, 261, 261, 261, 261, 261, 261, 28, 28, 28, 28, 28, 0, 28, 28,
+   27, 27, 27, 27, 261, 29, 28, 29, 29, 29, 28, 28, 28, 0, 28, 28,
+   27, 27, 27, 27, 261, 29, 29, 29, 28, 28, 28, 28, 0, 0, 28, 28,
+   27, 27, 27, 27, 0, 29, 29, 29, 27, 27, 27, 27, 27, 29, 29, 29,
+   0, 0, 28, 28, 28, 0, 28, 28, 27, 27, 27, 27, 261, 29, 29, 0,
+   3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18, 262, 262, 18, 18,
+   9, 9, 9, 9, 9, 9, 4, 4, 17, 21, 6, 17, 17, 21, 6, 17,
+   4, 4, 4, 4, 4, 4, 4, 4, 263, 264, 18, 18, 18, 18, 18, 3,
+   4, 17, 21, 4, 4, 4, 4, 13, 13, 4, 4, 4, 8, 6, 7, 4,
+   4, 4, 8, 4, 13, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3,
+   18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+   19, 23, 0, 0, 19, 19, 19, 19, 19, 19, 8, 8, 8, 6, 7, 23,
+   19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 8, 8, 8, 6, 7, 0,
+   23, 23, 23, 23, 23, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+   5, 0, 0, 0, 0, 0, 0, 0, 26, 26, 26, 26, 26, 233, 233, 233,
+   233, 26, 233, 233, 233, 26, 26, 26, 26, 0, 0, 0, 0, 0, 0, 0,
+   15, 15, 265, 15, 15, 15, 15, 265, 15, 15, 20, 265, 265, 265, 20, 20,
+   265, 265, 265, 20, 15, 265, 15, 15, 8, 265, 265, 265, 265, 265, 15, 15,
+   15, 15, 15, 15, 265, 15, 27, 15, 265, 15, 11, 11, 265, 265, 15, 20,
+   265, 265, 11, 265, 20, 259, 259, 259, 259, 20, 15, 15, 20, 20, 265, 265,
+   8, 8, 8, 8, 8, 265, 20, 20, 20, 20, 15, 8, 15, 15, 14, 15,
+   266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 266, 11, 14, 266, 266, 266,
+   266, 19, 15, 15, 0, 0, 0, 0, 8, 8, 8, 8, 8, 15, 15, 15,
+   15, 15, 8, 8, 15, 15, 15, 15, 8, 15, 15, 8, 15, 15, 8, 15,
+   15, 15, 15, 15, 15, 15, 8, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 8, 8, 15, 15, 8, 15, 8, 15, 15, 15,
+   15, 15, 15, 15, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+   6, 7, 6, 7, 15, 15, 15, 15, 8, 8, 15, 15, 15, 15, 15, 15,
+   15, 6, 7, 15, 15, 15, 15, 15, 15, 15, 15, 15, 8, 15, 15, 15,
+   15, 15, 15, 8, 8, 8, 8, 8, 8, 8, 8, 8, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 0, 15, 15, 15, 0, 0, 0, 0, 0,
+   19, 19, 19, 19, 15, 15, 15, 15, 15, 15, 19, 19, 19, 19, 19, 19,
+   15, 15, 15, 15, 15, 15, 15, 8, 15, 8, 15, 15, 15, 15, 15, 15,
+   6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 19, 19,
+   8, 8, 8, 8, 8, 6, 7, 8, 8, 8, 8, 8, 8, 8, 6, 7,
+   267, 267, 267, 267, 267, 267, 267, 267, 8, 8, 8, 6, 7, 6, 7, 6,
+   7, 6, 7, 6, 7, 6, 7, 6, 7, 8, 8, 8, 8, 8, 8, 8,
+   6, 7, 6, 7, 8, 8, 8, 8, 8, 8, 8, 8, 6, 7, 8, 8,
+   8, 8, 8, 8, 8, 15, 15, 8, 15, 15, 15, 15, 0, 0, 15, 15,
+   15, 15, 15, 15, 15, 15, 0, 15, 268, 268, 268, 268, 268, 268, 268, 268,
+   269, 269, 269, 269, 269, 269, 269, 269, 11, 14, 11, 11, 11, 14, 14, 11,
+   14, 11, 14, 11, 14, 11, 11, 11, 11, 14, 11, 14, 14, 11, 14, 14,
+   14, 14, 14, 14, 23, 23, 11, 11, 31, 32, 31, 32, 32, 270, 270, 270,
+   270, 270, 270, 31, 32, 31, 32, 271, 271, 271, 31, 32, 0, 0, 0, 0,
+   0, 272, 272, 272, 272, 273, 272, 272, 166, 166, 166, 166, 166, 166, 0, 166,
+   0, 0, 0, 0, 0, 166, 0, 0, 274, 274, 274, 274, 274, 274, 274, 274,
+   0, 0, 0, 0, 0, 0, 0, 275, 276, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 277, 37, 37, 37, 37, 37, 37, 37, 37,
+   4, 4, 17, 21, 17, 21, 4, 4, 4, 17, 21, 4, 17, 21, 4, 4,
+   4, 4, 4, 4, 4, 4, 4, 9, 4, 4, 9, 4, 17, 21, 4, 4,
+   17, 21, 6, 7, 6, 7, 6, 7, 6, 7, 4, 4, 4, 4, 4, 24,
+   4, 4, 9, 9, 4, 4, 4, 4, 9, 4, 6, 4, 4, 4, 4, 4,
+   15, 15, 4, 4, 4, 6, 7, 6, 7, 6, 7, 6, 7, 9, 0, 0,
+   278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 0, 278, 278, 278, 278, 278,
+   278, 278, 278, 278, 0, 0, 0, 0, 278, 278, 278, 278, 278, 278, 0, 0,
+   15, 15, 15, 15, 0, 0, 0, 0, 3, 4, 4, 4, 15, 279, 259, 280,
+   6, 7, 15, 15, 6, 7, 6, 7, 6, 7, 6, 7, 9, 6, 7, 7,
+   15, 280, 280, 280, 280, 280, 280, 280, 280, 280, 26, 26, 26, 26, 281, 281,
+   9, 24, 24, 24, 24, 24, 15, 15, 280, 280, 280, 279, 259, 4, 15, 15,
+   0, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+   282, 282, 282, 282, 282, 282, 282, 0, 0, 26, 26, 12, 12, 283, 283, 282,
+   9, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284, 284,
+   284, 284, 284, 4, 24, 285, 285, 284, 0, 0, 0, 0, 0, 286, 286, 286,
+   286, 286, 286, 286, 286, 286, 286, 286, 0, 168, 168, 168, 168, 168, 168, 168,
+   168, 168, 168, 168, 168, 168, 168, 0, 15, 15, 19, 19, 19, 19, 15, 15,
+   287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 0,
+   19, 19, 15, 15, 15, 15, 15, 15, 15, 19, 19, 19, 19, 19, 19, 19,
+   287, 287, 287, 287, 287, 287, 287, 15, 288, 288, 288, 288, 288, 288, 288, 288,
+   288, 288, 288, 288, 288, 288, 288, 15, 289, 289, 289, 289, 289, 289, 289, 289,
+   290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290, 291, 290, 290,
+   290, 290, 290, 290, 290, 0, 0, 0, 292, 292, 292, 292, 292, 292, 292, 292,
+   292, 292, 292, 292, 292, 292, 292, 0, 293, 293, 293, 293, 293, 293, 293, 293,
+   294, 294, 294, 294, 294, 294, 295, 295, 296, 296, 296, 296, 296, 296, 296, 296,
+   296, 296, 296, 296, 297, 298, 298, 298, 299, 299, 299, 299, 299, 299, 299, 299,
+   299, 299, 296, 296, 0, 0, 0, 0, 34, 35, 34, 35, 34, 35, 300, 37,
+   38, 38, 38, 301, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 301, 260,
+   34, 35, 34, 35, 260, 260, 37, 37, 302, 302, 302, 302, 302, 302, 302, 302,
+   302, 302, 302, 302, 302, 302, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303,
+   304, 304, 305, 305, 305, 305, 305, 305, 12, 12, 12, 12, 12, 12, 12, 24,
+   12, 12, 11, 14, 11, 14, 11, 14, 23, 14, 14, 14, 14, 14, 14, 14,
+   14, 11, 14, 11, 14, 11, 11, 14, 24, 12, 12, 11, 14, 11, 14, 16,
+   11, 14, 11, 14, 14, 14, 11, 14, 11, 14, 11, 11, 11, 11, 11, 14,
+   11, 11, 11, 11, 11, 14, 11, 14, 11, 14, 11, 14, 11, 11, 11, 11,
+   14, 11, 14, 0, 0, 0, 0, 0, 11, 14, 0, 14, 0, 14, 11, 14,
+   11, 14, 0, 0, 0, 0, 0, 0, 0, 0, 23, 23, 23, 11, 14, 16,
+   23, 23, 14, 16, 16, 16, 16, 16, 306, 306, 307, 306, 306, 306, 307, 306,
+   306, 306, 306, 307, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306, 306,
+   306, 306, 306, 308, 308, 307, 307, 308, 309, 309, 309, 309, 307, 0, 0, 0,
+   19, 19, 19, 19, 19, 19, 15, 15, 5, 15, 0, 0, 0, 0, 0, 0,
+   310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 311, 311, 311, 311,
+   312, 312, 313, 313, 313, 313, 313, 313, 313, 313, 313, 313, 313, 313, 313, 313,
+   313, 313, 313, 313, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312, 312,
+   312, 312, 312, 312, 314, 314, 0, 0, 0, 0, 0, 0, 0, 0, 315, 315,
+   316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 0, 0, 0, 0, 0, 0,
+   80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 82, 82, 82, 82, 82, 82,
+   84, 84, 84, 82, 84, 82, 82, 80, 317, 317, 317, 317, 317, 317, 317, 317,
+   317, 317, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318, 318,
+   318, 318, 318, 318, 318, 318, 319, 319, 319, 319, 319, 319, 319, 319, 4, 320,
+   321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 321, 322,
+   322, 322, 322, 322, 322, 322, 322, 322, 322, 322, 323, 323, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 324, 168, 168, 168, 168, 168, 0, 0, 0,
+   325, 325, 325, 326, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327, 327,
+   327, 327, 327, 325, 326, 326, 325, 325, 325, 325, 326, 326, 325, 325, 326, 326,
+   326, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 328, 0, 24,
+   329, 329, 329, 329, 329, 329, 329, 329, 329, 329, 0, 0, 0, 0, 328, 328,
+   159, 159, 159, 159, 159, 161, 330, 159, 162, 162, 159, 159, 159, 159, 159, 0,
+   331, 331, 331, 331, 331, 331, 331, 331, 331, 332, 332, 332, 332, 332, 332, 333,
+   333, 332, 332, 333, 333, 332, 332, 0, 331, 331, 331, 332, 331, 331, 331, 331,
+   331, 331, 331, 331, 332, 333, 0, 0, 334, 334, 334, 334, 334, 334, 334, 334,
+   334, 334, 0, 0, 335, 335, 335, 335, 330, 159, 159, 159, 159, 159, 159, 164,
+   164, 164, 159, 160, 161, 160, 159, 159, 336, 336, 336, 336, 336, 336, 336, 336,
+   337, 336, 337, 337, 337, 336, 336, 337, 337, 336, 336, 336, 336, 336, 337, 337,
+   336, 337, 336, 0, 0, 0, 0, 0, 0, 0, 0, 336, 336, 338, 339, 339,
+   340, 340, 340, 340, 340, 340, 340, 340, 340, 340, 340, 341, 342, 342, 341, 341,
+   343, 343, 340, 344, 344, 341, 342, 0, 0, 169, 169, 169, 169, 169, 169, 0,
+   14, 14, 14, 12, 23, 23, 23, 23, 14, 14, 14, 14, 14, 28, 14, 14,
+   14, 23, 12, 12, 0, 0, 0, 0, 175, 175, 175, 175, 175, 175, 175, 175,
+   340, 340, 340, 341, 341, 342, 341, 341, 342, 341, 341, 343, 341, 342, 0, 0,
+   345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 0, 0, 0, 0, 0, 0,
+   168, 168, 168, 168, 0, 0, 0, 0, 0, 0, 0, 168, 168, 168, 168, 168,
+   346, 346, 346, 346, 346, 346, 346, 346, 347, 347, 347, 347, 347, 347, 347, 347,
+   289, 289, 289, 289, 289, 289, 0, 0, 289, 289, 0, 0, 0, 0, 0, 0,
+   14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 42, 42, 42, 42, 42,
+   0, 0, 0, 0, 0, 49, 46, 49, 49, 348, 49, 49, 49, 49, 49, 49,
+   49, 49, 49, 49, 49, 49, 49, 0, 49, 49, 49, 49, 49, 0, 49, 0,
+   49, 49, 0, 49, 49, 0, 49, 49, 56, 56, 79, 79, 79, 79, 79, 79,
+   79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 0, 0, 0, 0, 0,
+   0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 7, 6,
+   54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 56, 56, 56, 56, 56, 56,
+   0, 0, 0, 0, 0, 0, 0, 54, 56, 56, 56, 56, 53, 54, 54, 54,
+   4, 4, 4, 4, 4, 4, 4, 6, 7, 4, 0, 0, 0, 0, 0, 0,
+   26, 26, 26, 26, 26, 26, 37, 37, 4, 9, 9, 13, 13, 6, 7, 6,
+   7, 6, 7, 6, 7, 4, 4, 6, 7, 4, 4, 4, 4, 13, 13, 13,
+   4, 4, 4, 0, 4, 4, 4, 4, 9, 6, 7, 6, 7, 6, 7, 4,
+   4, 4, 8, 9, 8, 8, 8, 0, 4, 5, 4, 4, 0, 0, 0, 0,
+   56, 56, 56, 56, 56, 0, 56, 56, 56, 56, 56, 56, 56, 0, 0, 18,
+   0, 4, 4, 4, 5, 4, 4, 4, 14, 14, 14, 6, 8, 7, 8, 6,
+   7, 4, 6, 7, 4, 4, 284, 284, 24, 284, 284, 284, 284, 284, 284, 284,
+   284, 284, 284, 284, 284, 284, 24, 24, 0, 0, 168, 168, 168, 168, 168, 168,
+   0, 0, 168, 168, 168, 0, 0, 0, 5, 5, 8, 12, 15, 5, 5, 0,
+   15, 8, 8, 8, 8, 15, 15, 0, 0, 18, 18, 18, 15, 15, 0, 0,
+   349, 349, 349, 349, 349, 349, 349, 349, 349, 349, 349, 349, 0, 349, 349, 349,
+   349, 349, 349, 349, 349, 349, 349, 0, 349, 349, 349, 0, 349, 349, 0, 349,
+   349, 349, 349, 349, 349, 349, 0, 0, 349, 349, 349, 0, 0, 0, 0, 0,
+   4, 4, 4, 0, 0, 0, 0, 19, 19, 19, 19, 19, 0, 0, 0, 15,
+   350, 350, 350, 350, 350, 350, 350, 350, 350, 350, 350, 350, 350, 351, 351, 351,
+   351, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+   352, 352, 351, 351, 352, 352, 352, 0, 15, 15, 15, 15, 15, 0, 0, 0,
+   352, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 26, 0, 0,
+   353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 353, 0, 0, 0,
+   354, 354, 354, 354, 354, 354, 354, 354, 354, 0, 0, 0, 0, 0, 0, 0,
+   26, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0,
+   355, 355, 355, 355, 355, 355, 355, 355, 356, 356, 356, 356, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 355, 355, 355, 357, 357, 357, 357, 357, 357, 357, 357,
+   357, 358, 357, 357, 357, 357, 357, 357, 357, 357, 358, 0, 0, 0, 0, 0,
+   359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 359, 360, 360,
+   360, 360, 360, 0, 0, 0, 0, 0, 361, 361, 361, 361, 361, 361, 361, 361,
+   361, 361, 361, 361, 361, 361, 0, 362, 363, 363, 363, 363, 363, 363, 363, 363,
+   363, 363, 363, 363, 0, 0, 0, 0, 364, 365, 365, 365, 365, 365, 0, 0,
+   366, 366, 366, 366, 366, 366, 366, 366, 367, 367, 367, 367, 367, 367, 367, 367,
+   368, 368, 368, 368, 368, 368, 368, 368, 369, 369, 369, 369, 369, 369, 369, 369,
+   369, 369, 369, 369, 369, 369, 0, 0, 370, 370, 370, 370, 370, 370, 370, 370,
+   370, 370, 0, 0, 0, 0, 0, 0, 371, 371, 371, 371, 371, 371, 371, 371,
+   371, 371, 371, 371, 0, 0, 0, 0, 372, 372, 372, 372, 372, 372, 372, 372,
+   372, 372, 372, 372, 0, 0, 0, 0, 373, 373, 373, 373, 373, 373, 373, 373,
+   374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 374, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 375, 376, 376, 376, 376, 376, 376, 376, 376,
+   376, 376, 376, 0, 376, 376, 376, 376, 376, 376, 376, 0, 376, 376, 0, 377,
+   377, 377, 377, 377, 377, 377, 377, 377, 377, 377, 0, 377, 377, 377, 377, 377,
+   377, 377, 0, 377, 377, 0, 0, 0, 378, 378, 378, 378, 378, 378, 378, 378,
+   378, 378, 378, 378, 378, 378, 378, 0, 378, 378, 378, 378, 378, 378, 0, 0,
+   23, 23, 23, 23, 23, 23, 0, 23, 23, 0, 23, 23, 23, 23, 23, 23,
+   23, 23, 23, 0, 0, 0, 0, 0, 379, 379, 379, 379, 379, 379, 0, 0,
+   379, 0, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379,
+   379, 379, 379, 379, 379, 379, 0, 379, 379, 0, 0, 0, 379, 0, 0, 379,
+   380, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380, 380, 0, 381,
+   382, 382, 382, 382, 382, 382, 382, 382, 383, 383, 383, 383, 383, 383, 383, 383,
+   383, 383, 383, 383, 383, 383, 383, 384, 384, 385, 385, 385, 385, 385, 385, 385,
+   386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 386, 0,
+   0, 0, 0, 0, 0, 0, 0, 387, 387, 387, 387, 387, 387, 387, 387, 387,
+   388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 0, 388, 388, 0, 0,
+   0, 0, 0, 389, 389, 389, 389, 389, 390, 390, 390, 390, 390, 390, 390, 390,
+   390, 390, 390, 390, 390, 390, 391, 391, 391, 391, 391, 391, 0, 0, 0, 392,
+   393, 393, 393, 393, 393, 393, 393, 393, 393, 393, 0, 0, 0, 0, 0, 394,
+   395, 395, 395, 395, 395, 395, 395, 395, 396, 396, 396, 396, 396, 396, 396, 396,
+   0, 0, 0, 0, 397, 397, 396, 396, 397, 397, 397, 397, 397, 397, 397, 397,
+   0, 0, 397, 397, 397, 397, 397, 397, 398, 399, 399, 399, 0, 399, 399, 0,
+   0, 0, 0, 0, 399, 399, 399, 399, 398, 398, 398, 398, 0, 398, 398, 398,
+   0, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+   398, 398, 398, 398, 398, 398, 0, 0, 399, 399, 399, 0, 0, 0, 0, 399,
+   400, 400, 400, 400, 400, 400, 400, 400, 400, 0, 0, 0, 0, 0, 0, 0,
+   401, 401, 401, 401, 401, 401, 401, 401, 401, 0, 0, 0, 0, 0, 0, 0,
+   402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 402, 403, 403, 404,
+   405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 406, 406, 406,
+   407, 407, 407, 407, 407, 407, 407, 407, 408, 407, 407, 407, 407, 407, 407, 407,
+   407, 407, 407, 407, 407, 409, 409, 0, 0, 0, 0, 410, 410, 410, 410, 410,
+   411, 411, 411, 411, 411, 411, 411, 0, 412, 412, 412, 412, 412, 412, 412, 412,
+   412, 412, 412, 412, 412, 412, 0, 0, 0, 413, 413, 413, 413, 413, 413, 413,
+   414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 0, 0,
+   415, 415, 415, 415, 415, 415, 415, 415, 416, 416, 416, 416, 416, 416, 416, 416,
+   416, 416, 416, 0, 0, 0, 0, 0, 417, 417, 417, 417, 417, 417, 417, 417,
+   418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 0, 0, 0, 0, 0, 0,
+   0, 419, 419, 419, 419, 0, 0, 0, 0, 420, 420, 420, 420, 420, 420, 420,
+   421, 421, 421, 421, 421, 421, 421, 421, 421, 0, 0, 0, 0, 0, 0, 0,
+   422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 422, 0, 0, 0, 0, 0,
+   423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 423, 0, 0, 0, 0, 0,
+   0, 0, 424, 424, 424, 424, 424, 424, 425, 425, 425, 425, 425, 425, 425, 425,
+   425, 425, 425, 425, 426, 426, 426, 426, 427, 427, 427, 427, 427, 427, 427, 427,
+   427, 427, 0, 0, 0, 0, 0, 0, 428, 428, 428, 428, 428, 428, 428, 428,
+   428, 428, 428, 428, 428, 428, 428, 0, 429, 429, 429, 429, 429, 429, 429, 429,
+   429, 429, 0, 430, 430, 431, 0, 0, 429, 429, 0, 0, 0, 0, 0, 0,
+   432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 433, 433, 433,
+   433, 433, 433, 433, 433, 433, 433, 432, 434, 434, 434, 434, 434, 434, 434, 434,
+   434, 434, 434, 434, 434, 434, 435, 435, 435, 435, 435, 435, 435, 435, 435, 435,
+   435, 436, 436, 436, 436, 437, 437, 437, 437, 437, 0, 0, 0, 0, 0, 0,
+   438, 438, 438, 438, 438, 438, 438, 438, 438, 438, 439, 439, 439, 439, 440, 440,
+   440, 440, 0, 0, 0, 0, 0, 0, 441, 441, 441, 441, 441, 441, 441, 441,
+   441, 441, 441, 441, 441, 442, 442, 442, 442, 442, 442, 442, 0, 0, 0, 0,
+   443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 443, 0,
+   444, 445, 444, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446, 446,
+   445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 445, 447,
+   447, 447, 447, 447, 447, 447, 0, 0, 0, 0, 448, 448, 448, 448, 448, 448,
+   448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 449, 449,
+   449, 449, 449, 449, 449, 449, 449, 449, 445, 446, 446, 445, 445, 446, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 445, 450, 450, 451, 452, 452, 452, 452, 452,
+   452, 452, 452, 452, 452, 452, 452, 452, 451, 451, 451, 450, 450, 450, 450, 451,
+   451, 450, 450, 453, 453, 454, 453, 453, 453, 453, 450, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 454, 0, 0, 455, 455, 455, 455, 455, 455, 455, 455,
+   455, 0, 0, 0, 0, 0, 0, 0, 456, 456, 456, 456, 456, 456, 456, 456,
+   456, 456, 0, 0, 0, 0, 0, 0, 457, 457, 457, 458, 458, 458, 458, 458,
+   458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 458, 457,
+   457, 457, 457, 457, 459, 457, 457, 457, 457, 457, 457, 457, 457, 0, 460, 460,
+   460, 460, 460, 460, 460, 460, 460, 460, 461, 461, 461, 461, 458, 459, 459, 458,
+   462, 462, 462, 462, 462, 462, 462, 462, 462, 462, 462, 463, 464, 464, 462, 0,
+   465, 465, 466, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467, 467,
+   467, 467, 467, 466, 466, 466, 465, 465, 465, 465, 465, 465, 465, 465, 465, 466,
+   466, 467, 467, 467, 467, 468, 468, 468, 468, 465, 465, 465, 465, 468, 466, 465,
+   469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 467, 468, 467, 468, 468, 468,
+   0, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470, 470,
+   470, 470, 470, 470, 470, 0, 0, 0, 471, 471, 471, 471, 471, 471, 471, 471,
+   471, 471, 0, 471, 471, 471, 471, 471, 471, 471, 471, 471, 472, 472, 472, 473,
+   473, 473, 472, 472, 473, 472, 473, 473, 474, 474, 474, 474, 474, 474, 473, 0,
+   475, 475, 475, 475, 475, 475, 475, 0, 475, 0, 475, 475, 475, 475, 0, 475,
+   475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 475, 0, 475,
+   475, 476, 0, 0, 0, 0, 0, 0, 477, 477, 477, 477, 477, 477, 477, 477,
+   477, 477, 477, 477, 477, 477, 477, 478, 479, 479, 479, 478, 478, 478, 478, 478,
+   478, 478, 478, 0, 0, 0, 0, 0, 480, 480, 480, 480, 480, 480, 480, 480,
+   480, 480, 0, 0, 0, 0, 0, 0, 481, 481, 482, 482, 0, 483, 483, 483,
+   483, 483, 483, 483, 483, 0, 0, 483, 483, 0, 0, 483, 483, 483, 483, 483,
+   483, 483, 483, 483, 483, 483, 483, 483, 483, 0, 483, 483, 483, 483, 483, 483,
+   483, 0, 483, 483, 0, 483, 483, 483, 483, 483, 0, 26, 481, 483, 482, 482,
+   481, 482, 482, 482, 482, 0, 0, 482, 482, 0, 0, 482, 482, 482, 0, 0,
+   483, 0, 0, 0, 0, 0, 0, 482, 0, 0, 0, 0, 0, 483, 483, 483,
+   483, 483, 482, 482, 0, 0, 481, 481, 481, 481, 481, 481, 481, 0, 0, 0,
+   484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 484, 485, 485, 485,
+   486, 486, 486, 486, 486, 486, 486, 486, 485, 485, 486, 486, 486, 485, 486, 484,
+   484, 484, 484, 487, 487, 487, 487, 487, 488, 488, 488, 488, 488, 488, 488, 488,
+   488, 488, 487, 487, 0, 487, 486, 484, 484, 484, 0, 0, 0, 0, 0, 0,
+   489, 489, 489, 489, 489, 489, 489, 489, 490, 490, 490, 491, 491, 491, 491, 491,
+   491, 490, 491, 490, 490, 490, 490, 491, 491, 490, 491, 491, 489, 489, 492, 489,
+   493, 493, 493, 493, 493, 493, 493, 493, 493, 493, 0, 0, 0, 0, 0, 0,
+   494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 494, 495,
+   495, 495, 496, 496, 496, 496, 0, 0, 495, 495, 495, 495, 496, 496, 495, 496,
+   496, 497, 497, 497, 497, 497, 497, 497, 497, 497, 497, 497, 497, 497, 497, 497,
+   494, 494, 494, 494, 496, 496, 0, 0, 498, 498, 498, 498, 498, 498, 498, 498,
+   499, 499, 499, 500, 500, 500, 500, 500, 500, 500, 500, 499, 499, 500, 499, 500,
+   500, 501, 501, 501, 498, 0, 0, 0, 502, 502, 502, 502, 502, 502, 502, 502,
+   502, 502, 0, 0, 0, 0, 0, 0, 204, 204, 204, 204, 204, 204, 204, 204,
+   204, 204, 204, 204, 204, 0, 0, 0, 503, 503, 503, 503, 503, 503, 503, 503,
+   503, 503, 503, 504, 505, 504, 505, 505, 504, 504, 504, 504, 504, 504, 505, 504,
+   503, 506, 0, 0, 0, 0, 0, 0, 507, 507, 507, 507, 507, 507, 507, 507,
+   507, 507, 0, 0, 0, 0, 0, 0, 508, 508, 508, 508, 508, 508, 508, 508,
+   508, 508, 508, 0, 0, 509, 509, 509, 510, 510, 509, 509, 509, 509, 510, 509,
+   509, 509, 509, 509, 0, 0, 0, 0, 511, 511, 511, 511, 511, 511, 511, 511,
+   511, 511, 512, 512, 513, 513, 513, 514, 508, 508, 508, 508, 508, 508, 508, 0,
+   515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 515, 516, 516, 516, 517,
+   517, 517, 517, 517, 517, 517, 517, 517, 516, 517, 517, 518, 0, 0, 0, 0,
+   519, 519, 519, 519, 519, 519, 519, 519, 520, 520, 520, 520, 520, 520, 520, 520,
+   521, 521, 521, 521, 521, 521, 521, 521, 521, 521, 522, 522, 522, 522, 522, 522,
+   522, 522, 522, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 523,
+   524, 524, 524, 524, 524, 524, 524, 0, 0, 524, 0, 0, 524, 524, 524, 524,
+   524, 524, 524, 524, 0, 524, 524, 0, 524, 524, 524, 524, 524, 524, 524, 524,
+   525, 525, 525, 525, 525, 525, 0, 525, 525, 0, 0, 526, 526, 525, 526, 524,
+   525, 524, 525, 526, 527, 527, 527, 0, 528, 528, 528, 528, 528, 528, 528, 528,
+   528, 528, 0, 0, 0, 0, 0, 0, 529, 529, 529, 529, 529, 529, 529, 529,
+   0, 0, 529, 529, 529, 529, 529, 529, 529, 530, 530, 530, 531, 531, 531, 531,
+   0, 0, 531, 531, 530, 530, 530, 530, 531, 529, 532, 529, 530, 0, 0, 0,
+   533, 534, 534, 534, 534, 534, 534, 534, 534, 534, 534, 533, 533, 533, 533, 533,
+   533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 533, 534, 534, 534, 534, 534,
+   534, 535, 533, 534, 534, 534, 534, 536, 536, 536, 536, 536, 536, 536, 536, 534,
+   537, 538, 538, 538, 538, 538, 538, 539, 539, 538, 538, 538, 537, 537, 537, 537,
+   537, 537, 537, 537, 537, 537, 537, 537, 537, 537, 538, 538, 538, 538, 538, 538,
+   538, 538, 538, 538, 538, 538, 538, 539, 538, 538, 540, 540, 540, 537, 540, 540,
+   540, 540, 540, 0, 0, 0, 0, 0, 541, 541, 541, 541, 541, 541, 541, 541,
+   541, 0, 0, 0, 0, 0, 0, 0, 542, 542, 542, 542, 542, 542, 542, 542,
+   542, 0, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 542, 543,
+   544, 544, 544, 544, 544, 544, 544, 0, 544, 544, 544, 544, 544, 544, 543, 544,
+   542, 545, 545, 545, 545, 545, 0, 0, 546, 546, 546, 546, 546, 546, 546, 546,
+   546, 546, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+   547, 547, 547, 547, 547, 0, 0, 0, 548, 548, 549, 549, 549, 549, 549, 549,
+   549, 549, 549, 549, 549, 549, 549, 549, 0, 0, 550, 550, 550, 550, 550, 550,
+   550, 550, 550, 550, 550, 550, 550, 550, 0, 551, 550, 550, 550, 550, 550, 550,
+   550, 551, 550, 550, 551, 550, 550, 0, 552, 552, 552, 552, 552, 552, 552, 0,
+   552, 552, 0, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552, 552,
+   552, 553, 553, 553, 553, 553, 553, 0, 0, 0, 553, 0, 553, 553, 0, 553,
+   553, 553, 553, 553, 553, 553, 552, 553, 554, 554, 554, 554, 554, 554, 554, 554,
+   554, 554, 0, 0, 0, 0, 0, 0, 555, 555, 555, 555, 555, 555, 0, 555,
+   555, 0, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555, 555,
+   555, 555, 556, 556, 556, 556, 556, 0, 557, 557, 0, 556, 556, 557, 556, 557,
+   555, 0, 0, 0, 0, 0, 0, 0, 558, 558, 558, 558, 558, 558, 558, 558,
+   558, 558, 0, 0, 0, 0, 0, 0, 559, 559, 559, 559, 559, 559, 559, 559,
+   559, 559, 559, 560, 560, 561, 561, 562, 562, 0, 0, 0, 0, 0, 0, 0,
+   293, 0, 0, 0, 0, 0, 0, 0, 115, 115, 115, 115, 115, 115, 115, 115,
+   115, 115, 115, 115, 115, 116, 116, 116, 116, 116, 116, 116, 116, 117, 117, 117,
+   117, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+   116, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 563,
+   564, 564, 564, 564, 564, 564, 564, 564, 564, 564, 0, 0, 0, 0, 0, 0,
+   565, 565, 565, 565, 565, 565, 565, 565, 565, 565, 565, 565, 565, 565, 565, 0,
+   566, 566, 566, 566, 566, 0, 0, 0, 564, 564, 564, 564, 0, 0, 0, 0,
+   567, 567, 567, 567, 567, 567, 567, 567, 567, 568, 568, 0, 0, 0, 0, 0,
+   569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 569, 0,
+   570, 570, 570, 570, 570, 570, 570, 570, 570, 0, 0, 0, 0, 0, 0, 0,
+   571, 571, 571, 571, 571, 571, 571, 571, 571, 571, 571, 571, 571, 571, 571, 0,
+   302, 0, 0, 0, 0, 0, 0, 0, 572, 572, 572, 572, 572, 572, 572, 572,
+   572, 572, 572, 572, 572, 572, 572, 0, 573, 573, 573, 573, 573, 573, 573, 573,
+   573, 573, 0, 0, 0, 0, 574, 574, 575, 575, 575, 575, 575, 575, 575, 575,
+   575, 575, 575, 575, 575, 575, 575, 0, 576, 576, 576, 576, 576, 576, 576, 576,
+   576, 576, 0, 0, 0, 0, 0, 0, 577, 577, 577, 577, 577, 577, 577, 577,
+   577, 577, 577, 577, 577, 577, 0, 0, 578, 578, 578, 578, 578, 579, 0, 0,
+   580, 580, 580, 580, 580, 580, 580, 580, 581, 581, 581, 581, 581, 581, 581, 582,
+   582, 582, 582, 582, 583, 583, 583, 583, 584, 584, 584, 584, 582, 583, 0, 0,
+   585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 0, 586, 586, 586, 586, 586,
+   586, 586, 0, 580, 580, 580, 580, 580, 0, 0, 0, 0, 0, 580, 580, 580,
+   587, 587, 587, 587, 587, 587, 587, 587, 588, 588, 588, 588, 588, 588, 588, 588,
+   589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 590,
+   590, 590, 590, 0, 0, 0, 0, 0, 591, 591, 591, 591, 591, 591, 591, 591,
+   591, 591, 591, 0, 0, 0, 0, 592, 591, 593, 593, 593, 593, 593, 593, 593,
+   593, 593, 593, 593, 593, 593, 593, 593, 0, 0, 0, 0, 0, 0, 0, 592,
+   592, 592, 592, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594, 594,
+   595, 596, 597, 279, 598, 0, 0, 0, 599, 599, 0, 0, 0, 0, 0, 0,
+   600, 600, 600, 600, 600, 600, 600, 600, 601, 601, 601, 601, 601, 601, 601, 601,
+   601, 601, 601, 601, 601, 601, 0, 0, 600, 0, 0, 0, 0, 0, 0, 0,
+   285, 285, 285, 285, 0, 285, 285, 285, 285, 285, 285, 285, 0, 285, 285, 0,
+   284, 282, 282, 282, 282, 282, 282, 282, 284, 284, 284, 0, 0, 0, 0, 0,
+   282, 282, 282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 284, 284, 284, 284,
+   602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 0, 0, 0, 0,
+   603, 603, 603, 603, 603, 603, 603, 603, 603, 603, 603, 0, 0, 0, 0, 0,
+   603, 603, 603, 603, 603, 0, 0, 0, 603, 0, 0, 0, 0, 0, 0, 0,
+   603, 603, 0, 0, 604, 605, 605, 606, 18, 18, 18, 18, 0, 0, 0, 0,
+   26, 26, 26, 26, 26, 26, 0, 0, 15, 15, 15, 15, 15, 15, 0, 0,
+   0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 258, 258, 26,
+   26, 26, 15, 15, 15, 258, 258, 258, 258, 258, 258, 18, 18, 18, 18, 18,
+   18, 18, 18, 26, 26, 26, 26, 26, 26, 26, 26, 15, 15, 26, 26, 26,
+   26, 26, 26, 26, 15, 15, 15, 15, 15, 15, 26, 26, 26, 26, 15, 15,
+   352, 352, 607, 607, 607, 352, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+   265, 265, 265, 265, 265, 265, 265, 265, 265, 265, 20, 20, 20, 20, 20, 20,
+   20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 265, 265, 265, 265,
+   265, 265, 265, 265, 265, 265, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20,
+   20, 20, 20, 20, 265, 0, 265, 265, 0, 0, 265, 0, 0, 265, 265, 0,
+   0, 265, 265, 265, 265, 0, 265, 265, 20, 20, 0, 20, 0, 20, 20, 20,
+   20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 265, 265, 0, 265,
+   265, 265, 265, 0, 0, 265, 265, 265, 265, 265, 265, 265, 265, 0, 265, 265,
+   265, 265, 265, 265, 265, 0, 20, 20, 265, 265, 0, 265, 265, 265, 265, 0,
+   265, 265, 265, 265, 265, 0, 265, 0, 0, 0, 265, 265, 265, 265, 265, 265,
+   265, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0,
+   265, 8, 20, 20, 20, 20, 20, 20, 20, 20, 20, 8, 20, 20, 20, 20,
+   20, 20, 265, 265, 265, 265, 265, 265, 265, 265, 265, 8, 20, 20, 20, 20,
+   20, 20, 20, 20, 20, 8, 20, 20, 265, 265, 265, 265, 265, 8, 20, 20,
+   20, 20, 20, 20, 20, 20, 20, 8, 20, 20, 20, 20, 20, 20, 265, 265,
+   265, 265, 265, 265, 265, 265, 265, 8, 20, 8, 20, 20, 20, 20, 20, 20,
+   20, 20, 265, 20, 0, 0, 10, 10, 608, 608, 608, 608, 608, 608, 608, 608,
+   609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 608,
+   608, 608, 608, 609, 609, 609, 609, 609, 609, 609, 609, 609, 609, 608, 608, 608,
+   608, 608, 608, 608, 608, 609, 608, 608, 608, 608, 608, 608, 609, 608, 608, 610,
+   610, 610, 610, 610, 0, 0, 0, 0, 0, 0, 0, 609, 609, 609, 609, 609,
+   0, 609, 609, 609, 609, 609, 609, 609, 14, 14, 16, 14, 14, 14, 14, 14,
+   611, 611, 611, 611, 611, 611, 611, 0, 611, 611, 611, 611, 611, 611, 611, 611,
+   611, 0, 0, 611, 611, 611, 611, 611, 611, 611, 0, 611, 611, 0, 611, 611,
+   611, 611, 611, 0, 0, 0, 0, 0, 612, 612, 612, 612, 612, 612, 612, 612,
+   612, 612, 612, 612, 612, 0, 0, 0, 613, 613, 613, 613, 613, 613, 613, 614,
+   614, 614, 614, 614, 614, 614, 0, 0, 615, 615, 615, 615, 615, 615, 615, 615,
+   615, 615, 0, 0, 0, 0, 612, 616, 617, 617, 617, 617, 617, 617, 617, 617,
+   617, 617, 617, 617, 617, 617, 618, 0, 619, 619, 619, 619, 619, 619, 619, 619,
+   619, 619, 619, 619, 620, 620, 620, 620, 621, 621, 621, 621, 621, 621, 621, 621,
+   621, 621, 0, 0, 0, 0, 0, 622, 169, 169, 169, 169, 0, 169, 169, 0,
+   623, 623, 623, 623, 623, 623, 623, 623, 623, 623, 623, 623, 623, 0, 0, 624,
+   624, 624, 624, 624, 624, 624, 624, 624, 625, 625, 625, 625, 625, 625, 625, 0,
+   626, 626, 626, 626, 626, 626, 626, 626, 626, 626, 627, 627, 627, 627, 627, 627,
+   627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 627, 628, 628, 628, 628,
+   628, 628, 628, 629, 0, 0, 0, 0, 630, 630, 630, 630, 630, 630, 630, 630,
+   630, 630, 0, 0, 0, 0, 631, 631, 0, 19, 19, 19, 19, 19, 19, 19,
+   19, 19, 19, 19, 15, 19, 19, 19, 5, 19, 19, 19, 19, 0, 0, 0,
+   19, 19, 19, 19, 19, 19, 15, 19, 19, 19, 19, 19, 19, 19, 0, 0,
+   56, 56, 56, 56, 0, 56, 56, 56, 0, 56, 56, 0, 56, 0, 0, 56,
+   0, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 0, 56, 56, 56, 56,
+   0, 56, 0, 56, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 56,
+   0, 56, 0, 56, 0, 56, 56, 56, 0, 56, 0, 56, 0, 56, 0, 56,
+   0, 56, 56, 56, 56, 0, 56, 0, 56, 56, 0, 56, 56, 56, 56, 56,
+   56, 56, 56, 56, 0, 0, 0, 0, 0, 56, 56, 56, 0, 56, 56, 56,
+   51, 51, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 15, 15, 15,
+   0, 0, 0, 0, 0, 0, 15, 15, 632, 15, 15, 0, 0, 0, 0, 0,
+   15, 0, 0, 0, 0, 0, 0, 0, 15, 15, 0, 0, 0, 0, 0, 0,
+   15, 15, 15, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 15, 15, 15,
+   15, 15, 15, 0, 15, 15, 15, 15, 10, 10, 0, 0, 0, 0, 0, 0,
+   289, 0, 0, 0, 0, 0, 0, 0, 289, 289, 289, 0, 0, 0, 0, 0,
+   0, 18, 0, 0, 0, 0, 0, 0, 347, 347, 347, 347, 347, 347, 0, 0,
+};
+
+#endif
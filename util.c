@@ -9,6 +9,16 @@
 
 #include "util.h"
 
+#define L(C) C, C+1, C+2, C+3, C+4, C+5, C+6, C+7
+const unsigned char ascii_lower[256] = {
+   L(0x00), L(0x08), L(0x10), L(0x18), L(0x20), L(0x28), L(0x30), L(0x38),
+   0x40, L('a'), L('i'), L('q'), 'y', 'z', 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+   L(0x60), L(0x68), L(0x70), L(0x78), L(0x80), L(0x88), L(0x90), L(0x98),
+   L(0xA0), L(0xA8), L(0xB0), L(0xB8), L(0xC0), L(0xC8), L(0xD0), L(0xD8),
+   L(0xE0), L(0xE8), L(0xF0), L(0xF8)
+};
+#undef L
+
 char* substring(char* begin, char* end) {
    assert(begin && end);
    int size = end - begin + 1;
@@ -53,10 +63,48 @@ bool ispow2(int u) {
    return count_ones(u) == 1;
 } 
 
+/* Odd constants for the hash: the golden ratio, and the multipliers
+ * of the 64-bit finalizer from MurmurHash3.
+ */
+#define HASH_K0 0x9e3779b97f4a7c15ULL
+#define HASH_K1 0xff51afd7ed558ccdULL
+#define HASH_K2 0xc4ceb9fe1a85ec53ULL
+
+uint32_t memhash(const void* data, size_t len) {
+   assert(data || !len);
+   const unsigned char* p = data;
+   uint64_t h = len * HASH_K0;
+   uint64_t w;
+   for (; len >= 8; p += 8, len -= 8) {
+      memcpy(&w, p, 8);
+      h = (h ^ w) * HASH_K1;
+      h ^= h >> 29;
+   }
+   if (len) {
+      w = 0;
+      memcpy(&w, p, len);
+      h = (h ^ w) * HASH_K1;
+      h ^= h >> 29;
+   }
+
+   // mix every input bit into every output bit
+   h ^= h >> 33;
+   h *= HASH_K1;
+   h ^= h >> 33;
+   h *= HASH_K2;
+   h ^= h >> 33;
+   return (uint32_t) h;
+}
+
 uint32_t strhash(char* string) {
    assert(string);
-   uint32_t hashcode = 0;
-   for (; *string != '\0'; ++string)
-      hashcode = hashcode * 31 + *string;
-   return hashcode;
+   return memhash(string, strlen(string));
+}
+
+bool fold_equal(const char* str, const char* lower, size_t n) {
+   for (size_t i = 0; i < n; ++i) {
+      if (ascii_lower[(unsigned char) str[i]] != (unsigned char) lower[i])
+         return false;
+   }
+   return true;
 }
@@ -7,6 +7,7 @@
 #define __regex_util
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /* The following structs hold a range of 16-bit ints and 32-bit ints
@@ -52,10 +53,34 @@ int count_ones(int);
   */
 bool ispow2(int);
 
+/** memhash
+  *
+  * Hash function for a block of memory. Reads eight bytes at a time,
+  * and every bit of the result depends on every bit of the input, so
+  * both the low bits and the high bits can be used to pick a slot.
+  */
+uint32_t memhash(const void*, size_t);
+
 /** strhash
   *
-  * Hash function for a string.
+  * Hash function for a null-terminated string; the same as memhash
+  * over the bytes before the null.
   */
 uint32_t strhash(char*);
 
+/* ascii_lower
+ *
+ * Maps every byte to itself, except for the ascii capital letters,
+ * which map to the small letters.
+ */
+extern const unsigned char ascii_lower[256];
+
+/** fold_equal
+  *
+  * Check if the first given number of bytes of a string are the same
+  * as those of a literal, ignoring the case of ascii letters. The
+  * letters of the literal must be small letters.
+  */
+bool fold_equal(const char*, const char* lower, size_t);
+
 #endif